@@ -0,0 +1,117 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <vector>
+
+#include <engine/game_object/archetype_storage.hpp>
+#include <engine/game_object/component.hpp>
+#include <engine/game_object/data_component.hpp>
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t OBJECT_COUNT = 100000;
+    };
+
+    struct Position : public engine::Component
+    {
+        float m_x = 0.0f;
+    };
+
+    struct Velocity : public engine::Component
+    {
+        float m_x = 1.0f;
+    };
+
+    struct Tag : public engine::Component
+    {
+    };
+
+    // the same data, kept inline in the archetype columns
+    struct PositionData
+    {
+        float m_x = 0.0f;
+    };
+
+    struct VelocityData
+    {
+        float m_x = 1.0f;
+    };
+
+    struct PackedPosition : public engine::DataComponent<PositionData>
+    {
+    };
+
+    struct PackedVelocity : public engine::DataComponent<VelocityData>
+    {
+    };
+} // namespace
+
+void benchmarks::RunArchetypeBenchmarks()
+{
+    engine::GameObjectManager& manager = engine::GameObjectManager::GetInstance();
+    engine::ArchetypeStorage&  storage = engine::ArchetypeStorage::GetInstance();
+
+    std::vector<engine::GameObject*> objects;
+    objects.reserve(Constants::OBJECT_COUNT);
+
+    for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+    {
+        engine::GameObject* object = manager.CreateGameObject("Benchmark");
+        object->AddComponent<Position>();
+        object->AddComponent<Velocity>();
+        object->AddComponent<PackedPosition>();
+        object->AddComponent<PackedVelocity>();
+
+        // split the objects across two archetypes
+        if (i % 2 == 0)
+        {
+            object->AddComponent<Tag>();
+        }
+
+        objects.push_back(object);
+    }
+
+    double traversal = benchmarks::Measure(objects.size(),
+        [ & ]()
+        {
+            manager.TraverseGameObjectsPreOrder(
+                [](engine::GameObject* object)
+                {
+                    Position* position = object->GetComponent<Position>();
+                    Velocity* velocity = object->GetComponent<Velocity>();
+                    if (position != nullptr && velocity != nullptr)
+                    {
+                        position->m_x += velocity->m_x;
+                    }
+
+                    return true;
+                });
+        });
+
+    double query = benchmarks::Measure(objects.size(),
+        [ & ]()
+        {
+            storage.ForEach<Position, Velocity>([](Position& position, Velocity& velocity) { position.m_x += velocity.m_x; });
+        });
+
+    double inlineQuery = benchmarks::Measure(objects.size(),
+        [ & ]()
+        {
+            storage.ForEach<PackedPosition, PackedVelocity>([](PositionData& position, const VelocityData& velocity) { position.m_x += velocity.m_x; });
+        });
+
+    benchmarks::Report("archetype", "traversal + GetComponent", traversal);
+    benchmarks::Report("archetype", "ForEach<Position, Velocity>", query);
+    benchmarks::Report("archetype", "ForEach<PackedPosition, PackedVelocity>", inlineQuery);
+
+    for (engine::GameObject* object : objects)
+    {
+        manager.DestroyGameObject(object);
+    }
+
+    manager.Update();
+}
\ No newline at end of file
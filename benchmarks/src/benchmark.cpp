@@ -0,0 +1,223 @@
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    std::vector<benchmarks::Result>& GetResultStorage()
+    {
+        static std::vector<benchmarks::Result> results {};
+        return results;
+    }
+
+    size_t& GetFailureStorage()
+    {
+        static size_t failureCount = 0;
+        return failureCount;
+    }
+
+    double GetOperationsPerSecond(double nanosecondsPerOperation)
+    {
+        return nanosecondsPerOperation > 0.0 ? 1e9 / nanosecondsPerOperation : 0.0;
+    }
+
+    std::string Escape(const std::string& string)
+    {
+        std::string escaped;
+        for (char c : string)
+        {
+            if (c == '"' || c == '\\')
+            {
+                escaped.push_back('\\');
+            }
+            escaped.push_back(c);
+        }
+        return escaped;
+    }
+
+    // the reader only understands the layout written by WriteJson, one result per line
+
+    bool ReadString(const std::string& line, const char* key, std::string& value)
+    {
+        std::string            pattern = std::string { "\"" } + key + "\": \"";
+        std::string::size_type start   = line.find(pattern);
+        if (start == std::string::npos)
+        {
+            return false;
+        }
+
+        value.clear();
+        for (std::string::size_type i = start + pattern.size(); i < line.size(); i++)
+        {
+            if (line[ i ] == '"')
+            {
+                return true;
+            }
+
+            if (line[ i ] == '\\' && i + 1 < line.size())
+            {
+                i++;
+            }
+            value.push_back(line[ i ]);
+        }
+
+        return false;
+    }
+
+    bool ReadNumber(const std::string& line, const char* key, double& value)
+    {
+        std::string            pattern = std::string { "\"" } + key + "\": ";
+        std::string::size_type start   = line.find(pattern);
+        if (start == std::string::npos)
+        {
+            return false;
+        }
+
+        const char* begin = line.c_str() + start + pattern.size();
+        char*       end   = nullptr;
+        value             = std::strtod(begin, &end);
+
+        return end != begin;
+    }
+
+    std::vector<benchmarks::Result> ReadJson(const char* path)
+    {
+        std::ifstream file { path };
+        if (!file)
+        {
+            throw std::runtime_error("Tried to read a benchmark baseline that could not be opened");
+        }
+
+        std::vector<benchmarks::Result> results;
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            benchmarks::Result result {};
+            double             batchSize = 0.0;
+
+            if (ReadString(line, "suite", result.m_suite)
+                && ReadString(line, "name", result.m_name)
+                && ReadNumber(line, "batch", batchSize)
+                && ReadNumber(line, "ns_per_op", result.m_nanosecondsPerOperation))
+            {
+                result.m_batchSize = static_cast<size_t>(batchSize);
+                results.push_back(result);
+            }
+        }
+
+        return results;
+    }
+} // namespace
+
+void benchmarks::Report(const char* suite, const char* name, double nanosecondsPerOperation)
+{
+    printf("%-12s %-40s %10.2f ns/op\n", suite, name, nanosecondsPerOperation);
+    GetResultStorage().push_back(Result { suite, name, 0, nanosecondsPerOperation });
+}
+
+void benchmarks::Report(const char* suite, const char* name, size_t batchSize, double nanosecondsPerOperation)
+{
+    printf("%-12s %-36s %7zu %10.2f ns/op %10.2f Mop/s\n", suite, name, batchSize, nanosecondsPerOperation, GetOperationsPerSecond(nanosecondsPerOperation) / 1e6);
+    GetResultStorage().push_back(Result { suite, name, batchSize, nanosecondsPerOperation });
+}
+
+const std::vector<benchmarks::Result>& benchmarks::GetResults()
+{
+    return GetResultStorage();
+}
+
+void benchmarks::ReportFailure(const char* suite, const char* message)
+{
+    printf("%-12s FAILED: %s\n", suite, message);
+    GetFailureStorage()++;
+}
+
+size_t benchmarks::GetFailureCount()
+{
+    return GetFailureStorage();
+}
+
+void benchmarks::WriteJson(const char* path)
+{
+    FILE* file = fopen(path, "w");
+    if (file == nullptr)
+    {
+        throw std::runtime_error("Tried to write benchmark results to a file that could not be opened");
+    }
+
+    const std::vector<Result>& results = GetResultStorage();
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"repetitions\": %d,\n", HarnessConstants::REPETITIONS);
+    fprintf(file, "  \"results\": [\n");
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result& result = results[ i ];
+
+        fprintf(file, "    { \"suite\": \"%s\", \"name\": \"%s\", \"batch\": %zu, \"ns_per_op\": %.4f, \"ops_per_second\": %.1f }%s\n",
+            Escape(result.m_suite).c_str(),
+            Escape(result.m_name).c_str(),
+            result.m_batchSize,
+            result.m_nanosecondsPerOperation,
+            GetOperationsPerSecond(result.m_nanosecondsPerOperation),
+            i + 1 < results.size() ? "," : "");
+    }
+
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+    fclose(file);
+}
+
+size_t benchmarks::CompareWithBaseline(const char* path, double threshold)
+{
+    std::vector<Result> baseline = ReadJson(path);
+
+    size_t regressions = 0;
+    size_t missing     = 0;
+
+    printf("\n%-12s %-36s %7s %12s %12s %8s\n", "suite", "name", "batch", "baseline", "current", "change");
+
+    for (const Result& result : GetResultStorage())
+    {
+        const Result* previous = nullptr;
+        for (const Result& candidate : baseline)
+        {
+            if (candidate.m_suite == result.m_suite && candidate.m_name == result.m_name && candidate.m_batchSize == result.m_batchSize)
+            {
+                previous = &candidate;
+                break;
+            }
+        }
+
+        if (previous == nullptr || previous->m_nanosecondsPerOperation <= 0.0)
+        {
+            missing++;
+            continue;
+        }
+
+        double change       = result.m_nanosecondsPerOperation / previous->m_nanosecondsPerOperation - 1.0;
+        bool   isRegression = change > threshold;
+
+        if (isRegression)
+        {
+            regressions++;
+        }
+
+        printf("%-12s %-36s %7zu %12.2f %12.2f %+7.1f%%%s\n",
+            result.m_suite.c_str(),
+            result.m_name.c_str(),
+            result.m_batchSize,
+            previous->m_nanosecondsPerOperation,
+            result.m_nanosecondsPerOperation,
+            change * 100.0,
+            isRegression ? " REGRESSION" : "");
+    }
+
+    printf("%zu regressions above %.1f%%, %zu results not in the baseline\n", regressions, threshold * 100.0, missing);
+
+    return regressions;
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h> // _ReadWriteBarrier
+#endif
+
+namespace benchmarks
+{
+    struct HarnessConstants
+    {
+        static constexpr int REPETITIONS = 5;
+    };
+
+    // prevents the compiler from optimizing away a computed value
+    template <typename T>
+    void DoNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER)
+        static volatile char sink;
+        sink = *reinterpret_cast<const volatile char*>(&value);
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    // deterministic random numbers, so that every run measures the same work
+    struct Random
+    {
+        uint64_t m_state;
+
+        explicit Random(uint64_t seed = 0x9E3779B97F4A7C15ull)
+            : m_state { seed }
+        {
+        }
+
+        uint64_t Next()
+        {
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 7;
+            m_state ^= m_state << 17;
+            return m_state;
+        }
+
+        float NextFloat(float min, float max)
+        {
+            return min + (max - min) * static_cast<float>(Next() >> 40) / static_cast<float>(1ull << 24);
+        }
+    };
+
+    // runs func several times and returns the best time per operation, in nanoseconds.
+    // func is expected to perform operationCount operations on each call
+    template <typename Func>
+    double Measure(size_t operationCount, Func&& func)
+    {
+        double best = 0.0;
+
+        for (int i = 0; i < HarnessConstants::REPETITIONS; i++)
+        {
+            std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+            func();
+            std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+            double elapsed = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(operationCount);
+            if (i == 0 || elapsed < best)
+            {
+                best = elapsed;
+            }
+        }
+
+        return best;
+    }
+
+    // same as Measure, but setup runs untimed before every call to func
+    template <typename Setup, typename Func>
+    double MeasureWithSetup(size_t operationCount, Setup&& setup, Func&& func)
+    {
+        double best = 0.0;
+
+        for (int i = 0; i < HarnessConstants::REPETITIONS; i++)
+        {
+            setup();
+
+            std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+            func();
+            std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+            double elapsed = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(operationCount);
+            if (i == 0 || elapsed < best)
+            {
+                best = elapsed;
+            }
+        }
+
+        return best;
+    }
+
+    struct Result
+    {
+        std::string m_suite;
+        std::string m_name;
+        size_t      m_batchSize; // 0 when the benchmark is not run at several batch sizes
+        double      m_nanosecondsPerOperation;
+    };
+
+    // prints the result and keeps it for WriteJson and CompareWithBaseline
+    void Report(const char* suite, const char* name, double nanosecondsPerOperation);
+    void Report(const char* suite, const char* name, size_t batchSize, double nanosecondsPerOperation);
+
+    const std::vector<Result>& GetResults();
+
+    // records a failed correctness check made by a suite. the run exits with 1 if there was any
+    void   ReportFailure(const char* suite, const char* message);
+    size_t GetFailureCount();
+
+    // writes every result reported so far, one per line
+    void WriteJson(const char* path);
+
+    // compares the results with the ones of the same suite, name and batch size in a file written by
+    // WriteJson. returns how many are slower than their baseline by more than threshold (0.1 is 10%)
+    size_t CompareWithBaseline(const char* path, double threshold);
+} // namespace benchmarks
+
+#endif
\ No newline at end of file
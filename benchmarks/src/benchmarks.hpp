@@ -0,0 +1,24 @@
+#ifndef BENCHMARKS_HPP
+#define BENCHMARKS_HPP
+
+namespace benchmarks
+{
+    void RunPoolBenchmarks();
+    void RunComponentBenchmarks();
+    void RunArchetypeBenchmarks();
+    void RunHierarchyBenchmarks();
+    void RunNameBenchmarks();
+    void RunDestructionBenchmarks();
+    void RunSystemBenchmarks();
+    void RunJobBenchmarks();
+    void RunTraversalBenchmarks();
+    void RunTransformBenchmarks();
+    void RunSimdBenchmarks();
+    void RunMathBenchmarks();
+    void RunQuantizationBenchmarks();
+    void RunSpatialBenchmarks();
+    void RunCullingBenchmarks();
+    void RunPipelineBenchmarks();
+} // namespace benchmarks
+
+#endif
\ No newline at end of file
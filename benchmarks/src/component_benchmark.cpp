@@ -0,0 +1,105 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <list>
+#include <vector>
+
+#include <engine/game_object/component.hpp>
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t OBJECT_COUNT = 10000;
+    };
+
+    template <int N>
+    struct DummyComponent : public engine::Component
+    {
+        int m_value = N;
+    };
+
+    // what GetComponent<T> used to do
+    template <typename T>
+    T* ScanComponent(const engine::GameObject* object)
+    {
+        for (engine::Component* component : object->GetAllComponents())
+        {
+            if (T* castedComponent = dynamic_cast<T*>(component))
+            {
+                return castedComponent;
+            }
+        }
+
+        return nullptr;
+    }
+} // namespace
+
+void benchmarks::RunComponentBenchmarks()
+{
+    engine::GameObjectManager& manager = engine::GameObjectManager::GetInstance();
+
+    std::vector<engine::GameObject*> objects;
+    objects.reserve(Constants::OBJECT_COUNT);
+
+    for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+    {
+        engine::GameObject* object = manager.CreateGameObject("Benchmark");
+        object->AddComponent<DummyComponent<0>>();
+        object->AddComponent<DummyComponent<1>>();
+        object->AddComponent<DummyComponent<2>>();
+        object->AddComponent<DummyComponent<3>>();
+        object->AddComponent<DummyComponent<4>>();
+        object->AddComponent<DummyComponent<5>>();
+        objects.push_back(object);
+    }
+
+    double scan = benchmarks::Measure(objects.size(),
+        [ & ]()
+        {
+            int sum = 0;
+            for (engine::GameObject* object : objects)
+            {
+                sum += ScanComponent<DummyComponent<5>>(object)->m_value;
+            }
+
+            benchmarks::DoNotOptimize(sum);
+        });
+
+    double lookup = benchmarks::Measure(objects.size(),
+        [ & ]()
+        {
+            int sum = 0;
+            for (engine::GameObject* object : objects)
+            {
+                sum += object->GetComponent<DummyComponent<5>>()->m_value;
+            }
+
+            benchmarks::DoNotOptimize(sum);
+        });
+
+    double has = benchmarks::Measure(objects.size(),
+        [ & ]()
+        {
+            int count = 0;
+            for (engine::GameObject* object : objects)
+            {
+                count += object->HasComponent<DummyComponent<6>>() ? 1 : 0;
+            }
+
+            benchmarks::DoNotOptimize(count);
+        });
+
+    benchmarks::Report("component", "dynamic_cast scan (last of 6)", scan);
+    benchmarks::Report("component", "GetComponent<T> (last of 6)", lookup);
+    benchmarks::Report("component", "HasComponent<T> (missing)", has);
+
+    for (engine::GameObject* object : objects)
+    {
+        manager.DestroyGameObject(object);
+    }
+
+    manager.Update();
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <engine/culling/frustum.hpp>
+#include <engine/culling/frustum_culling.hpp>
+#include <engine/simd/cpu_features.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t OBJECT_COUNT    = 1000000;
+        static constexpr float  WORLD_EXTENT    = 1000.0f;
+        static constexpr float  MAX_OBJECT_SIZE = 5.0f;
+        static constexpr float  FIELD_OF_VIEW   = 1.0f; // radians
+        static constexpr float  FAR_PLANE       = 1000.0f;
+    };
+
+    // objects whose result differs from Frustum::Intersects, up to rounding at the planes
+    template <typename Volume>
+    size_t CountMismatches(const engine::Frustum& frustum, const std::vector<Volume>& volumes, const std::vector<uint32_t>& visible, size_t visibleCount)
+    {
+        std::vector<bool> isVisible(volumes.size(), false);
+        for (size_t i = 0; i < visibleCount; i++)
+        {
+            isVisible[ visible[ i ] ] = true;
+        }
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < volumes.size(); i++)
+        {
+            mismatches += frustum.Intersects(volumes[ i ]) != isVisible[ i ] ? 1 : 0;
+        }
+
+        return mismatches;
+    }
+} // namespace
+
+void benchmarks::RunCullingBenchmarks()
+{
+    benchmarks::Random random;
+
+    std::vector<engine::Sphere> spheres;
+    std::vector<engine::Aabb>   boxes;
+    std::vector<float>          localRadii;
+
+    engine::TransformationBuffer transformations;
+    engine::BoundingSphereBuffer sphereBuffer;
+    engine::BoundingBoxBuffer    boxBuffer;
+
+    transformations.Resize(Constants::OBJECT_COUNT);
+    sphereBuffer.Resize(Constants::OBJECT_COUNT);
+    boxBuffer.Resize(Constants::OBJECT_COUNT);
+
+    for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+    {
+        glm::vec3 position {
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+        };
+        glm::vec3 extents { random.NextFloat(0.1f, Constants::MAX_OBJECT_SIZE), random.NextFloat(0.1f, Constants::MAX_OBJECT_SIZE), random.NextFloat(0.1f, Constants::MAX_OBJECT_SIZE) };
+
+        transformations.Set(i, engine::Transformation { position, engine::Rotation {}, glm::vec3 { random.NextFloat(0.5f, 2.0f) } });
+        localRadii.push_back(random.NextFloat(0.1f, Constants::MAX_OBJECT_SIZE));
+
+        boxes.push_back(engine::Aabb::FromCenterExtents(position, extents));
+        boxBuffer.Set(i, boxes.back());
+    }
+
+    engine::TransformationArrays transformationArrays = transformations.GetArrays();
+    engine::BoundingSphereArrays sphereArrays         = sphereBuffer.GetArrays();
+    engine::BoundingBoxArrays    boxArrays            = boxBuffer.GetArrays();
+
+    double derive = benchmarks::Measure(Constants::OBJECT_COUNT,
+        [ & ]()
+        {
+            engine::ComputeBoundingSpheres(transformationArrays, localRadii.data(), sphereArrays);
+            benchmarks::DoNotOptimize(sphereArrays.m_radius[ 0 ]);
+        });
+
+    benchmarks::Report("culling", "bounding spheres from transformations", derive);
+
+    for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+    {
+        spheres.push_back(sphereBuffer.Get(i));
+    }
+
+    glm::mat4       projection = glm::perspective(Constants::FIELD_OF_VIEW, 16.0f / 9.0f, 0.1f, Constants::FAR_PLANE);
+    glm::mat4       view       = glm::lookAt(glm::vec3 { 0.0f }, glm::vec3 { 0.0f, 0.0f, -1.0f }, glm::vec3 { 0.0f, 1.0f, 0.0f });
+    engine::Frustum frustum    = engine::Frustum::FromMatrix(projection * view);
+
+    std::vector<uint32_t> visible(Constants::OBJECT_COUNT);
+    size_t                visibleCount = 0;
+
+    engine::SimdLevel best = engine::GetSimdLevel();
+
+    for (size_t level = 0; level <= static_cast<size_t>(best); level++)
+    {
+        engine::SetSimdLevel(static_cast<engine::SimdLevel>(level));
+
+        const char* levelName = engine::GetSimdLevelName(engine::GetSimdLevel());
+        char        name[ 64 ];
+
+        double sphereTime = benchmarks::Measure(Constants::OBJECT_COUNT,
+            [ & ]()
+            {
+                visibleCount = engine::CullSpheres(frustum, sphereArrays, visible.data());
+                benchmarks::DoNotOptimize(visible[ 0 ]);
+            });
+
+        snprintf(name, sizeof(name), "cull spheres (%s), per object", levelName);
+        benchmarks::Report("culling", name, sphereTime);
+        printf("%-12s %zu of %zu spheres visible, %zu mismatches, %.3f ms per million\n", "culling", visibleCount, spheres.size(),
+            CountMismatches(frustum, spheres, visible, visibleCount), sphereTime);
+
+        double boxTime = benchmarks::Measure(Constants::OBJECT_COUNT,
+            [ & ]()
+            {
+                visibleCount = engine::CullBoxes(frustum, boxArrays, visible.data());
+                benchmarks::DoNotOptimize(visible[ 0 ]);
+            });
+
+        snprintf(name, sizeof(name), "cull boxes (%s), per object", levelName);
+        benchmarks::Report("culling", name, boxTime);
+        printf("%-12s %zu of %zu boxes visible, %zu mismatches, %.3f ms per million\n", "culling", visibleCount, boxes.size(),
+            CountMismatches(frustum, boxes, visible, visibleCount), boxTime);
+    }
+
+    engine::SetSimdLevel(best);
+}
\ No newline at end of file
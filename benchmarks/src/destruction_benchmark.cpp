@@ -0,0 +1,96 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <engine/game_object/component.hpp>
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t WAVE_SIZE          = 20000;
+        static constexpr size_t CHILDREN_PER_ENEMY = 2;
+        static constexpr size_t BUDGET             = 1000;
+    };
+
+    template <int N>
+    struct DummyComponent : public engine::Component
+    {
+        int m_value = N;
+    };
+
+    void SpawnWave(std::vector<engine::GameObject*>& enemies)
+    {
+        engine::GameObjectManager& manager = engine::GameObjectManager::GetInstance();
+
+        enemies.clear();
+        for (size_t i = 0; i < Constants::WAVE_SIZE; i++)
+        {
+            engine::GameObject* enemy = manager.CreateGameObject("Enemy");
+            enemy->AddComponent<DummyComponent<0>>();
+            enemy->AddComponent<DummyComponent<1>>();
+
+            for (size_t j = 0; j < Constants::CHILDREN_PER_ENEMY; j++)
+            {
+                enemy->CreateChild("Part")->AddComponent<DummyComponent<2>>();
+            }
+
+            enemies.push_back(enemy);
+        }
+    }
+} // namespace
+
+void benchmarks::RunDestructionBenchmarks()
+{
+    engine::GameObjectManager& manager = engine::GameObjectManager::GetInstance();
+
+    std::vector<engine::GameObject*> enemies;
+    enemies.reserve(Constants::WAVE_SIZE);
+
+    // the whole wave dies in the same frame, some objects are destroyed twice
+    double wave = benchmarks::MeasureWithSetup(enemies.capacity(),
+        [ & ]()
+        {
+            SpawnWave(enemies);
+        },
+        [ & ]()
+        {
+            for (engine::GameObject* enemy : enemies)
+            {
+                manager.DestroyGameObject(enemy);
+                manager.DestroyGameObject(enemy->GetFirstChild());
+                manager.DestroyGameObject(enemy);
+            }
+
+            manager.Update();
+        });
+
+    // worst single frame when the destruction budget spreads the wave over several updates
+    manager.SetDestructionBudget(Constants::BUDGET);
+
+    SpawnWave(enemies);
+    for (engine::GameObject* enemy : enemies)
+    {
+        manager.DestroyGameObject(enemy);
+    }
+
+    double worstFrame = 0.0;
+    while (manager.GetPendingDestroyCount() > 0)
+    {
+        std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+        manager.Update();
+        std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+        double frame = std::chrono::duration<double, std::nano>(end - start).count();
+        worstFrame   = frame > worstFrame ? frame : worstFrame;
+    }
+
+    manager.SetDestructionBudget(engine::GameObjectManager::Constants::UNLIMITED_DESTRUCTION_BUDGET);
+
+    benchmarks::Report("destruction", "wave, per enemy", wave);
+    benchmarks::Report("destruction", "budgeted wave, worst frame per object", worstFrame / Constants::BUDGET);
+}
\ No newline at end of file
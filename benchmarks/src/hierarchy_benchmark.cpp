@@ -0,0 +1,80 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <vector>
+
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t CHILD_COUNT = 10000;
+    };
+} // namespace
+
+void benchmarks::RunHierarchyBenchmarks()
+{
+    engine::GameObjectManager& manager = engine::GameObjectManager::GetInstance();
+
+    engine::GameObject* first  = manager.CreateGameObject("First");
+    engine::GameObject* second = manager.CreateGameObject("Second");
+
+    std::vector<engine::GameObject*> children;
+    children.reserve(Constants::CHILD_COUNT);
+
+    for (size_t i = 0; i < Constants::CHILD_COUNT; i++)
+    {
+        children.push_back(first->CreateChild("Child"));
+    }
+
+    // move every child back and forth, picking them from the middle of the list
+    double reparent = benchmarks::Measure(2 * children.size(),
+        [ & ]()
+        {
+            for (engine::GameObject* child : children)
+            {
+                second->AddChild(child);
+            }
+
+            for (engine::GameObject* child : children)
+            {
+                first->AddChild(child);
+            }
+        });
+
+    double indexed = benchmarks::Measure(children.size(),
+        [ & ]()
+        {
+            size_t sum = 0;
+            for (size_t i = 0; i < first->GetChildCount(); i++)
+            {
+                sum += reinterpret_cast<uintptr_t>(first->GetChild(i));
+            }
+
+            benchmarks::DoNotOptimize(sum);
+        });
+
+    double detach = benchmarks::Measure(2 * children.size(),
+        [ & ]()
+        {
+            for (engine::GameObject* child : children)
+            {
+                child->MakeParent();
+            }
+
+            for (engine::GameObject* child : children)
+            {
+                first->AddChild(child);
+            }
+        });
+
+    benchmarks::Report("hierarchy", "reparent", reparent);
+    benchmarks::Report("hierarchy", "GetChild(index)", indexed);
+    benchmarks::Report("hierarchy", "detach to root and back", detach);
+
+    manager.DestroyGameObject(first);
+    manager.DestroyGameObject(second);
+    manager.Update();
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include <engine/job/job_system.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t JOB_COUNT     = 10000;
+        static constexpr size_t ELEMENT_COUNT = 1 << 20;
+    };
+} // namespace
+
+void benchmarks::RunJobBenchmarks()
+{
+    engine::JobSystem& jobs = engine::JobSystem::GetInstance();
+    jobs.Initialize();
+
+    printf("job system running with %zu workers\n", jobs.GetWorkerCount());
+
+    // cost of queueing, running and waiting for one empty job
+    double single = benchmarks::Measure(Constants::JOB_COUNT,
+        [ & ]()
+        {
+            auto empty = []() {};
+            for (size_t i = 0; i < Constants::JOB_COUNT; i++)
+            {
+                engine::JobCounter counter {};
+                jobs.Run(counter, empty);
+                jobs.Wait(counter);
+            }
+        });
+
+    // many empty jobs in flight at once, mostly measures the deques and stealing
+    double burst = benchmarks::Measure(Constants::JOB_COUNT,
+        [ & ]()
+        {
+            auto               empty = []() {};
+            engine::JobCounter counter {};
+            for (size_t i = 0; i < Constants::JOB_COUNT; i++)
+            {
+                jobs.Run(counter, empty);
+            }
+
+            jobs.Wait(counter);
+        });
+
+    // one empty job per element, the worst possible granularity for parallel for
+    double forEmpty = benchmarks::Measure(Constants::JOB_COUNT,
+        [ & ]()
+        {
+            jobs.ParallelFor(0, Constants::JOB_COUNT, [](size_t) {}, 1);
+        });
+
+    std::vector<float> values(Constants::ELEMENT_COUNT, 1.0f);
+
+    auto work = [ & ](size_t i)
+    {
+        values[ i ] = std::sqrt(values[ i ] * 1.0001f + 0.5f);
+    };
+
+    double serial = benchmarks::Measure(values.size(),
+        [ & ]()
+        {
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                work(i);
+            }
+
+            benchmarks::DoNotOptimize(values[ 0 ]);
+        });
+
+    double parallel = benchmarks::Measure(values.size(),
+        [ & ]()
+        {
+            jobs.ParallelFor(0, values.size(), work);
+            benchmarks::DoNotOptimize(values[ 0 ]);
+        });
+
+    benchmarks::Report("jobs", "run + wait, one job", single);
+    benchmarks::Report("jobs", "burst of empty jobs", burst);
+    benchmarks::Report("jobs", "parallel for, one element per job", forEmpty);
+    benchmarks::Report("jobs", "serial loop", serial);
+    benchmarks::Report("jobs", "parallel for", parallel);
+
+    jobs.Shutdown();
+}
\ No newline at end of file
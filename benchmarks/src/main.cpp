@@ -0,0 +1,147 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+#include <shared/logger.hpp>
+
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr double DEFAULT_REGRESSION_THRESHOLD = 0.1;
+    };
+
+    struct Suite
+    {
+        const char* m_name;
+        void (*m_run)();
+    };
+
+    constexpr Suite SUITES[] = {
+        { "pool", benchmarks::RunPoolBenchmarks },
+        { "component", benchmarks::RunComponentBenchmarks },
+        { "archetype", benchmarks::RunArchetypeBenchmarks },
+        { "hierarchy", benchmarks::RunHierarchyBenchmarks },
+        { "names", benchmarks::RunNameBenchmarks },
+        { "destruction", benchmarks::RunDestructionBenchmarks },
+        { "systems", benchmarks::RunSystemBenchmarks },
+        { "jobs", benchmarks::RunJobBenchmarks },
+        { "traversal", benchmarks::RunTraversalBenchmarks },
+        { "transform", benchmarks::RunTransformBenchmarks },
+        { "simd", benchmarks::RunSimdBenchmarks },
+        { "math", benchmarks::RunMathBenchmarks },
+        { "quantize", benchmarks::RunQuantizationBenchmarks },
+        { "spatial", benchmarks::RunSpatialBenchmarks },
+        { "culling", benchmarks::RunCullingBenchmarks },
+        { "pipeline", benchmarks::RunPipelineBenchmarks },
+    };
+
+    void PrintUsage()
+    {
+        printf("usage: engine_benchmarks [--suite name]... [--json path] [--baseline path] [--threshold percent]\n");
+        printf("  --suite      only run the named suites:");
+        for (const Suite& suite : SUITES)
+        {
+            printf(" %s", suite.m_name);
+        }
+        printf("\n");
+        printf("  --json       write the results to path\n");
+        printf("  --baseline   compare the results with a file written by --json, exits with 1 on regressions\n");
+        printf("  --threshold  slowdown reported as a regression, 10%% by default\n");
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* jsonPath     = nullptr;
+    const char* baselinePath = nullptr;
+    double      threshold    = Constants::DEFAULT_REGRESSION_THRESHOLD;
+    bool        runAll       = true;
+    bool        selected[ std::size(SUITES) ] {};
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(argv[ i ], "--json") == 0 && hasValue)
+        {
+            jsonPath = argv[ ++i ];
+        }
+        else if (std::strcmp(argv[ i ], "--baseline") == 0 && hasValue)
+        {
+            baselinePath = argv[ ++i ];
+        }
+        else if (std::strcmp(argv[ i ], "--threshold") == 0 && hasValue)
+        {
+            threshold = std::atof(argv[ ++i ]) / 100.0;
+        }
+        else if (std::strcmp(argv[ i ], "--suite") == 0 && hasValue)
+        {
+            const char* name  = argv[ ++i ];
+            bool        found = false;
+
+            for (size_t j = 0; j < std::size(SUITES); j++)
+            {
+                if (std::strcmp(SUITES[ j ].m_name, name) == 0)
+                {
+                    selected[ j ] = true;
+                    found         = true;
+                }
+            }
+
+            if (!found)
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            runAll = false;
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    shared::Log("Running engine benchmarks");
+
+    for (size_t i = 0; i < std::size(SUITES); i++)
+    {
+        if (runAll || selected[ i ])
+        {
+            SUITES[ i ].m_run();
+        }
+    }
+
+    try
+    {
+        if (jsonPath != nullptr)
+        {
+            benchmarks::WriteJson(jsonPath);
+        }
+
+        if (baselinePath != nullptr && benchmarks::CompareWithBaseline(baselinePath, threshold) > 0)
+        {
+            return 1;
+        }
+    }
+    catch (const std::runtime_error& error)
+    {
+        shared::Log(error.what());
+        return 1;
+    }
+
+    if (benchmarks::GetFailureCount() > 0)
+    {
+        shared::Log("Benchmark correctness checks failed");
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,219 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include <engine/transformation/rotation.hpp>
+#include <engine/transformation/transformation.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        // from cache resident to well past the last level cache
+        static constexpr size_t BATCH_SIZES[]         = { 16, 1024, 65536 };
+        static constexpr size_t OPERATIONS_PER_SAMPLE = 1 << 17; // small batches are repeated up to this
+        static constexpr size_t DRIFT_CHAIN_LENGTH    = 1000000;
+    };
+
+    struct Inputs
+    {
+        std::vector<engine::Rotation>       m_rotations;
+        std::vector<engine::Rotation>       m_otherRotations;
+        std::vector<engine::Transformation> m_transformations;
+        std::vector<engine::Transformation> m_otherTransformations;
+        std::vector<glm::vec3>              m_directions;
+        std::vector<glm::vec3>              m_points;
+        std::vector<float>                  m_factors;
+    };
+
+    glm::vec3 RandomVector(benchmarks::Random& random, float min, float max)
+    {
+        return glm::vec3 { random.NextFloat(min, max), random.NextFloat(min, max), random.NextFloat(min, max) };
+    }
+
+    engine::Rotation RandomRotation(benchmarks::Random& random)
+    {
+        return engine::Rotation { glm::quat { random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f) } };
+    }
+
+    engine::Transformation RandomTransformation(benchmarks::Random& random)
+    {
+        return engine::Transformation { RandomVector(random, -100.0f, 100.0f), RandomRotation(random), RandomVector(random, 0.5f, 2.0f) };
+    }
+
+    Inputs CreateInputs(size_t count)
+    {
+        benchmarks::Random random;
+        Inputs             inputs;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            // kept away from the up vector, where a forward/up basis is undefined
+            glm::vec3 direction = RandomVector(random, -1.0f, 1.0f);
+            direction.y         = direction.y * 0.5f;
+            direction.x         = direction.x < 0.0f ? direction.x - 0.5f : direction.x + 0.5f;
+
+            inputs.m_rotations.push_back(RandomRotation(random));
+            inputs.m_otherRotations.push_back(RandomRotation(random));
+            inputs.m_transformations.push_back(RandomTransformation(random));
+            inputs.m_otherTransformations.push_back(RandomTransformation(random));
+            inputs.m_directions.push_back(direction);
+            inputs.m_points.push_back(RandomVector(random, -100.0f, 100.0f));
+            inputs.m_factors.push_back(random.NextFloat(0.0f, 1.0f));
+        }
+
+        return inputs;
+    }
+
+    // calls func(i) for every element of the batch, repeating the batch until the sample is
+    // long enough to be timed
+    template <typename Func>
+    void MeasureBatch(const char* name, size_t batchSize, Func&& func)
+    {
+        size_t passes = Constants::OPERATIONS_PER_SAMPLE / batchSize;
+        if (passes == 0)
+        {
+            passes = 1;
+        }
+
+        double time = benchmarks::Measure(passes * batchSize,
+            [ & ]()
+            {
+                for (size_t pass = 0; pass < passes; pass++)
+                {
+                    for (size_t i = 0; i < batchSize; i++)
+                    {
+                        func(i);
+                    }
+                }
+            });
+
+        benchmarks::Report("math", name, batchSize, time);
+    }
+} // namespace
+
+void benchmarks::RunMathBenchmarks()
+{
+    for (size_t batchSize : Constants::BATCH_SIZES)
+    {
+        Inputs inputs = CreateInputs(batchSize);
+
+        std::vector<engine::Rotation>       rotations(batchSize);
+        std::vector<engine::Transformation> transformations(batchSize);
+        std::vector<glm::vec3>              vectors(batchSize);
+        std::vector<glm::mat4>              matrices(batchSize);
+
+        MeasureBatch("Rotation(forward, up)", batchSize,
+            [ & ](size_t i)
+            {
+                rotations[ i ] = engine::Rotation { inputs.m_directions[ i ] };
+            });
+
+        MeasureBatch("Rotation::operator*", batchSize,
+            [ & ](size_t i)
+            {
+                rotations[ i ] = inputs.m_rotations[ i ] * inputs.m_otherRotations[ i ];
+            });
+
+        engine::Rotation::SetNormalizationMode(engine::Rotation::NormalizationMode::OnDrift);
+
+        MeasureBatch("Rotation::operator* (on drift)", batchSize,
+            [ & ](size_t i)
+            {
+                rotations[ i ] = inputs.m_rotations[ i ] * inputs.m_otherRotations[ i ];
+            });
+
+        MeasureBatch("Transformation::operator* (on drift)", batchSize,
+            [ & ](size_t i)
+            {
+                transformations[ i ] = inputs.m_transformations[ i ] * inputs.m_otherTransformations[ i ];
+            });
+
+        engine::Rotation::SetNormalizationMode(engine::Rotation::NormalizationMode::Always);
+
+        MeasureBatch("Rotation::Slerp", batchSize,
+            [ & ](size_t i)
+            {
+                rotations[ i ] = engine::Rotation::Slerp(inputs.m_rotations[ i ], inputs.m_otherRotations[ i ], inputs.m_factors[ i ]);
+            });
+
+        MeasureBatch("Rotation::RotateAroundAxis", batchSize,
+            [ & ](size_t i)
+            {
+                engine::Rotation rotation = inputs.m_rotations[ i ];
+                rotation.RotateAroundAxis(inputs.m_factors[ i ], inputs.m_directions[ i ]);
+                rotations[ i ] = rotation;
+            });
+
+        MeasureBatch("Rotation::GetEulerAngles", batchSize,
+            [ & ](size_t i)
+            {
+                vectors[ i ] = inputs.m_rotations[ i ].GetEulerAngles();
+            });
+
+        MeasureBatch("Transformation::operator*", batchSize,
+            [ & ](size_t i)
+            {
+                transformations[ i ] = inputs.m_transformations[ i ] * inputs.m_otherTransformations[ i ];
+            });
+
+        MeasureBatch("Transformation::GetInverse", batchSize,
+            [ & ](size_t i)
+            {
+                transformations[ i ] = inputs.m_transformations[ i ].GetInverse();
+            });
+
+        MeasureBatch("Transformation::InverseConcatenate", batchSize,
+            [ & ](size_t i)
+            {
+                transformations[ i ] = inputs.m_transformations[ i ].InverseConcatenate(inputs.m_otherTransformations[ i ]);
+            });
+
+        MeasureBatch("Transformation::Lerp", batchSize,
+            [ & ](size_t i)
+            {
+                transformations[ i ] = engine::Transformation::Lerp(inputs.m_transformations[ i ], inputs.m_otherTransformations[ i ], inputs.m_factors[ i ]);
+            });
+
+        MeasureBatch("Transformation::GetMatrix", batchSize,
+            [ & ](size_t i)
+            {
+                matrices[ i ] = inputs.m_transformations[ i ].GetMatrix();
+            });
+
+        MeasureBatch("Transformation::LookAt", batchSize,
+            [ & ](size_t i)
+            {
+                engine::Transformation transformation = inputs.m_transformations[ i ];
+                transformation.LookAt(inputs.m_points[ i ]);
+                transformations[ i ] = transformation;
+            });
+
+        benchmarks::DoNotOptimize(rotations.back());
+        benchmarks::DoNotOptimize(transformations.back());
+        benchmarks::DoNotOptimize(vectors.back());
+        benchmarks::DoNotOptimize(matrices.back());
+    }
+
+    // a long chain of compositions must stay unit length when normalizing only on drift
+    benchmarks::Random random;
+    engine::Rotation   step { glm::angleAxis(0.001f, glm::normalize(RandomVector(random, 0.1f, 1.0f))) };
+    engine::Rotation   chain {};
+    float              worst = 0.0f;
+
+    engine::Rotation::SetNormalizationMode(engine::Rotation::NormalizationMode::OnDrift);
+
+    for (size_t i = 0; i < Constants::DRIFT_CHAIN_LENGTH; i++)
+    {
+        chain *= step;
+
+        glm::quat quaternion = chain.GetQuaternion();
+        worst                = std::fmax(worst, std::fabs(std::sqrt(glm::dot(quaternion, quaternion)) - 1.0f));
+    }
+
+    engine::Rotation::SetNormalizationMode(engine::Rotation::NormalizationMode::Always);
+
+    printf("%-12s %zu compositions on drift, worst length error %.2e\n", "math", Constants::DRIFT_CHAIN_LENGTH, static_cast<double>(worst));
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <string>
+#include <vector>
+
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t OBJECT_COUNT = 100000;
+        static constexpr size_t NAME_COUNT   = 1000;
+    };
+} // namespace
+
+void benchmarks::RunNameBenchmarks()
+{
+    engine::GameObjectManager& manager = engine::GameObjectManager::GetInstance();
+
+    std::vector<std::string> names;
+    names.reserve(Constants::NAME_COUNT);
+
+    for (size_t i = 0; i < Constants::NAME_COUNT; i++)
+    {
+        names.push_back("Object " + std::to_string(i));
+    }
+
+    // a flat level with a few deep branches
+    engine::GameObject* root = manager.CreateGameObject("Level");
+    engine::GameObject* node = root;
+
+    for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+    {
+        const std::string& name = names[ i % names.size() ];
+        node                    = (i % 8 == 0) ? root->CreateChild(name) : node->CreateChild(name);
+    }
+
+    benchmarks::Random random;
+
+    double find = benchmarks::Measure(names.size(),
+        [ & ]()
+        {
+            for (size_t i = 0; i < names.size(); i++)
+            {
+                const std::string& name = names[ random.Next() % names.size() ];
+                benchmarks::DoNotOptimize(manager.FindGameObjectByName(name.c_str()));
+            }
+        });
+
+    double findAll = benchmarks::Measure(names.size(),
+        [ & ]()
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < names.size(); i++)
+            {
+                const std::string& name = names[ random.Next() % names.size() ];
+                count += manager.FindAllGameObjectsWithName(name.c_str()).size();
+            }
+
+            benchmarks::DoNotOptimize(count);
+        });
+
+    double rename = benchmarks::Measure(names.size(),
+        [ & ]()
+        {
+            engine::GameObject* object = root->GetFirstChild();
+            for (size_t i = 0; i < names.size() && object != nullptr; i++)
+            {
+                object->SetName(names[ random.Next() % names.size() ]);
+                object = object->GetNextSibling();
+            }
+        });
+
+    benchmarks::Report("names", "FindGameObjectByName", find);
+    benchmarks::Report("names", "FindAllGameObjectsWithName", findAll);
+    benchmarks::Report("names", "SetName", rename);
+
+    manager.DestroyGameObject(root);
+    manager.Update();
+}
\ No newline at end of file
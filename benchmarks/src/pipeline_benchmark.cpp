@@ -0,0 +1,138 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <engine/render/render_pipeline.hpp>
+#include <engine/render/render_snapshot.hpp>
+#include <engine/render/renderer.hpp>
+#include <engine/timing/frame_pacer.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t   OBJECT_COUNT    = 10000;
+        static constexpr float    WORLD_EXTENT    = 200.0f;
+        static constexpr size_t   FRAME_COUNT     = 30;
+        static constexpr uint64_t SIMULATION_TIME = 2000000; // nanoseconds of work per frame
+        static constexpr uint64_t PRESENT_TIME    = 2000000; // nanoseconds blocked in the swap
+    };
+
+    void SimulateWork(uint64_t duration)
+    {
+        uint64_t end = engine::GetClockTime() + duration;
+        while (engine::GetClockTime() < end)
+        {
+        }
+    }
+
+    void CaptureFrame(engine::RenderSnapshot& snapshot, const engine::TransformationArrays& transformations, const std::vector<float>& radii, const glm::mat4& viewProjection)
+    {
+        snapshot.SetCamera(viewProjection);
+
+        uint32_t first = snapshot.AddTransformations(transformations, radii.data());
+        for (size_t i = 0; i < transformations.m_count; i++)
+        {
+            uint32_t index = first + static_cast<uint32_t>(i);
+            snapshot.AddDrawPacket(engine::DrawPacket { index % 64, index, index % 16, index % 64 });
+        }
+    }
+} // namespace
+
+void benchmarks::RunPipelineBenchmarks()
+{
+    benchmarks::Random random;
+
+    engine::TransformationBuffer transformations;
+    std::vector<float>           radii;
+
+    transformations.Resize(Constants::OBJECT_COUNT);
+    for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+    {
+        glm::vec3 position {
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+        };
+
+        transformations.Set(i, engine::Transformation { position, engine::Rotation {}, glm::vec3 { 1.0f } });
+        radii.push_back(random.NextFloat(0.5f, 2.0f));
+    }
+
+    engine::TransformationArrays arrays = transformations.GetArrays();
+
+    glm::mat4 projection     = glm::perspective(1.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+    glm::mat4 view           = glm::lookAt(glm::vec3 { 0.0f }, glm::vec3 { 0.0f, 0.0f, -1.0f }, glm::vec3 { 0.0f, 1.0f, 0.0f });
+    glm::mat4 viewProjection = projection * view;
+
+    // the part of a frame left on the simulation thread, and the part moved to the render thread
+    engine::RenderSnapshot snapshot;
+
+    double capture = benchmarks::Measure(Constants::OBJECT_COUNT,
+        [ & ]()
+        {
+            snapshot.Clear();
+            CaptureFrame(snapshot, arrays, radii, viewProjection);
+        });
+
+    double prepare = benchmarks::MeasureWithSetup(Constants::OBJECT_COUNT,
+        [ & ]()
+        {
+            snapshot.Clear();
+            CaptureFrame(snapshot, arrays, radii, viewProjection);
+        },
+        [ & ]()
+        {
+            snapshot.Prepare();
+            benchmarks::DoNotOptimize(snapshot.GetDrawPackets().size());
+        });
+
+    benchmarks::Report("pipeline", "capture snapshot, per object", capture);
+    benchmarks::Report("pipeline", "prepare snapshot, per object", prepare);
+    printf("%-12s %zu of %zu objects visible\n", "pipeline", snapshot.GetVisibleIndices().size(), snapshot.GetTransformationCount());
+
+    // the same frames, with the submission and the swap after the simulation on one thread,
+    // then overlapped with the next frame on the render thread
+    engine::NullRenderer renderer;
+    renderer.SetPresentTime(Constants::PRESENT_TIME);
+
+    double serial = benchmarks::Measure(Constants::FRAME_COUNT,
+        [ & ]()
+        {
+            for (size_t i = 0; i < Constants::FRAME_COUNT; i++)
+            {
+                SimulateWork(Constants::SIMULATION_TIME);
+
+                snapshot.Clear();
+                CaptureFrame(snapshot, arrays, radii, viewProjection);
+                snapshot.Prepare();
+
+                renderer.Render(snapshot);
+                renderer.Present();
+            }
+        });
+
+    engine::RenderPipeline pipeline;
+
+    double pipelined = benchmarks::Measure(Constants::FRAME_COUNT,
+        [ & ]()
+        {
+            pipeline.Start(renderer);
+
+            for (size_t i = 0; i < Constants::FRAME_COUNT; i++)
+            {
+                SimulateWork(Constants::SIMULATION_TIME);
+
+                CaptureFrame(pipeline.BeginFrame(), arrays, radii, viewProjection);
+                pipeline.EndFrame();
+            }
+
+            pipeline.Stop();
+        });
+
+    benchmarks::Report("pipeline", "serial frame", serial);
+    benchmarks::Report("pipeline", "pipelined frame", pipelined);
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <vector>
+
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+#include <engine/memory/memory_manager.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t OBJECT_COUNT = 20000;
+        static constexpr size_t CHURN_ROUNDS = 10;
+    };
+
+    // roughly the size of a game object
+    struct Payload
+    {
+        float  m_values[ 24 ];
+        size_t m_id;
+    };
+
+    struct HeapPolicy
+    {
+        static Payload* New(size_t id)
+        {
+            return new Payload { {}, id };
+        }
+
+        static void Delete(Payload* payload)
+        {
+            delete payload;
+        }
+    };
+
+    struct PoolPolicy
+    {
+        static Payload* New(size_t id)
+        {
+            return engine::MemoryManager::GetInstance().New<Payload>(Payload { {}, id });
+        }
+
+        static void Delete(Payload* payload)
+        {
+            engine::MemoryManager::GetInstance().Delete(payload);
+        }
+    };
+
+    // spawns a full set of objects, then repeatedly despawns and respawns random halves of it
+    template <typename Policy>
+    void Churn(std::vector<Payload*>& objects)
+    {
+        benchmarks::Random random {};
+
+        for (size_t i = 0; i < objects.size(); i++)
+        {
+            objects[ i ] = Policy::New(i);
+        }
+
+        for (size_t round = 0; round < Constants::CHURN_ROUNDS; round++)
+        {
+            for (size_t i = 0; i < objects.size() / 2; i++)
+            {
+                size_t index = static_cast<size_t>(random.Next() % objects.size());
+                Policy::Delete(objects[ index ]);
+                objects[ index ] = Policy::New(index);
+            }
+        }
+    }
+
+    template <typename Policy>
+    void Release(std::vector<Payload*>& objects)
+    {
+        for (Payload* object : objects)
+        {
+            Policy::Delete(object);
+        }
+    }
+
+    float Touch(const std::vector<Payload*>& objects)
+    {
+        float sum = 0.0f;
+        for (const Payload* object : objects)
+        {
+            sum += object->m_values[ 0 ] + static_cast<float>(object->m_id);
+        }
+
+        return sum;
+    }
+
+    template <typename Policy>
+    void RunPolicy(const char* name)
+    {
+        constexpr size_t CHURN_OPERATIONS = Constants::OBJECT_COUNT + Constants::CHURN_ROUNDS * Constants::OBJECT_COUNT;
+
+        std::vector<Payload*> objects(Constants::OBJECT_COUNT, nullptr);
+
+        double churn = benchmarks::Measure(CHURN_OPERATIONS,
+            [ & ]()
+            {
+                Churn<Policy>(objects);
+                Release<Policy>(objects);
+            });
+
+        // iterate over a fragmented set of objects
+        Churn<Policy>(objects);
+        double touch = benchmarks::Measure(objects.size(), [ & ]() { benchmarks::DoNotOptimize(Touch(objects)); });
+        Release<Policy>(objects);
+
+        char label[ 64 ];
+        snprintf(label, sizeof(label), "%s alloc/free churn", name);
+        benchmarks::Report("pool", label, churn);
+
+        snprintf(label, sizeof(label), "%s iterate after churn", name);
+        benchmarks::Report("pool", label, touch);
+    }
+
+    void RunGameObjects()
+    {
+        engine::GameObjectManager& manager = engine::GameObjectManager::GetInstance();
+
+        double spawn = benchmarks::Measure(Constants::OBJECT_COUNT,
+            [ & ]()
+            {
+                for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+                {
+                    manager.DestroyGameObject(manager.CreateGameObject("Benchmark"));
+                }
+
+                manager.Update();
+            });
+
+        benchmarks::Report("pool", "game object spawn/despawn", spawn);
+    }
+} // namespace
+
+void benchmarks::RunPoolBenchmarks()
+{
+    RunPolicy<HeapPolicy>("heap");
+    RunPolicy<PoolPolicy>("pool");
+    RunGameObjects();
+
+    engine::MemoryManager::GetInstance().ForEachPool(
+        [](const engine::PoolAllocator& pool)
+        {
+            engine::PoolStats stats = pool.GetStats();
+            printf("pool stats   %-40s %zu/%zu slots live (peak %zu), %zu slabs\n", stats.m_name, stats.m_liveCount, stats.m_capacity, stats.m_peakLiveCount, stats.m_slabCount);
+        });
+}
\ No newline at end of file
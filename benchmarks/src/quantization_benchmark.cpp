@@ -0,0 +1,148 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include <engine/simd/cpu_features.hpp>
+#include <engine/transformation/quantized_transformation.hpp>
+#include <engine/transformation/transformation_batch.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t TRANSFORMATION_COUNT = 50003; // not a multiple of the simd width, so the scalar tail is checked
+        static constexpr float  WORLD_EXTENT         = 1000.0f;
+    };
+
+    struct Format
+    {
+        const char*               m_name;
+        const char*               m_description;
+        engine::RotationPrecision m_rotationPrecision;
+        bool                      m_isUniformScale;
+    };
+
+    constexpr Format FORMATS[] = {
+        { "rotation32 uniform", "32 bit rotation, uniform scale", engine::RotationPrecision::Bits32, true },
+        { "rotation48", "48 bit rotation", engine::RotationPrecision::Bits48, false },
+    };
+
+    // a quaternion and its negation are the same rotation
+    float GetRotationError(const glm::quat& expected, const glm::quat& actual)
+    {
+        float same    = 0.0f;
+        float negated = 0.0f;
+
+        for (int i = 0; i < 4; i++)
+        {
+            same    = std::fmax(same, std::fabs(expected[ i ] - actual[ i ]));
+            negated = std::fmax(negated, std::fabs(expected[ i ] + actual[ i ]));
+        }
+
+        return std::fmin(same, negated);
+    }
+
+    // largest error of every kind, as a fraction of the bound the buffer promises
+    float CheckErrorBounds(const engine::QuantizedTransformationBuffer& buffer, const engine::TransformationBuffer& original, const engine::TransformationBuffer& decoded)
+    {
+        glm::vec3 positionBound = buffer.GetMaxPositionError();
+        float     worst         = 0.0f;
+
+        for (size_t i = 0; i < original.GetCount(); i++)
+        {
+            engine::Transformation expected = original.Get(i);
+            engine::Transformation actual   = decoded.Get(i);
+
+            for (int j = 0; j < 3; j++)
+            {
+                float scaleError = std::fabs(expected.m_scale[ j ] - actual.m_scale[ j ]) / std::fabs(expected.m_scale[ j ]);
+
+                worst = std::fmax(worst, std::fabs(expected.m_position[ j ] - actual.m_position[ j ]) / positionBound[ j ]);
+                worst = std::fmax(worst, scaleError / buffer.GetMaxScaleRelativeError());
+            }
+
+            float rotationError = GetRotationError(expected.m_rotation.GetQuaternion(), actual.m_rotation.GetQuaternion());
+            worst               = std::fmax(worst, rotationError / buffer.GetMaxRotationComponentError());
+        }
+
+        return worst;
+    }
+} // namespace
+
+void benchmarks::RunQuantizationBenchmarks()
+{
+    benchmarks::Random random;
+
+    engine::TransformationBuffer original;
+    engine::TransformationBuffer decoded;
+    original.Resize(Constants::TRANSFORMATION_COUNT);
+    decoded.Resize(Constants::TRANSFORMATION_COUNT);
+
+    for (size_t i = 0; i < Constants::TRANSFORMATION_COUNT; i++)
+    {
+        float     extent = Constants::WORLD_EXTENT;
+        glm::vec3 position { random.NextFloat(-extent, extent), random.NextFloat(-extent, extent), random.NextFloat(-extent, extent) };
+        glm::quat rotation { random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f) };
+        float     scale = random.NextFloat(0.25f, 4.0f);
+
+        original.Set(i, engine::Transformation { position, engine::Rotation { rotation }, glm::vec3 { scale } });
+    }
+
+    engine::TransformationArrays originalArrays = original.GetArrays();
+    engine::TransformationArrays decodedArrays  = decoded.GetArrays();
+
+    engine::SimdLevel best = engine::GetSimdLevel();
+
+    for (const Format& format : FORMATS)
+    {
+        engine::QuantizationSettings settings {
+            engine::QuantizationBounds { glm::vec3 { -Constants::WORLD_EXTENT }, glm::vec3 { Constants::WORLD_EXTENT } },
+            format.m_rotationPrecision,
+            format.m_isUniformScale
+        };
+
+        engine::QuantizedTransformationBuffer buffer { settings };
+
+        for (engine::SimdLevel level : { engine::SimdLevel::Scalar, best })
+        {
+            engine::SetSimdLevel(level);
+
+            char name[ 96 ];
+
+            double encode = benchmarks::Measure(Constants::TRANSFORMATION_COUNT,
+                [ & ]()
+                {
+                    buffer.Encode(originalArrays);
+                });
+
+            double decode = benchmarks::Measure(Constants::TRANSFORMATION_COUNT,
+                [ & ]()
+                {
+                    buffer.Decode(decodedArrays);
+                    benchmarks::DoNotOptimize(decodedArrays.m_positionX[ 0 ]);
+                });
+
+            snprintf(name, sizeof(name), "encode %s (%s)", format.m_name, engine::GetSimdLevelName(level));
+            benchmarks::Report("quantize", name, encode);
+
+            snprintf(name, sizeof(name), "decode %s (%s)", format.m_name, engine::GetSimdLevelName(level));
+            benchmarks::Report("quantize", name, decode);
+
+            float worst = CheckErrorBounds(buffer, original, decoded);
+            printf("%-12s %-40s %9.1f%% of the error bounds, %s\n", "quantize", "worst error", static_cast<double>(worst) * 100.0, worst <= 1.0f ? "ok" : "EXCEEDED");
+
+            if (worst > 1.0f)
+            {
+                snprintf(name, sizeof(name), "%s (%s) decoded outside the error bounds", format.m_name, engine::GetSimdLevelName(level));
+                benchmarks::ReportFailure("quantize", name);
+            }
+        }
+
+        double bytes = static_cast<double>(buffer.GetSizeInBytes()) / static_cast<double>(buffer.GetCount());
+        printf("%-12s %-40s %10.1f bytes per transformation, %.1fx smaller\n", "quantize", format.m_description, bytes, static_cast<double>(sizeof(engine::Transformation)) / bytes);
+    }
+
+    engine::SetSimdLevel(best);
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include <engine/simd/cpu_features.hpp>
+#include <engine/transformation/transformation.hpp>
+#include <engine/transformation/transformation_batch.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t TRANSFORMATION_COUNT = 50000;
+        static constexpr float  TOLERANCE            = 1e-4f; // the kernels reorder float operations
+        static constexpr float  ALPHA                = 0.3f;
+    };
+
+    // reference for the batch interpolation: lerp, and nlerp along the shortest arc
+    engine::Transformation Interpolate(const engine::Transformation& previous, const engine::Transformation& current, float alpha)
+    {
+        glm::quat a = previous.m_rotation.GetQuaternion();
+        glm::quat b = current.m_rotation.GetQuaternion();
+
+        float     sign = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w < 0.0f ? -1.0f : 1.0f;
+        glm::quat rotation { a.w + (b.w * sign - a.w) * alpha, a.x + (b.x * sign - a.x) * alpha, a.y + (b.y * sign - a.y) * alpha, a.z + (b.z * sign - a.z) * alpha };
+
+        glm::vec3 position = previous.m_position + (current.m_position - previous.m_position) * alpha;
+        glm::vec3 scale    = previous.m_scale + (current.m_scale - previous.m_scale) * alpha;
+
+        return engine::Transformation { position, engine::Rotation { rotation }, scale };
+    }
+
+    engine::Transformation RandomTransformation(benchmarks::Random& random)
+    {
+        glm::vec3 position { random.NextFloat(-100.0f, 100.0f), random.NextFloat(-100.0f, 100.0f), random.NextFloat(-100.0f, 100.0f) };
+        glm::quat rotation { random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f) };
+        glm::vec3 scale { random.NextFloat(0.5f, 2.0f), random.NextFloat(0.5f, 2.0f), random.NextFloat(0.5f, 2.0f) };
+
+        return engine::Transformation { position, engine::Rotation { rotation }, scale };
+    }
+
+    // largest difference relative to the magnitude of the expected value
+    float Error(float expected, float actual)
+    {
+        return std::fabs(expected - actual) / std::fmax(1.0f, std::fabs(expected));
+    }
+
+    float CompareTransformations(const std::vector<engine::Transformation>& expected, const engine::TransformationBuffer& actual)
+    {
+        float error = 0.0f;
+
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            engine::Transformation transformation = actual.Get(i);
+            glm::quat              a              = expected[ i ].m_rotation.GetQuaternion();
+            glm::quat              b              = transformation.m_rotation.GetQuaternion();
+
+            for (int j = 0; j < 3; j++)
+            {
+                error = std::fmax(error, Error(expected[ i ].m_position[ j ], transformation.m_position[ j ]));
+                error = std::fmax(error, Error(expected[ i ].m_scale[ j ], transformation.m_scale[ j ]));
+            }
+
+            for (int j = 0; j < 4; j++)
+            {
+                error = std::fmax(error, Error(a[ j ], b[ j ]));
+            }
+        }
+
+        return error;
+    }
+
+    float CompareMatrices(const std::vector<glm::mat4>& expected, const std::vector<glm::mat4>& actual)
+    {
+        float error = 0.0f;
+
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            for (int column = 0; column < 4; column++)
+            {
+                for (int row = 0; row < 4; row++)
+                {
+                    error = std::fmax(error, Error(expected[ i ][ column ][ row ], actual[ i ][ column ][ row ]));
+                }
+            }
+        }
+
+        return error;
+    }
+
+    void ReportError(const char* name, float error)
+    {
+        printf("%-12s %-40s %10.2e %s\n", "simd", name, static_cast<double>(error), error <= Constants::TOLERANCE ? "ok" : "MISMATCH");
+    }
+} // namespace
+
+void benchmarks::RunSimdBenchmarks()
+{
+    benchmarks::Random random;
+
+    std::vector<engine::Transformation> parents;
+    std::vector<engine::Transformation> locals;
+    std::vector<engine::Transformation> worlds(Constants::TRANSFORMATION_COUNT);
+    std::vector<glm::mat4>              matrices(Constants::TRANSFORMATION_COUNT);
+    std::vector<engine::Transformation> interpolated;
+
+    engine::TransformationBuffer parentBuffer;
+    engine::TransformationBuffer localBuffer;
+    engine::TransformationBuffer worldBuffer;
+    std::vector<glm::mat4>       batchMatrices(Constants::TRANSFORMATION_COUNT);
+
+    parentBuffer.Resize(Constants::TRANSFORMATION_COUNT);
+    localBuffer.Resize(Constants::TRANSFORMATION_COUNT);
+    worldBuffer.Resize(Constants::TRANSFORMATION_COUNT);
+
+    for (size_t i = 0; i < Constants::TRANSFORMATION_COUNT; i++)
+    {
+        parents.push_back(RandomTransformation(random));
+        locals.push_back(RandomTransformation(random));
+
+        parentBuffer.Set(i, parents.back());
+        localBuffer.Set(i, locals.back());
+        interpolated.push_back(Interpolate(parents.back(), locals.back(), Constants::ALPHA));
+    }
+
+    double concatenate = benchmarks::Measure(Constants::TRANSFORMATION_COUNT,
+        [ & ]()
+        {
+            for (size_t i = 0; i < Constants::TRANSFORMATION_COUNT; i++)
+            {
+                worlds[ i ] = parents[ i ] * locals[ i ];
+            }
+
+            benchmarks::DoNotOptimize(worlds.back());
+        });
+
+    double matrix = benchmarks::Measure(Constants::TRANSFORMATION_COUNT,
+        [ & ]()
+        {
+            for (size_t i = 0; i < Constants::TRANSFORMATION_COUNT; i++)
+            {
+                matrices[ i ] = worlds[ i ].GetMatrix();
+            }
+
+            benchmarks::DoNotOptimize(matrices.back());
+        });
+
+    benchmarks::Report("simd", "Transformation::operator*, per element", concatenate);
+    benchmarks::Report("simd", "Transformation::GetMatrix, per element", matrix);
+
+    engine::TransformationArrays parentArrays = parentBuffer.GetArrays();
+    engine::TransformationArrays localArrays  = localBuffer.GetArrays();
+    engine::TransformationArrays worldArrays  = worldBuffer.GetArrays();
+
+    engine::SimdLevel best = engine::GetSimdLevel();
+
+    for (size_t level = 0; level <= static_cast<size_t>(best); level++)
+    {
+        engine::SetSimdLevel(static_cast<engine::SimdLevel>(level));
+
+        const char* levelName = engine::GetSimdLevelName(engine::GetSimdLevel());
+        char        name[ 64 ];
+
+        double batchConcatenate = benchmarks::Measure(Constants::TRANSFORMATION_COUNT,
+            [ & ]()
+            {
+                engine::ConcatenateTransformations(parentArrays, localArrays, worldArrays);
+                benchmarks::DoNotOptimize(worldArrays.m_positionX[ 0 ]);
+            });
+
+        snprintf(name, sizeof(name), "batch concatenate (%s), per element", levelName);
+        benchmarks::Report("simd", name, batchConcatenate);
+
+        snprintf(name, sizeof(name), "batch concatenate (%s), max error", levelName);
+        ReportError(name, CompareTransformations(worlds, worldBuffer));
+
+        double batchMatrix = benchmarks::Measure(Constants::TRANSFORMATION_COUNT,
+            [ & ]()
+            {
+                engine::ComputeTransformationMatrices(worldArrays, batchMatrices.data());
+                benchmarks::DoNotOptimize(batchMatrices.back());
+            });
+
+        snprintf(name, sizeof(name), "batch matrices (%s), per element", levelName);
+        benchmarks::Report("simd", name, batchMatrix);
+
+        snprintf(name, sizeof(name), "batch matrices (%s), max error", levelName);
+        ReportError(name, CompareMatrices(matrices, batchMatrices));
+
+        double batchInterpolate = benchmarks::Measure(Constants::TRANSFORMATION_COUNT,
+            [ & ]()
+            {
+                engine::InterpolateTransformations(parentArrays, localArrays, Constants::ALPHA, worldArrays);
+                benchmarks::DoNotOptimize(worldArrays.m_positionX[ 0 ]);
+            });
+
+        snprintf(name, sizeof(name), "batch interpolate (%s), per element", levelName);
+        benchmarks::Report("simd", name, batchInterpolate);
+
+        snprintf(name, sizeof(name), "batch interpolate (%s), max error", levelName);
+        ReportError(name, CompareTransformations(interpolated, worldBuffer));
+    }
+
+    engine::SetSimdLevel(best);
+}
\ No newline at end of file
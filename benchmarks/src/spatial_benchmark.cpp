@@ -0,0 +1,244 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <engine/spatial/dynamic_aabb_tree.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t OBJECT_COUNT     = 100000;
+        static constexpr size_t QUERY_COUNT      = 1000;
+        static constexpr size_t NEAREST_COUNT    = 8;
+        static constexpr size_t MOVING_PER_FRAME = 20; // out of every 1000 objects
+        static constexpr float  WORLD_EXTENT     = 1000.0f;
+        static constexpr float  MAX_OBJECT_SIZE  = 4.0f;
+        static constexpr float  QUERY_RADIUS     = 20.0f;
+    };
+
+    glm::vec3 RandomPoint(benchmarks::Random& random)
+    {
+        return glm::vec3 {
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+            random.NextFloat(-Constants::WORLD_EXTENT, Constants::WORLD_EXTENT),
+        };
+    }
+
+    glm::vec3 RandomDirection(benchmarks::Random& random)
+    {
+        glm::vec3 direction { random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f) };
+        return glm::normalize(direction + glm::vec3 { 1e-3f });
+    }
+
+    engine::Aabb RandomBox(benchmarks::Random& random)
+    {
+        glm::vec3 extents { random.NextFloat(0.1f, Constants::MAX_OBJECT_SIZE) };
+        return engine::Aabb::FromCenterExtents(RandomPoint(random), extents);
+    }
+
+    // every query runs both against the tree and by testing every box, the counts must match
+    struct Queries
+    {
+        std::vector<engine::Aabb>   m_boxes;
+        std::vector<engine::Sphere> m_spheres;
+        std::vector<engine::Ray>    m_rays;
+        std::vector<glm::vec3>      m_points;
+    };
+
+    void RunQueries(const char* label, const engine::DynamicAabbTree& tree, const std::vector<engine::Aabb>& boxes, const Queries& queries, bool withBruteForce)
+    {
+        size_t overlapCount = 0;
+        size_t sphereCount  = 0;
+        char   name[ 64 ];
+
+        double overlap = benchmarks::Measure(Constants::QUERY_COUNT,
+            [ & ]()
+            {
+                overlapCount = 0;
+                for (const engine::Aabb& box : queries.m_boxes)
+                {
+                    tree.QueryOverlap(box,
+                        [ & ](engine::DynamicAabbTree::ProxyId)
+                        {
+                            overlapCount++;
+                        });
+                }
+            });
+
+        snprintf(name, sizeof(name), "%s aabb overlap", label);
+        benchmarks::Report("spatial", name, overlap);
+
+        double sphere = benchmarks::Measure(Constants::QUERY_COUNT,
+            [ & ]()
+            {
+                sphereCount = 0;
+                for (const engine::Sphere& query : queries.m_spheres)
+                {
+                    tree.QueryOverlap(query,
+                        [ & ](engine::DynamicAabbTree::ProxyId)
+                        {
+                            sphereCount++;
+                        });
+                }
+            });
+
+        snprintf(name, sizeof(name), "%s sphere overlap", label);
+        benchmarks::Report("spatial", name, sphere);
+        benchmarks::DoNotOptimize(sphereCount);
+
+        float  treeClosest = 0.0f;
+        double ray         = benchmarks::Measure(Constants::QUERY_COUNT,
+            [ & ]()
+            {
+                treeClosest = 0.0f;
+                for (const engine::Ray& query : queries.m_rays)
+                {
+                    float closest = query.m_maxDistance;
+                    tree.RayCast(query,
+                        [ & ](engine::DynamicAabbTree::ProxyId, float distance)
+                        {
+                            closest = std::min(closest, distance);
+                            return distance;
+                        });
+
+                    treeClosest += closest;
+                }
+            });
+
+        snprintf(name, sizeof(name), "%s ray cast closest", label);
+        benchmarks::Report("spatial", name, ray);
+
+        std::vector<engine::DynamicAabbTree::ProxyId> nearest;
+        double                                        knn = benchmarks::Measure(Constants::QUERY_COUNT,
+            [ & ]()
+            {
+                for (glm::vec3 point : queries.m_points)
+                {
+                    tree.FindNearest(point, Constants::NEAREST_COUNT, nearest);
+                    benchmarks::DoNotOptimize(nearest.data());
+                }
+            });
+
+        snprintf(name, sizeof(name), "%s %zu nearest", label, Constants::NEAREST_COUNT);
+        benchmarks::Report("spatial", name, knn);
+
+        if (withBruteForce == false)
+        {
+            return;
+        }
+
+        size_t bruteCount   = 0;
+        float  bruteClosest = 0.0f;
+        double brute        = benchmarks::Measure(Constants::QUERY_COUNT,
+            [ & ]()
+            {
+                bruteCount   = 0;
+                bruteClosest = 0.0f;
+                for (size_t i = 0; i < Constants::QUERY_COUNT; i++)
+                {
+                    for (const engine::Aabb& box : boxes)
+                    {
+                        bruteCount += box.Overlaps(queries.m_boxes[ i ]) ? 1 : 0;
+                    }
+
+                    const engine::Ray& query            = queries.m_rays[ i ];
+                    glm::vec3          inverseDirection = query.GetInverseDirection();
+                    float              closest          = query.m_maxDistance;
+                    for (const engine::Aabb& box : boxes)
+                    {
+                        float distance = 0.0f;
+                        if (query.Intersects(box, inverseDirection, closest, distance))
+                        {
+                            closest = distance;
+                        }
+                    }
+
+                    bruteClosest += closest;
+                }
+            });
+
+        benchmarks::Report("spatial", "brute force aabb overlap + ray cast", brute);
+
+        bool isSame = overlapCount == bruteCount && treeClosest == bruteClosest;
+        printf("%-12s %zu overlaps, tree and brute force agree: %s\n", "spatial", overlapCount, isSame ? "yes" : "no");
+    }
+} // namespace
+
+void benchmarks::RunSpatialBenchmarks()
+{
+    benchmarks::Random random;
+
+    std::vector<engine::Aabb> boxes;
+    boxes.reserve(Constants::OBJECT_COUNT);
+    for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+    {
+        boxes.push_back(RandomBox(random));
+    }
+
+    Queries queries;
+    for (size_t i = 0; i < Constants::QUERY_COUNT; i++)
+    {
+        queries.m_boxes.push_back(engine::Aabb::FromCenterExtents(RandomPoint(random), glm::vec3 { Constants::QUERY_RADIUS }));
+        queries.m_spheres.push_back(engine::Sphere { RandomPoint(random), Constants::QUERY_RADIUS });
+        queries.m_rays.push_back(engine::Ray { RandomPoint(random), RandomDirection(random), Constants::WORLD_EXTENT });
+        queries.m_points.push_back(RandomPoint(random));
+    }
+
+    engine::DynamicAabbTree                       tree;
+    std::vector<engine::DynamicAabbTree::ProxyId> proxies;
+
+    double insert = benchmarks::MeasureWithSetup(Constants::OBJECT_COUNT,
+        [ & ]()
+        {
+            tree.Clear();
+            proxies.clear();
+        },
+        [ & ]()
+        {
+            for (const engine::Aabb& box : boxes)
+            {
+                proxies.push_back(tree.CreateProxy(box, nullptr));
+            }
+        });
+
+    benchmarks::Report("spatial", "insert, per object", insert);
+    printf("%-12s incremental tree: height %d, area ratio %.1f\n", "spatial", tree.GetHeight(), static_cast<double>(tree.GetAreaRatio()));
+
+    RunQueries("incremental", tree, boxes, queries, true);
+
+    // small movements stay inside the enlarged bounds or refit in place, a few teleport
+    size_t movingCount = Constants::OBJECT_COUNT * Constants::MOVING_PER_FRAME / 1000;
+    double move        = benchmarks::Measure(movingCount,
+        [ & ]()
+        {
+            for (size_t i = 0; i < movingCount; i++)
+            {
+                size_t    index  = random.Next() % boxes.size();
+                glm::vec3 offset = glm::vec3 { random.NextFloat(-0.5f, 0.5f), random.NextFloat(-0.5f, 0.5f), random.NextFloat(-0.5f, 0.5f) };
+                if (i % 16 == 0)
+                {
+                    offset = offset * 100.0f;
+                }
+
+                boxes[ index ] = engine::Aabb { boxes[ index ].m_min + offset, boxes[ index ].m_max + offset };
+                tree.MoveProxy(proxies[ index ], boxes[ index ]);
+            }
+        });
+
+    benchmarks::Report("spatial", "move, per moving object", move);
+
+    double rebuild = benchmarks::Measure(Constants::OBJECT_COUNT,
+        [ & ]()
+        {
+            tree.Rebuild();
+        });
+
+    benchmarks::Report("spatial", "binned sah rebuild, per object", rebuild);
+    printf("%-12s rebuilt tree: height %d, area ratio %.1f\n", "spatial", tree.GetHeight(), static_cast<double>(tree.GetAreaRatio()));
+
+    RunQueries("rebuilt", tree, boxes, queries, false);
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <vector>
+
+#include <engine/game_object/component.hpp>
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+#include <engine/system/system_scheduler.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t OBJECT_COUNT = 20000;
+    };
+
+    // makes Update reachable from the benchmark, so it can be called object by object
+    struct UpdatableComponent : public engine::Component
+    {
+        float m_value = 1.0f;
+
+        void Update() override = 0;
+
+      protected:
+        void AddToSystem() override
+        {
+            engine::SystemScheduler::GetInstance().AddComponent(this);
+        }
+
+        void RemoveFromSystem() override
+        {
+            engine::SystemScheduler::GetInstance().RemoveComponent(this);
+        }
+    };
+
+    // a handful of types with different bodies, so the call target changes from one component to the next
+    template <int N>
+    struct DummyComponent : public UpdatableComponent
+    {
+        void Update() override
+        {
+            m_value = m_value * (1.0f + N * 0.001f) + static_cast<float>(N);
+        }
+    };
+} // namespace
+
+void benchmarks::RunSystemBenchmarks()
+{
+    engine::GameObjectManager& manager   = engine::GameObjectManager::GetInstance();
+    engine::SystemScheduler&   scheduler = engine::SystemScheduler::GetInstance();
+
+    std::vector<engine::GameObject*> objects;
+    std::vector<UpdatableComponent*> components; // in object order, what a per-object update visits
+    objects.reserve(Constants::OBJECT_COUNT);
+
+    for (size_t i = 0; i < Constants::OBJECT_COUNT; i++)
+    {
+        engine::GameObject* object = manager.CreateGameObject("Benchmark");
+        components.push_back(object->AddComponent<DummyComponent<0>>());
+        components.push_back(object->AddComponent<DummyComponent<1>>());
+        components.push_back(object->AddComponent<DummyComponent<2>>());
+        components.push_back(object->AddComponent<DummyComponent<3>>());
+        objects.push_back(object);
+    }
+
+    double perObject = benchmarks::Measure(components.size(),
+        [ & ]()
+        {
+            for (UpdatableComponent* component : components)
+            {
+                component->Update();
+            }
+        });
+
+    double batched = benchmarks::Measure(components.size(),
+        [ & ]()
+        {
+            scheduler.Update();
+        });
+
+    benchmarks::Report("systems", "per object virtual Update", perObject);
+    benchmarks::Report("systems", "scheduler, batched by type", batched);
+
+    for (engine::GameObject* object : objects)
+    {
+        manager.DestroyGameObject(object);
+    }
+
+    manager.Update();
+    scheduler.Shutdown();
+}
\ No newline at end of file
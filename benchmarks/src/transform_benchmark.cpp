@@ -0,0 +1,124 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <vector>
+
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+#include <engine/system/system_scheduler.hpp>
+#include <engine/transformation/transform_system.hpp>
+#include <engine/transformation/transformation_component.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t ROOT_COUNT       = 1000;
+        static constexpr size_t CHAIN_LENGTH     = 10;
+        static constexpr size_t CHAINS_PER_ROOT  = 10;
+        static constexpr size_t MOVING_PER_FRAME = 20; // out of every 1000 transformations
+    };
+} // namespace
+
+void benchmarks::RunTransformBenchmarks()
+{
+    engine::GameObjectManager& manager   = engine::GameObjectManager::GetInstance();
+    engine::SystemScheduler&   scheduler = engine::SystemScheduler::GetInstance();
+    engine::TransformSystem&   system    = scheduler.GetSystem<engine::TransformSystem>();
+
+    std::vector<engine::GameObject*>              roots;
+    std::vector<engine::TransformationComponent*> transformations;
+
+    for (size_t i = 0; i < Constants::ROOT_COUNT; i++)
+    {
+        engine::GameObject* root = manager.CreateGameObject("Root");
+        transformations.push_back(root->AddComponent<engine::TransformationComponent>());
+        roots.push_back(root);
+
+        for (size_t j = 0; j < Constants::CHAINS_PER_ROOT; j++)
+        {
+            engine::GameObject* node = root;
+            for (size_t k = 0; k < Constants::CHAIN_LENGTH; k++)
+            {
+                node = node->CreateChild("Node");
+
+                engine::TransformationComponent* transformation = node->AddComponent<engine::TransformationComponent>();
+                transformation->SetPosition(glm::vec3 { 0.0f, 1.0f, 0.0f });
+                transformations.push_back(transformation);
+            }
+        }
+    }
+
+    // builds the flattened hierarchy and computes every world transformation once
+    system.Update();
+
+    benchmarks::Random random;
+
+    double full = benchmarks::Measure(transformations.size(),
+        [ & ]()
+        {
+            for (engine::GameObject* root : roots)
+            {
+                root->GetComponent<engine::TransformationComponent>()->SetPosition(glm::vec3 { random.NextFloat(-1.0f, 1.0f), 0.0f, 0.0f });
+            }
+
+            system.Update();
+        });
+
+    size_t movingCount = transformations.size() * Constants::MOVING_PER_FRAME / 1000;
+    size_t updated     = 0;
+
+    double sparse = benchmarks::Measure(1,
+        [ & ]()
+        {
+            for (size_t i = 0; i < movingCount; i++)
+            {
+                engine::TransformationComponent* transformation = transformations[ random.Next() % transformations.size() ];
+                transformation->SetPosition(glm::vec3 { random.NextFloat(-1.0f, 1.0f), 1.0f, 0.0f });
+            }
+
+            system.Update();
+            updated = system.GetLastUpdatedCount();
+        });
+
+    // the same sparse frames, also recording the previous and current state of what moved
+    system.SetInterpolationEnabled(true);
+
+    double recording = benchmarks::Measure(1,
+        [ & ]()
+        {
+            for (size_t i = 0; i < movingCount; i++)
+            {
+                engine::TransformationComponent* transformation = transformations[ random.Next() % transformations.size() ];
+                transformation->SetPosition(glm::vec3 { random.NextFloat(-1.0f, 1.0f), 1.0f, 0.0f });
+            }
+
+            system.Update();
+        });
+
+    size_t moving = system.GetMovingComponents().size();
+
+    double interpolate = benchmarks::Measure(1,
+        [ & ]()
+        {
+            system.Interpolate(random.NextFloat(0.0f, 1.0f));
+            benchmarks::DoNotOptimize(system.GetPresentationArrays().m_positionX[ 0 ]);
+        });
+
+    system.SetInterpolationEnabled(false);
+
+    benchmarks::Report("transform", "full update, per transformation", full);
+    benchmarks::Report("transform", "2% moving, per frame", sparse);
+    benchmarks::Report("transform", "2% moving with interpolation, per frame", recording);
+    benchmarks::Report("transform", "interpolate 2% moving, per frame", interpolate);
+    printf("%-12s %zu of %zu transformations recomputed in the sparse frame\n", "transform", updated, transformations.size());
+    printf("%-12s %zu of %zu transformations interpolated\n", "transform", moving, transformations.size());
+
+    for (engine::GameObject* root : roots)
+    {
+        manager.DestroyGameObject(root);
+    }
+
+    manager.Update();
+    scheduler.Shutdown();
+}
\ No newline at end of file
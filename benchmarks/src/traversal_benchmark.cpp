@@ -0,0 +1,189 @@
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#include <atomic>
+#include <functional>
+#include <stack>
+#include <vector>
+
+#include <engine/game_object/game_object.hpp>
+#include <engine/game_object/game_object_manager.hpp>
+#include <engine/job/job_system.hpp>
+
+namespace
+{
+    struct Constants
+    {
+        static constexpr size_t ROOT_COUNT    = 64;
+        static constexpr size_t BRANCH_FACTOR = 4;
+        static constexpr size_t TREE_DEPTH    = 5; // 1365 objects per root
+    };
+
+    void Grow(engine::GameObject* object, size_t depth)
+    {
+        if (depth == 0)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < Constants::BRANCH_FACTOR; i++)
+        {
+            Grow(object->CreateChild("Node"), depth - 1);
+        }
+    }
+
+    // what the pre-order traversal used to do
+    void StdFunctionPreOrder(const std::vector<engine::GameObject*>& roots, const std::function<bool(engine::GameObject*)>& func)
+    {
+        std::stack<engine::GameObject*> stack;
+
+        for (size_t i = roots.size(); i > 0; i--)
+        {
+            stack.push(roots[ i - 1 ]);
+        }
+
+        while (stack.empty() == false)
+        {
+            engine::GameObject* current = stack.top();
+            stack.pop();
+
+            if (func(current) == false)
+            {
+                return;
+            }
+
+            for (engine::GameObject* child = current->GetLastChild(); child != nullptr; child = child->GetPreviousSibling())
+            {
+                stack.push(child);
+            }
+        }
+    }
+
+    // a bit of work per object, so the parallel traversal has something to split
+    size_t Work(const engine::GameObject* object)
+    {
+        size_t hash = reinterpret_cast<uintptr_t>(object);
+        for (int i = 0; i < 16; i++)
+        {
+            hash = hash * 6364136223846793005ull + 1442695040888963407ull;
+        }
+
+        return hash;
+    }
+} // namespace
+
+void benchmarks::RunTraversalBenchmarks()
+{
+    engine::GameObjectManager& manager = engine::GameObjectManager::GetInstance();
+    engine::JobSystem&         jobs    = engine::JobSystem::GetInstance();
+    jobs.Initialize();
+
+    std::vector<engine::GameObject*> roots;
+    for (size_t i = 0; i < Constants::ROOT_COUNT; i++)
+    {
+        engine::GameObject* root = manager.CreateGameObject("Root");
+        Grow(root, Constants::TREE_DEPTH);
+        roots.push_back(root);
+    }
+
+    size_t objectCount = 0;
+    manager.TraverseGameObjectsPreOrder(
+        [ & ](engine::GameObject*)
+        {
+            objectCount++;
+        });
+
+    double legacy = benchmarks::Measure(objectCount,
+        [ & ]()
+        {
+            size_t sum = 0;
+            StdFunctionPreOrder(roots,
+                [ & ](engine::GameObject* object)
+                {
+                    sum += reinterpret_cast<uintptr_t>(object);
+                    return true;
+                });
+
+            benchmarks::DoNotOptimize(sum);
+        });
+
+    double preOrder = benchmarks::Measure(objectCount,
+        [ & ]()
+        {
+            size_t sum = 0;
+            manager.TraverseGameObjectsPreOrder(
+                [ & ](engine::GameObject* object)
+                {
+                    sum += reinterpret_cast<uintptr_t>(object);
+                });
+
+            benchmarks::DoNotOptimize(sum);
+        });
+
+    double postOrder = benchmarks::Measure(objectCount,
+        [ & ]()
+        {
+            size_t sum = 0;
+            manager.TraverseGameObjectsPostOrder(
+                [ & ](engine::GameObject* object)
+                {
+                    sum += reinterpret_cast<uintptr_t>(object);
+                });
+
+            benchmarks::DoNotOptimize(sum);
+        });
+
+    double breadthFirst = benchmarks::Measure(objectCount,
+        [ & ]()
+        {
+            size_t sum = 0;
+            manager.TraverseGameObjectsBreadthFirst(
+                [ & ](engine::GameObject* object)
+                {
+                    sum += reinterpret_cast<uintptr_t>(object);
+                });
+
+            benchmarks::DoNotOptimize(sum);
+        });
+
+    double serialWork = benchmarks::Measure(objectCount,
+        [ & ]()
+        {
+            size_t sum = 0;
+            manager.TraverseGameObjectsPreOrder(
+                [ & ](engine::GameObject* object)
+                {
+                    sum += Work(object);
+                });
+
+            benchmarks::DoNotOptimize(sum);
+        });
+
+    double parallelWork = benchmarks::Measure(objectCount,
+        [ & ]()
+        {
+            std::atomic<size_t> sum { 0 };
+            manager.ParallelTraverseGameObjectsPreOrder(
+                [ & ](engine::GameObject* object)
+                {
+                    sum.fetch_add(Work(object), std::memory_order_relaxed);
+                });
+
+            benchmarks::DoNotOptimize(sum.load());
+        });
+
+    benchmarks::Report("traversal", "pre-order, std::function + std::stack", legacy);
+    benchmarks::Report("traversal", "pre-order", preOrder);
+    benchmarks::Report("traversal", "post-order", postOrder);
+    benchmarks::Report("traversal", "breadth first", breadthFirst);
+    benchmarks::Report("traversal", "pre-order with work", serialWork);
+    benchmarks::Report("traversal", "parallel pre-order with work", parallelWork);
+
+    for (engine::GameObject* root : roots)
+    {
+        manager.DestroyGameObject(root);
+    }
+
+    manager.Update();
+    jobs.Shutdown();
+}
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include <engine/game_object/game_object.hpp>
 #include <engine/game_object/game_object_manager.hpp>
 #include <engine/input/input_manager.hpp>
+#include <engine/job/job_system.hpp>
+#include <engine/system/system_scheduler.hpp>
 #include <engine/window/window.hpp>
 
 void MainInitialize();
@@ -56,6 +58,7 @@ int main(int, char**)
     ImVec4 clear_color         = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 
     engine::InputManager::GetInstance().Initialize();
+    engine::JobSystem::GetInstance().Initialize();
 
     MainInitialize();
 
@@ -95,6 +98,7 @@ int main(int, char**)
 
         engine::InputManager::GetInstance().Update();
 
+        engine::SystemScheduler::GetInstance().Update();
         engine::GameObjectManager::GetInstance().Update();
 
         // Start the Dear ImGui frame
@@ -129,7 +133,9 @@ int main(int, char**)
     MainShutdown();
 
     engine::GameObjectManager::GetInstance().Shutdown();
+    engine::SystemScheduler::GetInstance().Shutdown();
 
+    engine::JobSystem::GetInstance().Shutdown();
     engine::InputManager::GetInstance().Shutdown();
 
     // Cleanup
@@ -255,7 +261,8 @@ void MainDrawing()
 
         engine::GameObjectManager::GetInstance().ForEachRootGameObject(
             [](engine::GameObject* object) {
-                ImGui::Text(object->GetName().c_str());
+                std::string_view name = object->GetName();
+                ImGui::TextUnformatted(name.data(), name.data() + name.size());
 
                 if (ImGui::IsItemClicked())
                 {
@@ -286,7 +293,8 @@ void MainDrawing()
 
         if (selected_object != nullptr)
         {
-            ImGui::Text(selected_object->GetName().c_str());
+            std::string_view name = selected_object->GetName();
+            ImGui::TextUnformatted(name.data(), name.data() + name.size());
 
             const std::list<engine::Component*>& components = selected_object->GetAllComponents();
             for (engine::Component* component : components)
@@ -1,31 +1,237 @@
 #include "core.hpp"
 #include <shared/logger.hpp>
 
+#include <algorithm>
+#include <cstdio> // snprintf
+#include <stdexcept>
+
+#include <game_object/game_object_manager.hpp>
+#include <input/input_manager.hpp>
+#include <job/job_system.hpp>
+#include <system/system_scheduler.hpp>
+#include <transformation/transform_system.hpp>
+#include <window/window.hpp>
+
+#include <SDL3/SDL.h>
+
+namespace
+{
+    uint64_t ToNanoseconds(double seconds)
+    {
+        return static_cast<uint64_t>(seconds * 1e9 + 0.5);
+    }
+
+    double ToSeconds(uint64_t nanoseconds)
+    {
+        return static_cast<double>(nanoseconds) * 1e-9;
+    }
+
+    double ToMilliseconds(uint64_t nanoseconds)
+    {
+        return static_cast<double>(nanoseconds) * 1e-6;
+    }
+} // namespace
+
+Engine::Engine()
+    : m_gameProject { nullptr }
+    , m_settings { Constants::DEFAULT_FIXED_TIMESTEP, Constants::DEFAULT_MAX_STEPS_PER_FRAME, Constants::DEFAULT_MAX_FRAME_TIME, 0.0, 0,
+          engine::WindowBackend::Headless, engine::RenderPipeline::Constants::MIN_SNAPSHOT_COUNT, engine::RenderPipeline::Handoff::Queue }
+    , m_pacer {}
+    , m_stats {}
+    , m_renderer { nullptr }
+    , m_renderPipeline {}
+    , m_accumulator { 0 }
+    , m_lastFrameStart { 0 }
+    , m_nextDeadline { 0 }
+    , m_isQuitRequested { false }
+{
+}
+
 void Engine::Run()
 {
     Initialize();
-	Update();
+
+    while (!m_isQuitRequested && !m_gameProject->IsQuitRequested())
+    {
+        Update();
+
+        if (m_settings.m_maxFrameCount != 0 && m_stats.GetFrameCount() >= m_settings.m_maxFrameCount)
+        {
+            break;
+        }
+    }
+
 	Shutdown();
 }
 
 void Engine::Initialize()
 {
-    shared::Log("Engine initialize!");
+    if (m_gameProject == nullptr)
+    {
+        throw std::runtime_error("Tried to run the engine without a game");
+    }
+
+#ifdef _DEBUG
+    shared::Log("Engine initialize! We are in Debug!");
+#else
+    shared::Log("Engine initialize! We are in Release!");
+#endif
+
+    engine::Window& window = engine::Window::GetInstance();
+    window.Initialize(m_settings.m_windowBackend);
+
+    // without a window there are no SDL events nor devices to sample
+    if (!window.IsHeadless())
+    {
+        engine::InputManager::GetInstance().Initialize();
+    }
+
+    engine::JobSystem::GetInstance().Initialize();
     m_gameProject->Initialize();
+
+    if (m_renderer != nullptr)
+    {
+        m_renderPipeline.Start(*m_renderer, m_settings.m_renderSnapshotCount, m_settings.m_renderHandoff);
+    }
+
+    // the clock starts after the game initialization, or its loading time would be the first frame
+    m_isQuitRequested = false;
+    m_accumulator     = 0;
+    m_lastFrameStart  = engine::GetClockTime();
+    m_nextDeadline    = m_lastFrameStart;
+    m_stats.Reset();
 }
 
 void Engine::Update()
 {
-#ifdef _DEBUG
-    shared::Log("Engine update! We are in Debug!");
-#else
-    shared::Log("Engine update! We are in Release!");
-#endif
+    uint64_t frameStart = engine::GetClockTime();
+    uint64_t frameTime  = frameStart - m_lastFrameStart;
+    m_lastFrameStart    = frameStart;
+
+    engine::Window& window = engine::Window::GetInstance();
+    if (!window.IsHeadless())
+    {
+        SDL_Event ev;
+        while (SDL_PollEvent(&ev))
+        {
+            if (ev.type == SDL_EVENT_QUIT)
+            {
+                RequestQuit();
+            }
+
+            window.ProcessEvents(&ev);
+            engine::InputManager::GetInstance().ProcessEvents(&ev);
+        }
+
+        // once per frame, so every step of this frame sees the same input
+        engine::InputManager::GetInstance().Update();
+    }
+
+    uint64_t timestep     = ToNanoseconds(m_settings.m_fixedTimestep);
+    uint64_t maxFrameTime = ToNanoseconds(m_settings.m_maxFrameTime);
+    uint64_t elapsed      = std::min(frameTime, maxFrameTime);
+
+    m_accumulator += elapsed;
+    m_gameProject->Update(ToSeconds(elapsed));
+
+    // catch up with the clock, one step at a time
+    uint32_t stepCount = 0;
+    while (m_accumulator >= timestep && stepCount < m_settings.m_maxStepsPerFrame)
+    {
+        engine::SystemScheduler::GetInstance().Update();
+        engine::GameObjectManager::GetInstance().Update();
+        m_gameProject->FixedUpdate(m_settings.m_fixedTimestep);
+
+        m_accumulator -= timestep;
+        ++stepCount;
+    }
+
+    // spiral of death clamp: when the steps take longer than the time they simulate, the
+    // backlog would grow every frame. the whole steps left are dropped instead, and the
+    // simulation runs slower than real time until it keeps up again
+    if (m_accumulator >= timestep)
+    {
+        uint64_t dropped  = m_accumulator - m_accumulator % timestep;
+        m_accumulator    -= dropped;
+        m_stats.AddDroppedTime(dropped);
+    }
+
+    float alpha = static_cast<float>(static_cast<double>(m_accumulator) / static_cast<double>(timestep));
+
+    engine::TransformSystem* transformSystem = engine::SystemScheduler::GetInstance().FindSystem<engine::TransformSystem>();
+    if (transformSystem != nullptr && transformSystem->IsInterpolationEnabled())
+    {
+        transformSystem->Interpolate(alpha);
+    }
+
+    // with a renderer, only the copy of the frame state is on this thread, the render thread
+    // draws it while the next frames simulate
+    if (m_renderer != nullptr)
+    {
+        engine::RenderSnapshot& snapshot = m_renderPipeline.BeginFrame();
+        snapshot.SetAlpha(alpha);
+        m_gameProject->Capture(snapshot, alpha);
+        m_renderPipeline.EndFrame();
+    }
+    else
+    {
+        m_gameProject->Render(alpha);
+        window.SwapBuffers();
+    }
+
+    uint64_t workEnd = engine::GetClockTime();
+
+    // the deadlines advance by whole frames from the previous one rather than from the end of
+    // the work, so the frame rate does not drift. a frame later than a whole period resets the
+    // cadence instead of rushing the next frames to make up for it
+    if (m_settings.m_targetFrameRate > 0.0)
+    {
+        uint64_t period  = ToNanoseconds(1.0 / m_settings.m_targetFrameRate);
+        m_nextDeadline  += period;
+
+        if (m_nextDeadline + period < workEnd)
+        {
+            m_nextDeadline = workEnd;
+        }
+
+        m_pacer.WaitUntil(m_nextDeadline);
+    }
+
+    uint64_t waitTime = engine::GetClockTime() - workEnd;
+
+    m_stats.Record(engine::FrameTiming { frameTime, workEnd - frameStart, waitTime, stepCount, alpha });
 }
 
 void Engine::Shutdown()
 {
+    // presents the frames already captured before the game releases its resources
+    m_renderPipeline.Stop();
+
     m_gameProject->Shutdown();
+    engine::GameObjectManager::GetInstance().Shutdown();
+    engine::SystemScheduler::GetInstance().Shutdown();
+    engine::JobSystem::GetInstance().Shutdown();
+
+    engine::Window& window = engine::Window::GetInstance();
+    if (!window.IsHeadless())
+    {
+        engine::InputManager::GetInstance().Shutdown();
+    }
+
+    window.Shutdown();
+
+    char summary[ 256 ];
+    snprintf(summary, sizeof(summary),
+        "%llu frames, %llu steps, frame time avg %.3f ms, p99 %.3f ms, max %.3f ms, jitter %.3f ms, dropped %.3f ms",
+        static_cast<unsigned long long>(m_stats.GetFrameCount()),
+        static_cast<unsigned long long>(m_stats.GetStepCount()),
+        ToMilliseconds(m_stats.GetAverageFrameTime()),
+        ToMilliseconds(m_stats.GetPercentileFrameTime(0.99f)),
+        ToMilliseconds(m_stats.GetMaxFrameTime()),
+        ToMilliseconds(m_stats.GetJitter()),
+        ToMilliseconds(m_stats.GetDroppedTime()));
+    shared::Log(summary);
+
     shared::Log("Engine shutdown!");
 }
 
@@ -33,4 +239,59 @@ void Engine::SetGame(iGameProject* gameProject)
 {
 	m_gameProject = gameProject;
     m_gameProject->RegisterTypes();
+}
+
+void Engine::SetRenderer(engine::Renderer* renderer)
+{
+    if (m_renderPipeline.IsRunning())
+    {
+        throw std::runtime_error("Tried to change the renderer while the engine runs");
+    }
+
+    m_renderer = renderer;
+}
+
+const engine::RenderPipeline& Engine::GetRenderPipeline() const
+{
+    return m_renderPipeline;
+}
+
+void Engine::SetSettings(const Engine::Settings& settings)
+{
+    if (settings.m_fixedTimestep <= 0.0)
+    {
+        throw std::runtime_error("Tried to set a fixed timestep that is not positive");
+    }
+
+    if (settings.m_maxFrameTime <= 0.0)
+    {
+        throw std::runtime_error("Tried to set a maximum frame time that is not positive");
+    }
+
+    if (settings.m_maxStepsPerFrame == 0)
+    {
+        throw std::runtime_error("Tried to allow no simulation steps per frame");
+    }
+
+    if (settings.m_targetFrameRate < 0.0)
+    {
+        throw std::runtime_error("Tried to set a negative target frame rate");
+    }
+
+    m_settings = settings;
+}
+
+const Engine::Settings& Engine::GetSettings() const
+{
+    return m_settings;
+}
+
+const engine::FrameStats& Engine::GetFrameStats() const
+{
+    return m_stats;
+}
+
+void Engine::RequestQuit()
+{
+    m_isQuitRequested = true;
 }
\ No newline at end of file
@@ -1,24 +1,94 @@
 #ifndef CORE_HPP
 #define CORE_HPP
 
+#include <cstdint>
+
+#include "render/render_pipeline.hpp"
+#include "render/renderer.hpp"
+#include "timing/frame_pacer.hpp"
+#include "timing/frame_stats.hpp"
+#include "window/window.hpp"
+
 struct iGameProject
 {
     virtual void RegisterTypes() = 0;
     virtual void Initialize() = 0;
     virtual void Shutdown() = 0;
+
+    // frame loop hooks, they do nothing by default
+    virtual void Update(double /*frameTime*/) {}     // once per frame, before the simulation steps
+    virtual void FixedUpdate(double /*timestep*/) {} // once per simulation step, after the systems
+    virtual void Render(float /*alpha*/) {}          // once per frame, alpha blends the last two steps
+    virtual void Capture(engine::RenderSnapshot& /*snapshot*/, float /*alpha*/) {} // replaces Render with a renderer, on the game thread
+    virtual bool IsQuitRequested() { return false; }
 };
 
+// runs the game in a fixed timestep loop: the simulation advances in steps of the same length,
+// as many as the elapsed time needs, while rendering happens once per frame at whatever rate
+// the frame cap and the hardware allow, interpolated between the last two steps. with a
+// renderer, the game captures each frame into a snapshot that a render thread draws while the
+// next frame simulates. the engine owns the window, which is headless unless the settings ask
+// for an sdl one
 class Engine
 {
+  public:
+    struct Constants
+    {
+        static constexpr double   DEFAULT_FIXED_TIMESTEP      = 1.0 / 60.0;
+        static constexpr uint32_t DEFAULT_MAX_STEPS_PER_FRAME = 8;
+        static constexpr double   DEFAULT_MAX_FRAME_TIME      = 0.25;
+    };
+
+    // times in seconds
+    struct Settings
+    {
+        double   m_fixedTimestep;
+        uint32_t m_maxStepsPerFrame; // the time of the steps past it is dropped, so a slow simulation can not fall further behind every frame
+        double   m_maxFrameTime;     // longer frames (breakpoints, loading hitches) count as this long
+        double   m_targetFrameRate;  // frame cap in frames per second, 0 for uncapped
+        uint64_t m_maxFrameCount;    // the loop stops after this many frames, 0 for no limit
+
+        // read when the loop starts. the render settings only apply with a renderer
+        engine::WindowBackend           m_windowBackend;
+        size_t                          m_renderSnapshotCount;
+        engine::RenderPipeline::Handoff m_renderHandoff;
+    };
+
+  private:
 	iGameProject* m_gameProject;
 
+    Settings               m_settings;
+    engine::FramePacer     m_pacer;
+    engine::FrameStats     m_stats;
+    engine::Renderer*      m_renderer;
+    engine::RenderPipeline m_renderPipeline;
+    uint64_t               m_accumulator;    // simulation time not stepped yet, in nanoseconds
+    uint64_t               m_lastFrameStart; // on the GetClockTime clock
+    uint64_t               m_nextDeadline;   // when the next frame starts with a frame cap
+    bool                   m_isQuitRequested;
+
     void Initialize();
-    void Update();
+    void Update(); // one frame
     void Shutdown();
 
   public:
+    Engine();
+
     void Run();
     void SetGame(iGameProject* gameProject);
+
+    // null renders through iGameProject::Render on the game thread. set before Run
+    void                          SetRenderer(engine::Renderer* renderer);
+    const engine::RenderPipeline& GetRenderPipeline() const;
+
+    // can be changed between frames, except for the render settings
+    void            SetSettings(const Settings& settings);
+    const Settings& GetSettings() const;
+
+    const engine::FrameStats& GetFrameStats() const;
+
+    // the loop finishes the current frame and shuts down
+    void RequestQuit();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "frustum.hpp"
+
+#include <cmath>
+
+engine::Frustum engine::Frustum::FromMatrix(const glm::mat4& viewProjection)
+{
+    // each plane is the last row of the matrix plus or minus one of the others
+    glm::vec4 rows[ 4 ];
+    for (int row = 0; row < 4; row++)
+    {
+        rows[ row ] = glm::vec4 { viewProjection[ 0 ][ row ], viewProjection[ 1 ][ row ], viewProjection[ 2 ][ row ], viewProjection[ 3 ][ row ] };
+    }
+
+    Frustum frustum;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        frustum.m_planes[ axis * 2 ]     = rows[ 3 ] + rows[ axis ];
+        frustum.m_planes[ axis * 2 + 1 ] = rows[ 3 ] - rows[ axis ];
+    }
+
+    // unit normals, so that distances to the planes can be compared with radii
+    for (glm::vec4& plane : frustum.m_planes)
+    {
+        float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        plane        = plane * (1.0f / length);
+    }
+
+    return frustum;
+}
+
+bool engine::Frustum::Intersects(const engine::Sphere& sphere) const
+{
+    for (const glm::vec4& plane : m_planes)
+    {
+        float distance = plane.x * sphere.m_center.x + plane.y * sphere.m_center.y + plane.z * sphere.m_center.z + plane.w;
+        if (distance < -sphere.m_radius)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool engine::Frustum::Intersects(const engine::Aabb& box) const
+{
+    glm::vec3 center  = box.GetCenter();
+    glm::vec3 extents = box.GetExtents();
+
+    for (const glm::vec4& plane : m_planes)
+    {
+        // the extents projected on the normal, the radius of the box along it
+        float radius   = std::fabs(plane.x) * extents.x + std::fabs(plane.y) * extents.y + std::fabs(plane.z) * extents.z;
+        float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        if (distance < -radius)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
\ No newline at end of file
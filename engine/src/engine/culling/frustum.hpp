@@ -0,0 +1,32 @@
+#ifndef FRUSTUM_HPP
+#define FRUSTUM_HPP
+
+#include <cstddef>
+
+#include <glm/glm.hpp>
+
+#include <engine/spatial/bounds.hpp>
+
+namespace engine
+{
+    // six planes facing inwards, a point p is inside when dot(normal, p) + distance >= 0 for all
+    // of them. the tests are conservative: volumes near the corners of the frustum may be reported
+    // as intersecting it while being outside
+    struct Frustum
+    {
+        struct Constants
+        {
+            static constexpr size_t PLANE_COUNT = 6;
+        };
+
+        glm::vec4 m_planes[ Constants::PLANE_COUNT ]; // unit normal in xyz, distance in w
+
+        // left, right, bottom, top, near and far planes of an opengl view projection, with depth in [-w, w]
+        static Frustum FromMatrix(const glm::mat4& viewProjection);
+
+        bool Intersects(const Sphere& sphere) const;
+        bool Intersects(const Aabb& box) const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,451 @@
+#include "frustum_culling.hpp"
+
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+#include <simd/cpu_features.hpp>
+
+#if ENGINE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    // every kernel tests [begin, end) and appends the visible indices after the visibleCount
+    // already written. the simd ones return where they stopped, the scalar kernel finishes the
+    // remainder. indices are written whether the volume is visible or not, and only kept by
+    // advancing the count, which avoids a hard to predict branch per volume. the array views are
+    // taken by value, through a reference every store of an index would reload the pointers
+
+    void CullSpheresScalar(const engine::Frustum& frustum, engine::BoundingSphereArrays spheres, uint32_t* visibleIndices, size_t& visibleCount, size_t begin, size_t end)
+    {
+        size_t count = visibleCount;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            float x      = spheres.m_centerX[ i ];
+            float y      = spheres.m_centerY[ i ];
+            float z      = spheres.m_centerZ[ i ];
+            float radius = spheres.m_radius[ i ];
+
+            bool isVisible = true;
+            for (const glm::vec4& plane : frustum.m_planes)
+            {
+                isVisible &= plane.x * x + plane.y * y + plane.z * z + plane.w >= -radius;
+            }
+
+            visibleIndices[ count ] = static_cast<uint32_t>(i);
+            count += isVisible ? 1 : 0;
+        }
+
+        visibleCount = count;
+    }
+
+    void CullBoxesScalar(const engine::Frustum& frustum, engine::BoundingBoxArrays boxes, uint32_t* visibleIndices, size_t& visibleCount, size_t begin, size_t end)
+    {
+        size_t count = visibleCount;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            float x  = boxes.m_centerX[ i ];
+            float y  = boxes.m_centerY[ i ];
+            float z  = boxes.m_centerZ[ i ];
+            float ex = boxes.m_extentX[ i ];
+            float ey = boxes.m_extentY[ i ];
+            float ez = boxes.m_extentZ[ i ];
+
+            bool isVisible = true;
+            for (const glm::vec4& plane : frustum.m_planes)
+            {
+                float radius = std::fabs(plane.x) * ex + std::fabs(plane.y) * ey + std::fabs(plane.z) * ez;
+                isVisible &= plane.x * x + plane.y * y + plane.z * z + plane.w >= -radius;
+            }
+
+            visibleIndices[ count ] = static_cast<uint32_t>(i);
+            count += isVisible ? 1 : 0;
+        }
+
+        visibleCount = count;
+    }
+
+#if ENGINE_SIMD_X86
+    // the distance of the volume to every plane is kept as the minimum over the planes, a single
+    // comparison then decides visibility
+
+    ENGINE_TARGET_SSE2 void AppendVisibleSse2(__m128 minimumDistance, size_t index, uint32_t* visibleIndices, size_t& count)
+    {
+        int mask = _mm_movemask_ps(_mm_cmpge_ps(minimumDistance, _mm_setzero_ps()));
+
+        for (int lane = 0; lane < 4; lane++)
+        {
+            visibleIndices[ count ] = static_cast<uint32_t>(index + lane);
+            count += (mask >> lane) & 1;
+        }
+    }
+
+    ENGINE_TARGET_SSE2 size_t CullSpheresSse2(const engine::Frustum& frustum, engine::BoundingSphereArrays spheres, uint32_t* visibleIndices, size_t& visibleCount, size_t end)
+    {
+        size_t count = visibleCount;
+        size_t i     = 0;
+
+        for (; i + 4 <= end; i += 4)
+        {
+            __m128 x      = _mm_loadu_ps(spheres.m_centerX + i);
+            __m128 y      = _mm_loadu_ps(spheres.m_centerY + i);
+            __m128 z      = _mm_loadu_ps(spheres.m_centerZ + i);
+            __m128 radius = _mm_loadu_ps(spheres.m_radius + i);
+
+            __m128 minimum = _mm_set1_ps(INFINITY);
+            for (const glm::vec4& plane : frustum.m_planes)
+            {
+                __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_mul_ps(_mm_set1_ps(plane.y), y)),
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), z), _mm_set1_ps(plane.w)));
+
+                minimum = _mm_min_ps(minimum, distance);
+            }
+
+            AppendVisibleSse2(_mm_add_ps(minimum, radius), i, visibleIndices, count);
+        }
+
+        visibleCount = count;
+        return i;
+    }
+
+    ENGINE_TARGET_SSE2 size_t CullBoxesSse2(const engine::Frustum& frustum, engine::BoundingBoxArrays boxes, uint32_t* visibleIndices, size_t& visibleCount, size_t end)
+    {
+        size_t count = visibleCount;
+        size_t i     = 0;
+
+        for (; i + 4 <= end; i += 4)
+        {
+            __m128 x  = _mm_loadu_ps(boxes.m_centerX + i);
+            __m128 y  = _mm_loadu_ps(boxes.m_centerY + i);
+            __m128 z  = _mm_loadu_ps(boxes.m_centerZ + i);
+            __m128 ex = _mm_loadu_ps(boxes.m_extentX + i);
+            __m128 ey = _mm_loadu_ps(boxes.m_extentY + i);
+            __m128 ez = _mm_loadu_ps(boxes.m_extentZ + i);
+
+            __m128 minimum = _mm_set1_ps(INFINITY);
+            for (const glm::vec4& plane : frustum.m_planes)
+            {
+                __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_mul_ps(_mm_set1_ps(plane.y), y)),
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), z), _mm_set1_ps(plane.w)));
+
+                __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(std::fabs(plane.x)), ex), _mm_mul_ps(_mm_set1_ps(std::fabs(plane.y)), ey)),
+                    _mm_mul_ps(_mm_set1_ps(std::fabs(plane.z)), ez));
+
+                minimum = _mm_min_ps(minimum, _mm_add_ps(distance, radius));
+            }
+
+            AppendVisibleSse2(minimum, i, visibleIndices, count);
+        }
+
+        visibleCount = count;
+        return i;
+    }
+
+    // for every 8 bit visibility mask, the lanes of the visible volumes packed at the front, one per byte
+    struct CompactionTable
+    {
+        uint64_t m_lanes[ 256 ];
+    };
+
+    constexpr CompactionTable MakeCompactionTable()
+    {
+        CompactionTable table {};
+
+        for (uint32_t mask = 0; mask < 256; mask++)
+        {
+            uint32_t packed = 0;
+            for (uint64_t lane = 0; lane < 8; lane++)
+            {
+                if ((mask >> lane) & 1)
+                {
+                    table.m_lanes[ mask ] |= lane << (8 * packed++);
+                }
+            }
+        }
+
+        return table;
+    }
+
+    constexpr CompactionTable COMPACTION_TABLE = MakeCompactionTable();
+
+    // writes all 8 lanes, the ones past the visible ones are overwritten by the next call. this
+    // stays inside the output since no more indices are written than volumes were tested
+    ENGINE_TARGET_AVX2 void AppendVisibleAvx2(__m256 minimumDistance, __m256i indices, uint32_t* visibleIndices, size_t& count)
+    {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(minimumDistance, _mm256_setzero_ps(), _CMP_GE_OQ));
+
+        __m256i lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&COMPACTION_TABLE.m_lanes[ mask ])));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(visibleIndices + count), _mm256_permutevar8x32_epi32(indices, lanes));
+
+        count += static_cast<size_t>(std::popcount(static_cast<uint32_t>(mask)));
+    }
+
+    // the planes broadcast to every lane
+    struct FrustumAvx2
+    {
+        __m256 m_x[ engine::Frustum::Constants::PLANE_COUNT ];
+        __m256 m_y[ engine::Frustum::Constants::PLANE_COUNT ];
+        __m256 m_z[ engine::Frustum::Constants::PLANE_COUNT ];
+        __m256 m_w[ engine::Frustum::Constants::PLANE_COUNT ];
+        __m256 m_absoluteX[ engine::Frustum::Constants::PLANE_COUNT ];
+        __m256 m_absoluteY[ engine::Frustum::Constants::PLANE_COUNT ];
+        __m256 m_absoluteZ[ engine::Frustum::Constants::PLANE_COUNT ];
+    };
+
+    ENGINE_TARGET_AVX2 FrustumAvx2 BroadcastFrustumAvx2(const engine::Frustum& frustum)
+    {
+        FrustumAvx2 planes;
+
+        for (size_t p = 0; p < engine::Frustum::Constants::PLANE_COUNT; p++)
+        {
+            planes.m_x[ p ]         = _mm256_set1_ps(frustum.m_planes[ p ].x);
+            planes.m_y[ p ]         = _mm256_set1_ps(frustum.m_planes[ p ].y);
+            planes.m_z[ p ]         = _mm256_set1_ps(frustum.m_planes[ p ].z);
+            planes.m_w[ p ]         = _mm256_set1_ps(frustum.m_planes[ p ].w);
+            planes.m_absoluteX[ p ] = _mm256_set1_ps(std::fabs(frustum.m_planes[ p ].x));
+            planes.m_absoluteY[ p ] = _mm256_set1_ps(std::fabs(frustum.m_planes[ p ].y));
+            planes.m_absoluteZ[ p ] = _mm256_set1_ps(std::fabs(frustum.m_planes[ p ].z));
+        }
+
+        return planes;
+    }
+
+    ENGINE_TARGET_AVX2 __m256 PlaneDistanceAvx2(const FrustumAvx2& planes, size_t p, __m256 x, __m256 y, __m256 z)
+    {
+        return _mm256_fmadd_ps(planes.m_x[ p ], x, _mm256_fmadd_ps(planes.m_y[ p ], y, _mm256_fmadd_ps(planes.m_z[ p ], z, planes.m_w[ p ])));
+    }
+
+    // the radius of a box along the normal of a plane
+    ENGINE_TARGET_AVX2 __m256 PlaneRadiusAvx2(const FrustumAvx2& planes, size_t p, __m256 ex, __m256 ey, __m256 ez, __m256 distance)
+    {
+        return _mm256_fmadd_ps(planes.m_absoluteX[ p ], ex, _mm256_fmadd_ps(planes.m_absoluteY[ p ], ey, _mm256_fmadd_ps(planes.m_absoluteZ[ p ], ez, distance)));
+    }
+
+    // a tree instead of a chain, so that the minimums of different planes do not wait on each other
+    ENGINE_TARGET_AVX2 __m256 MinimumAvx2(__m256 d0, __m256 d1, __m256 d2, __m256 d3, __m256 d4, __m256 d5)
+    {
+        return _mm256_min_ps(_mm256_min_ps(_mm256_min_ps(d0, d1), _mm256_min_ps(d2, d3)), _mm256_min_ps(d4, d5));
+    }
+
+    ENGINE_TARGET_AVX2 size_t CullSpheresAvx2(const engine::Frustum& frustum, engine::BoundingSphereArrays spheres, uint32_t* visibleIndices, size_t& visibleCount, size_t end)
+    {
+        FrustumAvx2 planes = BroadcastFrustumAvx2(frustum);
+
+        __m256i indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i step    = _mm256_set1_epi32(8);
+        size_t  count   = visibleCount;
+        size_t  i       = 0;
+
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256 x      = _mm256_loadu_ps(spheres.m_centerX + i);
+            __m256 y      = _mm256_loadu_ps(spheres.m_centerY + i);
+            __m256 z      = _mm256_loadu_ps(spheres.m_centerZ + i);
+            __m256 radius = _mm256_loadu_ps(spheres.m_radius + i);
+
+            __m256 minimum = MinimumAvx2(
+                PlaneDistanceAvx2(planes, 0, x, y, z),
+                PlaneDistanceAvx2(planes, 1, x, y, z),
+                PlaneDistanceAvx2(planes, 2, x, y, z),
+                PlaneDistanceAvx2(planes, 3, x, y, z),
+                PlaneDistanceAvx2(planes, 4, x, y, z),
+                PlaneDistanceAvx2(planes, 5, x, y, z));
+
+            AppendVisibleAvx2(_mm256_add_ps(minimum, radius), indices, visibleIndices, count);
+            indices = _mm256_add_epi32(indices, step);
+        }
+
+        visibleCount = count;
+        return i;
+    }
+
+    ENGINE_TARGET_AVX2 size_t CullBoxesAvx2(const engine::Frustum& frustum, engine::BoundingBoxArrays boxes, uint32_t* visibleIndices, size_t& visibleCount, size_t end)
+    {
+        FrustumAvx2 planes = BroadcastFrustumAvx2(frustum);
+
+        __m256i indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i step    = _mm256_set1_epi32(8);
+        size_t  count   = visibleCount;
+        size_t  i       = 0;
+
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256 x  = _mm256_loadu_ps(boxes.m_centerX + i);
+            __m256 y  = _mm256_loadu_ps(boxes.m_centerY + i);
+            __m256 z  = _mm256_loadu_ps(boxes.m_centerZ + i);
+            __m256 ex = _mm256_loadu_ps(boxes.m_extentX + i);
+            __m256 ey = _mm256_loadu_ps(boxes.m_extentY + i);
+            __m256 ez = _mm256_loadu_ps(boxes.m_extentZ + i);
+
+            // distance of the center plus the radius of the box along the normal
+            __m256 minimum = MinimumAvx2(
+                PlaneRadiusAvx2(planes, 0, ex, ey, ez, PlaneDistanceAvx2(planes, 0, x, y, z)),
+                PlaneRadiusAvx2(planes, 1, ex, ey, ez, PlaneDistanceAvx2(planes, 1, x, y, z)),
+                PlaneRadiusAvx2(planes, 2, ex, ey, ez, PlaneDistanceAvx2(planes, 2, x, y, z)),
+                PlaneRadiusAvx2(planes, 3, ex, ey, ez, PlaneDistanceAvx2(planes, 3, x, y, z)),
+                PlaneRadiusAvx2(planes, 4, ex, ey, ez, PlaneDistanceAvx2(planes, 4, x, y, z)),
+                PlaneRadiusAvx2(planes, 5, ex, ey, ez, PlaneDistanceAvx2(planes, 5, x, y, z)));
+
+            AppendVisibleAvx2(minimum, indices, visibleIndices, count);
+            indices = _mm256_add_epi32(indices, step);
+        }
+
+        visibleCount = count;
+        return i;
+    }
+#endif
+} // namespace
+
+void engine::BoundingSphereBuffer::Resize(size_t count)
+{
+    m_centerX.resize(count, 0.0f);
+    m_centerY.resize(count, 0.0f);
+    m_centerZ.resize(count, 0.0f);
+    m_radius.resize(count, 0.0f);
+}
+
+size_t engine::BoundingSphereBuffer::GetCount() const
+{
+    return m_centerX.size();
+}
+
+void engine::BoundingSphereBuffer::Set(size_t index, const engine::Sphere& sphere)
+{
+    m_centerX[ index ] = sphere.m_center.x;
+    m_centerY[ index ] = sphere.m_center.y;
+    m_centerZ[ index ] = sphere.m_center.z;
+    m_radius[ index ]  = sphere.m_radius;
+}
+
+engine::Sphere engine::BoundingSphereBuffer::Get(size_t index) const
+{
+    return Sphere { glm::vec3 { m_centerX[ index ], m_centerY[ index ], m_centerZ[ index ] }, m_radius[ index ] };
+}
+
+engine::BoundingSphereArrays engine::BoundingSphereBuffer::GetArrays()
+{
+    return BoundingSphereArrays { m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_radius.data(), m_centerX.size() };
+}
+
+void engine::BoundingBoxBuffer::Resize(size_t count)
+{
+    m_centerX.resize(count, 0.0f);
+    m_centerY.resize(count, 0.0f);
+    m_centerZ.resize(count, 0.0f);
+    m_extentX.resize(count, 0.0f);
+    m_extentY.resize(count, 0.0f);
+    m_extentZ.resize(count, 0.0f);
+}
+
+size_t engine::BoundingBoxBuffer::GetCount() const
+{
+    return m_centerX.size();
+}
+
+void engine::BoundingBoxBuffer::Set(size_t index, const engine::Aabb& box)
+{
+    glm::vec3 center  = box.GetCenter();
+    glm::vec3 extents = box.GetExtents();
+
+    m_centerX[ index ] = center.x;
+    m_centerY[ index ] = center.y;
+    m_centerZ[ index ] = center.z;
+    m_extentX[ index ] = extents.x;
+    m_extentY[ index ] = extents.y;
+    m_extentZ[ index ] = extents.z;
+}
+
+engine::Aabb engine::BoundingBoxBuffer::Get(size_t index) const
+{
+    glm::vec3 center { m_centerX[ index ], m_centerY[ index ], m_centerZ[ index ] };
+    glm::vec3 extents { m_extentX[ index ], m_extentY[ index ], m_extentZ[ index ] };
+
+    return Aabb::FromCenterExtents(center, extents);
+}
+
+engine::BoundingBoxArrays engine::BoundingBoxBuffer::GetArrays()
+{
+    return BoundingBoxArrays {
+        m_centerX.data(),
+        m_centerY.data(),
+        m_centerZ.data(),
+        m_extentX.data(),
+        m_extentY.data(),
+        m_extentZ.data(),
+        m_centerX.size()
+    };
+}
+
+void engine::ComputeBoundingSpheres(const engine::TransformationArrays& transformations, const float* localRadii, const engine::BoundingSphereArrays& results)
+{
+    if (transformations.m_count != results.m_count)
+    {
+        throw std::runtime_error("Tried to compute bounding spheres for batches of different sizes");
+    }
+
+    // simple enough for the compiler to vectorize
+    for (size_t i = 0; i < results.m_count; i++)
+    {
+        float x     = std::fabs(transformations.m_scaleX[ i ]);
+        float y     = std::fabs(transformations.m_scaleY[ i ]);
+        float z     = std::fabs(transformations.m_scaleZ[ i ]);
+        float scale = x > y ? (x > z ? x : z) : (y > z ? y : z);
+
+        results.m_centerX[ i ] = transformations.m_positionX[ i ];
+        results.m_centerY[ i ] = transformations.m_positionY[ i ];
+        results.m_centerZ[ i ] = transformations.m_positionZ[ i ];
+        results.m_radius[ i ]  = localRadii[ i ] * scale;
+    }
+}
+
+size_t engine::CullSpheres(const engine::Frustum& frustum, const engine::BoundingSphereArrays& spheres, uint32_t* visibleIndices)
+{
+    size_t count        = spheres.m_count;
+    size_t done         = 0;
+    size_t visibleCount = 0;
+
+#if ENGINE_SIMD_X86
+    switch (GetSimdLevel())
+    {
+        case SimdLevel::Avx2:
+            done = CullSpheresAvx2(frustum, spheres, visibleIndices, visibleCount, count);
+            break;
+        case SimdLevel::Sse2:
+            done = CullSpheresSse2(frustum, spheres, visibleIndices, visibleCount, count);
+            break;
+        case SimdLevel::Scalar:
+            break;
+    }
+#endif
+
+    CullSpheresScalar(frustum, spheres, visibleIndices, visibleCount, done, count);
+    return visibleCount;
+}
+
+size_t engine::CullBoxes(const engine::Frustum& frustum, const engine::BoundingBoxArrays& boxes, uint32_t* visibleIndices)
+{
+    size_t count        = boxes.m_count;
+    size_t done         = 0;
+    size_t visibleCount = 0;
+
+#if ENGINE_SIMD_X86
+    switch (GetSimdLevel())
+    {
+        case SimdLevel::Avx2:
+            done = CullBoxesAvx2(frustum, boxes, visibleIndices, visibleCount, count);
+            break;
+        case SimdLevel::Sse2:
+            done = CullBoxesSse2(frustum, boxes, visibleIndices, visibleCount, count);
+            break;
+        case SimdLevel::Scalar:
+            break;
+    }
+#endif
+
+    CullBoxesScalar(frustum, boxes, visibleIndices, visibleCount, done, count);
+    return visibleCount;
+}
\ No newline at end of file
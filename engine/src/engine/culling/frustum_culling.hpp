@@ -0,0 +1,86 @@
+#ifndef FRUSTUM_CULLING_HPP
+#define FRUSTUM_CULLING_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <engine/spatial/bounds.hpp>
+#include <engine/transformation/transformation_batch.hpp>
+#include "frustum.hpp"
+
+namespace engine
+{
+    // structure of arrays views over world space bounding volumes, every array holds m_count elements
+    struct BoundingSphereArrays
+    {
+        float* m_centerX;
+        float* m_centerY;
+        float* m_centerZ;
+        float* m_radius;
+        size_t m_count;
+    };
+
+    struct BoundingBoxArrays
+    {
+        float* m_centerX;
+        float* m_centerY;
+        float* m_centerZ;
+        float* m_extentX; // half the size
+        float* m_extentY;
+        float* m_extentZ;
+        size_t m_count;
+    };
+
+    // own the arrays behind the views above
+    class BoundingSphereBuffer
+    {
+        std::vector<float> m_centerX;
+        std::vector<float> m_centerY;
+        std::vector<float> m_centerZ;
+        std::vector<float> m_radius;
+
+      public:
+        // new elements are empty spheres at the origin
+        void   Resize(size_t count);
+        size_t GetCount() const;
+
+        void   Set(size_t index, const Sphere& sphere);
+        Sphere Get(size_t index) const;
+
+        // invalidated by Resize
+        BoundingSphereArrays GetArrays();
+    };
+
+    class BoundingBoxBuffer
+    {
+        std::vector<float> m_centerX;
+        std::vector<float> m_centerY;
+        std::vector<float> m_centerZ;
+        std::vector<float> m_extentX;
+        std::vector<float> m_extentY;
+        std::vector<float> m_extentZ;
+
+      public:
+        // new elements are empty boxes at the origin
+        void   Resize(size_t count);
+        size_t GetCount() const;
+
+        void Set(size_t index, const Aabb& box);
+        Aabb Get(size_t index) const;
+
+        // invalidated by Resize
+        BoundingBoxArrays GetArrays();
+    };
+
+    // world bounding spheres of objects whose local bounding sphere is centered on their origin,
+    // with a radius of localRadii[i]. non uniform scales use their largest axis
+    void ComputeBoundingSpheres(const TransformationArrays& transformations, const float* localRadii, const BoundingSphereArrays& results);
+
+    // the cull functions pick the widest kernel the cpu supports (see GetSimdLevel), and write the
+    // indices of the volumes that intersect the frustum to visibleIndices, in increasing order.
+    // visibleIndices must have room for m_count indices. they return how many were written
+    size_t CullSpheres(const Frustum& frustum, const BoundingSphereArrays& spheres, uint32_t* visibleIndices);
+    size_t CullBoxes(const Frustum& frustum, const BoundingBoxArrays& boxes, uint32_t* visibleIndices);
+} // namespace engine
+
+#endif
\ No newline at end of file
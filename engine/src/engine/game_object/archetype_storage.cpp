@@ -0,0 +1,297 @@
+#include "archetype_storage.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "game_object.hpp"
+
+engine::Archetype::Archetype(const engine::ComponentMask& mask)
+    : m_mask { mask }
+    , m_columnCount { mask.Count() }
+    , m_columnLayouts {}
+    , m_dataSize { 0 }
+    , m_chunkCapacity { 0 }
+    , m_chunks {}
+    , m_count { 0 }
+{
+    // one pointer per column plus the owner, per row, and the inline data of the data components
+    size_t rowSize = (m_columnCount + 1) * sizeof(void*);
+
+    m_columnLayouts.reserve(m_columnCount);
+    for (ComponentTypeId id = 0; id < ComponentMask::MAX_COMPONENT_TYPES; id++)
+    {
+        if (mask.Test(id))
+        {
+            ComponentDataLayout layout = GetComponentDataLayout(id);
+            m_columnLayouts.push_back(Column { id, layout, 0 });
+            rowSize += layout.m_size;
+        }
+    }
+
+    m_chunkCapacity = Constants::CHUNK_SIZE / rowSize;
+    if (m_chunkCapacity == 0)
+    {
+        m_chunkCapacity = 1;
+    }
+
+    // the data columns follow each other inside one allocation per chunk
+    for (Column& column : m_columnLayouts)
+    {
+        if (column.m_dataLayout.m_size == 0)
+        {
+            continue;
+        }
+
+        size_t alignment    = column.m_dataLayout.m_alignment;
+        column.m_dataOffset = (m_dataSize + alignment - 1) / alignment * alignment;
+        m_dataSize          = column.m_dataOffset + column.m_dataLayout.m_size * m_chunkCapacity;
+    }
+}
+
+engine::Component** engine::Archetype::GetColumn(engine::Archetype::Chunk& chunk, size_t column) const
+{
+    return chunk.m_columns.get() + column * m_chunkCapacity;
+}
+
+std::byte* engine::Archetype::GetData(engine::Archetype::Chunk& chunk, size_t column) const
+{
+    return chunk.m_data.get() + m_columnLayouts[ column ].m_dataOffset;
+}
+
+void* engine::Archetype::GetData(size_t row, size_t column) const
+{
+    const Chunk& chunk = m_chunks[ row / m_chunkCapacity ];
+    size_t       index = row % m_chunkCapacity;
+
+    return chunk.m_data.get() + m_columnLayouts[ column ].m_dataOffset + index * m_columnLayouts[ column ].m_dataLayout.m_size;
+}
+
+size_t engine::Archetype::AddRow(engine::GameObject* object, const std::vector<engine::Component*>& components)
+{
+    if (m_chunks.empty() || m_chunks.back().m_count == m_chunkCapacity)
+    {
+        Chunk chunk;
+        chunk.m_objects = std::make_unique<GameObject*[]>(m_chunkCapacity);
+        chunk.m_columns = std::make_unique<Component*[]>(m_chunkCapacity * m_columnCount);
+        chunk.m_data    = m_dataSize != 0 ? std::make_unique<std::byte[]>(m_dataSize) : nullptr;
+        chunk.m_count   = 0;
+
+        m_chunks.push_back(std::move(chunk));
+    }
+
+    Chunk& chunk = m_chunks.back();
+    size_t row   = (m_chunks.size() - 1) * m_chunkCapacity + chunk.m_count;
+
+    chunk.m_objects[ chunk.m_count ] = object;
+    chunk.m_count++;
+    m_count++;
+
+    WriteRow(row, components);
+
+    for (size_t column = 0; column < m_columnCount; column++)
+    {
+        if (m_columnLayouts[ column ].m_dataLayout.m_size != 0)
+        {
+            m_columnLayouts[ column ].m_dataLayout.m_initialize(GetData(row, column));
+        }
+    }
+
+    return row;
+}
+
+void engine::Archetype::WriteRow(size_t row, const std::vector<engine::Component*>& components)
+{
+    Chunk& chunk = m_chunks[ row / m_chunkCapacity ];
+    size_t index = row % m_chunkCapacity;
+
+    for (size_t column = 0; column < m_columnCount; column++)
+    {
+        GetColumn(chunk, column)[ index ] = components[ column ];
+    }
+}
+
+engine::GameObject* engine::Archetype::RemoveRow(size_t row)
+{
+    size_t lastRow = m_count - 1;
+
+    Chunk& chunk     = m_chunks[ row / m_chunkCapacity ];
+    Chunk& lastChunk = m_chunks.back();
+    size_t index     = row % m_chunkCapacity;
+    size_t lastIndex = lastRow % m_chunkCapacity;
+
+    // keep rows packed by moving the last row into the hole
+    GameObject* movedObject = nullptr;
+    if (row != lastRow)
+    {
+        movedObject              = lastChunk.m_objects[ lastIndex ];
+        chunk.m_objects[ index ] = movedObject;
+
+        for (size_t column = 0; column < m_columnCount; column++)
+        {
+            GetColumn(chunk, column)[ index ] = GetColumn(lastChunk, column)[ lastIndex ];
+
+            // inline data is trivially copyable
+            size_t dataSize = m_columnLayouts[ column ].m_dataLayout.m_size;
+            if (dataSize != 0)
+            {
+                std::memcpy(GetData(row, column), GetData(lastRow, column), dataSize);
+            }
+        }
+    }
+
+    lastChunk.m_count--;
+    m_count--;
+
+    if (lastChunk.m_count == 0)
+    {
+        m_chunks.pop_back();
+    }
+
+    return movedObject;
+}
+
+void engine::Archetype::CopyData(size_t row, const engine::Archetype& source, size_t sourceRow)
+{
+    for (size_t column = 0; column < m_columnCount; column++)
+    {
+        const Column& layout = m_columnLayouts[ column ];
+        if (layout.m_dataLayout.m_size == 0 || source.m_mask.Test(layout.m_typeId) == false)
+        {
+            continue;
+        }
+
+        std::memcpy(GetData(row, column), source.GetData(sourceRow, source.m_mask.CountBefore(layout.m_typeId)), layout.m_dataLayout.m_size);
+    }
+}
+
+const engine::ComponentMask& engine::Archetype::GetMask() const
+{
+    return m_mask;
+}
+
+size_t engine::Archetype::GetCount() const
+{
+    return m_count;
+}
+
+size_t engine::Archetype::GetChunkCount() const
+{
+    return m_chunks.size();
+}
+
+size_t engine::Archetype::GetChunkCapacity() const
+{
+    return m_chunkCapacity;
+}
+
+engine::ArchetypeStorage::ArchetypeStorage()
+    : m_archetypes {}
+    , m_archetypeLookup {}
+    , m_queries {}
+    , m_iterationDepth { 0 }
+{
+}
+
+engine::ArchetypeStorage& engine::ArchetypeStorage::GetInstance()
+{
+    static ArchetypeStorage instance {};
+    return instance;
+}
+
+engine::Archetype* engine::ArchetypeStorage::GetOrCreateArchetype(const engine::ComponentMask& mask)
+{
+    std::unordered_map<ComponentMask, Archetype*, ComponentMaskHash>::iterator it = m_archetypeLookup.find(mask);
+    if (it != m_archetypeLookup.end())
+    {
+        return it->second;
+    }
+
+    m_archetypes.push_back(std::make_unique<Archetype>(mask));
+
+    Archetype* archetype = m_archetypes.back().get();
+    m_archetypeLookup.emplace(mask, archetype);
+
+    return archetype;
+}
+
+const std::vector<engine::Archetype*>& engine::ArchetypeStorage::GetMatchingArchetypes(const engine::ComponentMask& mask)
+{
+    Query& query = m_queries[ mask ];
+
+    // archetypes are never destroyed, so only the ones created since the last call need to be checked
+    for (size_t i = query.m_checkedArchetypeCount; i < m_archetypes.size(); i++)
+    {
+        if (m_archetypes[ i ]->m_mask.Contains(mask))
+        {
+            query.m_archetypes.push_back(m_archetypes[ i ].get());
+        }
+    }
+
+    query.m_checkedArchetypeCount = m_archetypes.size();
+    return query.m_archetypes;
+}
+
+void engine::ArchetypeStorage::CheckStructuralChange() const
+{
+    if (m_iterationDepth > 0)
+    {
+        throw std::runtime_error("Tried to change the components of a game object while iterating over archetypes");
+    }
+}
+
+void engine::ArchetypeStorage::Refresh(engine::GameObject* object)
+{
+    CheckStructuralChange();
+
+    Archetype* previous = object->m_archetype;
+
+    // same component set, only the stored pointers may have changed
+    if (previous != nullptr && previous->m_mask == object->m_componentMask)
+    {
+        previous->WriteRow(object->m_archetypeRow, object->m_componentSlots);
+        return;
+    }
+
+    if (object->m_componentMask.IsEmpty())
+    {
+        Remove(object);
+        return;
+    }
+
+    Archetype* archetype = GetOrCreateArchetype(object->m_componentMask);
+    size_t     row       = archetype->AddRow(object, object->m_componentSlots);
+
+    // the inline data of the components the object keeps moves along with it
+    if (previous != nullptr)
+    {
+        archetype->CopyData(row, *previous, object->m_archetypeRow);
+        Remove(object);
+    }
+
+    object->m_archetype    = archetype;
+    object->m_archetypeRow = row;
+}
+
+void engine::ArchetypeStorage::Remove(engine::GameObject* object)
+{
+    if (object->m_archetype == nullptr)
+    {
+        return;
+    }
+
+    CheckStructuralChange();
+
+    GameObject* movedObject = object->m_archetype->RemoveRow(object->m_archetypeRow);
+    if (movedObject != nullptr)
+    {
+        movedObject->m_archetypeRow = object->m_archetypeRow;
+    }
+
+    object->m_archetype    = nullptr;
+    object->m_archetypeRow = 0;
+}
+
+size_t engine::ArchetypeStorage::GetArchetypeCount() const
+{
+    return m_archetypes.size();
+}
\ No newline at end of file
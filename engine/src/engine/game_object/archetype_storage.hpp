@@ -0,0 +1,168 @@
+#ifndef ARCHETYPE_STORAGE_HPP
+#define ARCHETYPE_STORAGE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "component_type.hpp"
+
+namespace engine
+{
+    class Component;
+    class DataComponentBase;
+    class GameObject;
+
+    // typed view over one component column of a chunk
+    template <typename T>
+    struct ComponentColumn
+    {
+        Component* const* m_components;
+
+        T& operator[](size_t index) const
+        {
+            return *static_cast<T*>(m_components[ index ]);
+        }
+    };
+
+    // data components are viewed through their inline data, which is contiguous
+    template <typename T>
+        requires HasInlineData<T>
+    struct ComponentColumn<T>
+    {
+        typename T::InlineData* m_data;
+
+        typename T::InlineData& operator[](size_t index) const
+        {
+            return m_data[ index ];
+        }
+    };
+
+    // what ForEach passes for a component of type T
+    template <typename T>
+    using ComponentReference = decltype(std::declval<const ComponentColumn<T>&>()[ 0 ]);
+
+    // every game object with the same component set lives in the same archetype.
+    // rows are stored in fixed size chunks, with one contiguous column per component type
+    // (ordered by type id) plus a column with the owning game objects. the columns hold
+    // pointers to the components, which are polymorphic and referenced by stable pointers and
+    // handles, so they stay in their per type pools. data components (see DataComponent) also
+    // keep their data inline in a contiguous column of the chunk, and that is what queries read
+    class Archetype
+    {
+        friend class ArchetypeStorage;
+        friend class DataComponentBase;
+
+        struct Constants
+        {
+            static constexpr size_t CHUNK_SIZE = 16 * 1024;
+        };
+
+        struct Column
+        {
+            ComponentTypeId     m_typeId;
+            ComponentDataLayout m_dataLayout; // all zero when the data stays in the component
+            size_t              m_dataOffset; // start of the inline data inside the chunk data
+        };
+
+        struct Chunk
+        {
+            std::unique_ptr<GameObject*[]> m_objects;
+            std::unique_ptr<Component*[]>  m_columns;
+            std::unique_ptr<std::byte[]>   m_data; // inline data columns, null when there are none
+            size_t                         m_count;
+        };
+
+        ComponentMask       m_mask;
+        size_t              m_columnCount;
+        std::vector<Column> m_columnLayouts;
+        size_t              m_dataSize; // bytes of inline data per chunk
+        size_t              m_chunkCapacity;
+        std::vector<Chunk>  m_chunks;
+        size_t              m_count;
+
+        Component** GetColumn(Chunk& chunk, size_t column) const;
+        std::byte*  GetData(Chunk& chunk, size_t column) const;
+        void*       GetData(size_t row, size_t column) const;
+
+        size_t      AddRow(GameObject* object, const std::vector<Component*>& components);
+        void        WriteRow(size_t row, const std::vector<Component*>& components);
+        GameObject* RemoveRow(size_t row);
+
+        // copies the inline data of every type both archetypes have, from a row of the other archetype
+        void CopyData(size_t row, const Archetype& source, size_t sourceRow);
+
+      public:
+        Archetype(const ComponentMask& mask);
+        Archetype(const Archetype&)            = delete;
+        Archetype& operator=(const Archetype&) = delete;
+
+        const ComponentMask& GetMask() const;
+        size_t               GetCount() const;
+        size_t               GetChunkCount() const;
+        size_t               GetChunkCapacity() const;
+    };
+
+    class ArchetypeStorage
+    {
+        friend class GameObject;
+        friend class GameObjectManager;
+
+        struct Query
+        {
+            std::vector<Archetype*> m_archetypes;
+            size_t                  m_checkedArchetypeCount;
+        };
+
+        std::vector<std::unique_ptr<Archetype>>                          m_archetypes;
+        std::unordered_map<ComponentMask, Archetype*, ComponentMaskHash> m_archetypeLookup;
+        std::unordered_map<ComponentMask, Query, ComponentMaskHash>      m_queries;
+        size_t                                                           m_iterationDepth;
+
+        ArchetypeStorage();
+        ~ArchetypeStorage()                                  = default;
+        ArchetypeStorage(const ArchetypeStorage&)            = delete;
+        ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+
+        Archetype*                     GetOrCreateArchetype(const ComponentMask& mask);
+        const std::vector<Archetype*>& GetMatchingArchetypes(const ComponentMask& mask);
+
+        // called before a game object changes anything about its components, so that a
+        // structural change during iteration is rejected before any state is touched
+        void CheckStructuralChange() const;
+
+        // called every time the component set of a game object changes, or the object is destroyed
+        void Refresh(GameObject* object);
+        void Remove(GameObject* object);
+
+        template <typename T>
+        static ComponentColumn<T> MakeColumn(Archetype& archetype, Archetype::Chunk& chunk, size_t column);
+
+        template <typename... Ts, typename Func, size_t... Is>
+        void ForEachChunkImpl(Func& func, std::index_sequence<Is...>);
+
+      public:
+        static ArchetypeStorage& GetInstance();
+
+        // calls func(Ts&...) or func(GameObject*, Ts&...) for every game object that has all of Ts.
+        // data components are passed as their T::InlineData& instead.
+        // components can not be added or removed while iterating
+        template <typename... Ts, typename Func>
+        void ForEach(Func&& func);
+
+        // calls func(count, GameObject* const* objects, ComponentColumn<Ts>...) once per matching chunk
+        template <typename... Ts, typename Func>
+        void ForEachChunk(Func&& func);
+
+        template <typename... Ts>
+        size_t Count();
+
+        size_t GetArchetypeCount() const;
+    };
+} // namespace engine
+
+#include "archetype_storage.inl"
+
+#endif
\ No newline at end of file
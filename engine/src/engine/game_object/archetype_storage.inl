@@ -0,0 +1,93 @@
+#include "archetype_storage.hpp"
+
+#include <type_traits>
+
+template <typename T>
+engine::ComponentColumn<T> engine::ArchetypeStorage::MakeColumn(engine::Archetype& archetype, engine::Archetype::Chunk& chunk, size_t column)
+{
+    if constexpr (HasInlineData<T>)
+    {
+        return ComponentColumn<T> { reinterpret_cast<typename T::InlineData*>(archetype.GetData(chunk, column)) };
+    }
+    else
+    {
+        return ComponentColumn<T> { archetype.GetColumn(chunk, column) };
+    }
+}
+
+template <typename... Ts, typename Func, size_t... Is>
+void engine::ArchetypeStorage::ForEachChunkImpl(Func& func, std::index_sequence<Is...>)
+{
+    ComponentMask mask {};
+    (mask.Set(GetComponentTypeId<Ts>()), ...);
+
+    const std::vector<Archetype*>& archetypes = GetMatchingArchetypes(mask);
+
+    // structural changes would move rows around while they are being visited
+    struct IterationScope
+    {
+        size_t& m_depth;
+
+        IterationScope(size_t& depth)
+            : m_depth { depth }
+        {
+            m_depth++;
+        }
+
+        ~IterationScope()
+        {
+            m_depth--;
+        }
+    } scope { m_iterationDepth };
+
+    for (Archetype* archetype : archetypes)
+    {
+        // column of every requested type inside this archetype
+        size_t columns[ sizeof...(Ts) ] = { archetype->m_mask.CountBefore(GetComponentTypeId<Ts>())... };
+
+        for (Archetype::Chunk& chunk : archetype->m_chunks)
+        {
+            if (chunk.m_count == 0)
+            {
+                continue;
+            }
+
+            func(chunk.m_count, static_cast<GameObject* const*>(chunk.m_objects.get()), MakeColumn<Ts>(*archetype, chunk, columns[ Is ])...);
+        }
+    }
+}
+
+template <typename... Ts, typename Func>
+void engine::ArchetypeStorage::ForEachChunk(Func&& func)
+{
+    static_assert(sizeof...(Ts) > 0, "ForEachChunk needs at least one component type");
+    ForEachChunkImpl<Ts...>(func, std::index_sequence_for<Ts...> {});
+}
+
+template <typename... Ts, typename Func>
+void engine::ArchetypeStorage::ForEach(Func&& func)
+{
+    ForEachChunk<Ts...>(
+        [ & ](size_t count, GameObject* const* objects, ComponentColumn<Ts>... columns)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if constexpr (std::is_invocable_v<Func&, GameObject*, ComponentReference<Ts>...>)
+                {
+                    func(objects[ i ], columns[ i ]...);
+                }
+                else
+                {
+                    func(columns[ i ]...);
+                }
+            }
+        });
+}
+
+template <typename... Ts>
+size_t engine::ArchetypeStorage::Count()
+{
+    size_t count = 0;
+    ForEachChunk<Ts...>([ & ](size_t chunkCount, GameObject* const*, ComponentColumn<Ts>...) { count += chunkCount; });
+    return count;
+}
\ No newline at end of file
@@ -1,7 +1,14 @@
 #include "component.hpp"
 
+#include <system/system_scheduler.hpp>
+
 engine::Component::Component()
     : m_owner(nullptr)
+    , m_pool(nullptr)
+    , m_typeId(0)
+    , m_handle()
+    , m_system(nullptr)
+    , m_systemIndex(0)
 {
 }
 
@@ -20,6 +27,12 @@ void engine::Component::Shutdown()
     ShutdownEvents();
     OnShutdown();
     RemoveFromSystem();
+
+    // never leave a dangling pointer behind, even if the override forgot to unregister
+    if (m_system != nullptr)
+    {
+        SystemScheduler::GetInstance().RemoveComponent(this);
+    }
 }
 
 engine::GameObject* engine::Component::GetOwner() const
@@ -27,6 +40,16 @@ engine::GameObject* engine::Component::GetOwner() const
     return m_owner;
 }
 
+engine::ComponentTypeId engine::Component::GetTypeId() const
+{
+    return m_typeId;
+}
+
+engine::ComponentHandle engine::Component::GetHandle() const
+{
+    return m_handle;
+}
+
 // virtual interface methods
 void engine::Component::AddToSystem() { }
 void engine::Component::RemoveFromSystem() { }
@@ -1,15 +1,28 @@
 #ifndef COMPONENT_HPP
 #define COMPONENT_HPP
 
+#include "component_type.hpp"
+#include "handle.hpp"
+
 namespace engine
 {
+    class ComponentSystem;
     class GameObject;
+    class PoolAllocator;
 
     class Component
     {
         friend class GameObject;
+        friend class GameObjectManager;
+        friend class ComponentSystem;
+        friend class SystemScheduler;
 
-        GameObject* m_owner;
+        GameObject*      m_owner;
+        PoolAllocator*   m_pool; // null when the component was not allocated by the engine
+        ComponentTypeId  m_typeId;
+        ComponentHandle  m_handle;
+        ComponentSystem* m_system;      // null while the component is not updated by any system
+        size_t           m_systemIndex; // position inside the system
 
         void Create();
         void Shutdown();
@@ -32,7 +45,9 @@ namespace engine
       public:
 
         virtual ~Component() = 0;
-        GameObject* GetOwner() const;
+        GameObject*     GetOwner() const;
+        ComponentTypeId GetTypeId() const;
+        ComponentHandle GetHandle() const;
     };
 } // namespace engine
 
@@ -0,0 +1,103 @@
+#include "component_type.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "component.hpp"
+#include "data_component.hpp"
+
+namespace
+{
+    std::unordered_map<std::type_index, engine::ComponentTypeId>& GetComponentTypes()
+    {
+        static std::unordered_map<std::type_index, engine::ComponentTypeId> types {};
+        return types;
+    }
+
+    // indexed by type id
+    std::vector<const char*>& GetComponentTypeNames()
+    {
+        static std::vector<const char*> names {};
+        return names;
+    }
+
+    // indexed by type id
+    std::vector<engine::ComponentDataLayout>& GetComponentDataLayouts()
+    {
+        static std::vector<engine::ComponentDataLayout> layouts {};
+        return layouts;
+    }
+
+    // guards the tables, types can be seen for the first time on any thread
+    std::mutex& GetComponentTypeMutex()
+    {
+        static std::mutex mutex {};
+        return mutex;
+    }
+} // namespace
+
+engine::ComponentTypeId engine::RegisterComponentType(const std::type_info& type, const engine::ComponentDataLayout& layout)
+{
+    std::lock_guard<std::mutex> lock { GetComponentTypeMutex() };
+
+    std::unordered_map<std::type_index, ComponentTypeId>& types = GetComponentTypes();
+
+    std::unordered_map<std::type_index, ComponentTypeId>::const_iterator it = types.find(std::type_index { type });
+    if (it != types.end())
+    {
+        return it->second;
+    }
+
+    if (types.size() >= ComponentMask::MAX_COMPONENT_TYPES)
+    {
+        throw std::runtime_error("Too many component types registered");
+    }
+
+    ComponentTypeId id = static_cast<ComponentTypeId>(types.size());
+    types.emplace(std::type_index { type }, id);
+    GetComponentTypeNames().push_back(type.name());
+    GetComponentDataLayouts().push_back(layout);
+
+    return id;
+}
+
+engine::ComponentTypeId engine::GetComponentTypeId(const engine::Component& component)
+{
+    // the layout of data components can only be known from the component itself here
+    const DataComponentBase* dataComponent = dynamic_cast<const DataComponentBase*>(&component);
+    if (dataComponent != nullptr)
+    {
+        return RegisterComponentType(typeid(component), dataComponent->GetDataLayout());
+    }
+
+    return RegisterComponentType(typeid(component));
+}
+
+const char* engine::GetComponentTypeName(engine::ComponentTypeId id)
+{
+    std::lock_guard<std::mutex> lock { GetComponentTypeMutex() };
+
+    std::vector<const char*>& names = GetComponentTypeNames();
+    if (id >= names.size())
+    {
+        throw std::out_of_range("Invalid component type id");
+    }
+
+    return names[ id ];
+}
+
+engine::ComponentDataLayout engine::GetComponentDataLayout(engine::ComponentTypeId id)
+{
+    std::lock_guard<std::mutex> lock { GetComponentTypeMutex() };
+
+    std::vector<ComponentDataLayout>& layouts = GetComponentDataLayouts();
+    if (id >= layouts.size())
+    {
+        throw std::out_of_range("Invalid component type id");
+    }
+
+    return layouts[ id ];
+}
\ No newline at end of file
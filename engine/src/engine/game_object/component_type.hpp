@@ -0,0 +1,188 @@
+#ifndef COMPONENT_TYPE_HPP
+#define COMPONENT_TYPE_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <typeinfo>
+
+namespace engine
+{
+    class Component;
+
+    using ComponentTypeId = uint32_t;
+
+    // one bit per component type
+    class ComponentMask
+    {
+      public:
+        static constexpr size_t MAX_COMPONENT_TYPES = 128;
+
+      private:
+        static constexpr size_t WORD_BITS  = 64;
+        static constexpr size_t WORD_COUNT = MAX_COMPONENT_TYPES / WORD_BITS;
+
+        uint64_t m_words[ WORD_COUNT ];
+
+      public:
+        constexpr ComponentMask()
+            : m_words {}
+        {
+        }
+
+        void Set(ComponentTypeId id)
+        {
+            m_words[ id / WORD_BITS ] |= uint64_t { 1 } << (id % WORD_BITS);
+        }
+
+        void Reset(ComponentTypeId id)
+        {
+            m_words[ id / WORD_BITS ] &= ~(uint64_t { 1 } << (id % WORD_BITS));
+        }
+
+        bool Test(ComponentTypeId id) const
+        {
+            return (m_words[ id / WORD_BITS ] >> (id % WORD_BITS)) & 1;
+        }
+
+        // true if every bit set in other is also set in this mask
+        bool Contains(const ComponentMask& other) const
+        {
+            for (size_t i = 0; i < WORD_COUNT; i++)
+            {
+                if ((m_words[ i ] & other.m_words[ i ]) != other.m_words[ i ])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // number of bits set below id, used to index compact per-type tables
+        size_t CountBefore(ComponentTypeId id) const
+        {
+            size_t count = 0;
+            size_t word  = id / WORD_BITS;
+
+            for (size_t i = 0; i < word; i++)
+            {
+                count += std::popcount(m_words[ i ]);
+            }
+
+            uint64_t below = (uint64_t { 1 } << (id % WORD_BITS)) - 1;
+            return count + std::popcount(m_words[ word ] & below);
+        }
+
+        size_t Count() const
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < WORD_COUNT; i++)
+            {
+                count += std::popcount(m_words[ i ]);
+            }
+
+            return count;
+        }
+
+        bool IsEmpty() const
+        {
+            return Count() == 0;
+        }
+
+        void Clear()
+        {
+            for (size_t i = 0; i < WORD_COUNT; i++)
+            {
+                m_words[ i ] = 0;
+            }
+        }
+
+        bool operator==(const ComponentMask& other) const
+        {
+            for (size_t i = 0; i < WORD_COUNT; i++)
+            {
+                if (m_words[ i ] != other.m_words[ i ])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool operator!=(const ComponentMask& other) const
+        {
+            return !(*this == other);
+        }
+
+        size_t GetHash() const
+        {
+            uint64_t hash = 0;
+            for (size_t i = 0; i < WORD_COUNT; i++)
+            {
+                hash ^= m_words[ i ] + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+            }
+
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    struct ComponentMaskHash
+    {
+        size_t operator()(const ComponentMask& mask) const
+        {
+            return mask.GetHash();
+        }
+    };
+
+    // layout of the data a component type keeps inline in the archetype columns, all zero for
+    // components whose data lives in the component itself
+    struct ComponentDataLayout
+    {
+        size_t m_size;
+        size_t m_alignment;
+        void (*m_initialize)(void* memory); // constructs the data in place as InlineData {}
+    };
+
+    // component types that keep their data inline in the archetype columns name it InlineData,
+    // see DataComponent
+    template <typename T>
+    concept HasInlineData = requires { typename T::InlineData; };
+
+    template <typename T>
+    ComponentDataLayout MakeComponentDataLayout()
+    {
+        if constexpr (HasInlineData<T>)
+        {
+            using Data = typename T::InlineData;
+            return ComponentDataLayout { sizeof(Data), alignof(Data), [](void* memory) { new (memory) Data {}; } };
+        }
+        else
+        {
+            return ComponentDataLayout { 0, 0, nullptr };
+        }
+    }
+
+    // ids are handed out sequentially the first time a type is seen. thread safe
+    ComponentTypeId RegisterComponentType(const std::type_info& type, const ComponentDataLayout& layout = {});
+
+    // id of the dynamic type of a component, only needed for components not added through AddComponent<T>
+    ComponentTypeId GetComponentTypeId(const Component& component);
+
+    // implementation defined name of a registered type, as given by std::type_info
+    const char* GetComponentTypeName(ComponentTypeId id);
+
+    ComponentDataLayout GetComponentDataLayout(ComponentTypeId id);
+
+    // the id is resolved once per type, every later call is a plain load
+    template <typename T>
+    ComponentTypeId GetComponentTypeId()
+    {
+        static const ComponentTypeId id = RegisterComponentType(typeid(T), MakeComponentDataLayout<T>());
+        return id;
+    }
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,18 @@
+#include "data_component.hpp"
+
+#include <stdexcept>
+
+#include "archetype_storage.hpp"
+#include "game_object.hpp"
+
+void* engine::DataComponentBase::GetDataAddress() const
+{
+    GameObject* owner = GetOwner();
+    if (owner == nullptr || owner->m_archetype == nullptr)
+    {
+        throw std::runtime_error("Tried to access the data of a component that is not attached to a game object");
+    }
+
+    Archetype* archetype = owner->m_archetype;
+    return archetype->GetData(owner->m_archetypeRow, archetype->m_mask.CountBefore(GetTypeId()));
+}
\ No newline at end of file
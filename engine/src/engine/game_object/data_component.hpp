@@ -0,0 +1,55 @@
+#ifndef DATA_COMPONENT_HPP
+#define DATA_COMPONENT_HPP
+
+#include <type_traits>
+
+#include "component.hpp"
+
+namespace engine
+{
+    // untyped part of DataComponent, so the engine can reach the inline data of any of them
+    class DataComponentBase : public Component
+    {
+      protected:
+        DataComponentBase() = default;
+
+        // address of the data inside the archetype row of the owner
+        void* GetDataAddress() const;
+
+      public:
+        virtual ComponentDataLayout GetDataLayout() const = 0;
+    };
+
+    // a component whose data lives inline in the archetype columns of its owner, instead of inside
+    // the component. ForEach and ForEachChunk hand out that data directly, so iterating it is a linear
+    // walk over the chunks. the component itself stays put and only forwards to the row of its owner.
+    // the data starts as Data {} when the component is added, is moved with memcpy whenever the owner
+    // changes archetype, and is only reachable while the component is attached.
+    // a game object can hold at most one data component of each type
+    template <typename Data>
+    class DataComponent : public DataComponentBase
+    {
+        static_assert(std::is_trivially_copyable_v<Data>, "Inline component data is moved with memcpy");
+        static_assert(alignof(Data) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Inline component data can not be over aligned");
+
+      public:
+        using InlineData = Data;
+
+        ComponentDataLayout GetDataLayout() const override
+        {
+            return MakeComponentDataLayout<DataComponent>();
+        }
+
+        Data& GetData()
+        {
+            return *static_cast<Data*>(GetDataAddress());
+        }
+
+        const Data& GetData() const
+        {
+            return *static_cast<const Data*>(GetDataAddress());
+        }
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -2,41 +2,160 @@
 
 #include <stdexcept>
 
+#include "archetype_storage.hpp"
 #include "component.hpp"
+#include "data_component.hpp"
 #include "game_object_manager.hpp"
+#include <memory/memory_manager.hpp>
+#include <system/system_scheduler.hpp>
+#include <transformation/transform_system.hpp>
 #include <transformation/transformation_component.hpp>
 
-engine::GameObject::GameObject(const std::string& name)
-    : m_name { name }
-    , m_parent { nullptr }
+engine::GameObjectList::GameObjectList()
+    : m_first { nullptr }
+    , m_last { nullptr }
+    , m_count { 0 }
 {
 }
 
-void engine::GameObject::DestroyInternal()
+void engine::GameObjectList::PushBack(engine::GameObject* object)
 {
-    for (GameObject* child : m_children)
+    object->m_previousSibling = m_last;
+    object->m_nextSibling     = nullptr;
+
+    if (m_last != nullptr)
     {
-        child->ShutdownEvents();
+        m_last->m_nextSibling = object;
     }
-
-    for (GameObject* child : m_children)
+    else
     {
-        child->DestroyInternal();
+        m_first = object;
+    }
 
-        // todo: memory manager
-        delete child;
+    m_last = object;
+    m_count++;
+}
+
+void engine::GameObjectList::Remove(engine::GameObject* object)
+{
+    if (object->m_previousSibling != nullptr)
+    {
+        object->m_previousSibling->m_nextSibling = object->m_nextSibling;
+    }
+    else
+    {
+        m_first = object->m_nextSibling;
     }
 
-    for (Component* component : m_components)
+    if (object->m_nextSibling != nullptr)
     {
-        component->Shutdown();
+        object->m_nextSibling->m_previousSibling = object->m_previousSibling;
+    }
+    else
+    {
+        m_last = object->m_previousSibling;
+    }
 
-        // todo: memory manager
+    object->m_previousSibling = nullptr;
+    object->m_nextSibling     = nullptr;
+    m_count--;
+}
+
+void engine::GameObjectList::Clear()
+{
+    m_first = nullptr;
+    m_last  = nullptr;
+    m_count = 0;
+}
+
+engine::GameObject::GameObject(std::string_view name)
+    : m_name { StringTable::GetInstance().Intern(name) }
+    , m_nameIndex { 0 }
+    , m_handle {}
+    , m_parent { nullptr }
+    , m_children {}
+    , m_previousSibling { nullptr }
+    , m_nextSibling { nullptr }
+    , m_components {}
+    , m_childArray {}
+    , m_childIndex { 0 }
+    , m_archetype { nullptr }
+    , m_archetypeRow { 0 }
+    , m_isPendingDestroy { false }
+    , m_killQueueIndex { 0 }
+{
+}
+
+void engine::GameObject::DeleteComponent(engine::Component* component)
+{
+    GameObjectManager::GetInstance().m_componentHandles.Release(component->m_handle);
+
+    PoolAllocator* pool = component->m_pool;
+
+    // components added from outside the engine are owned by the heap
+    if (pool == nullptr)
+    {
         delete component;
+        return;
+    }
+
+    // the pool slot starts at the most derived object, which might not be the component base
+    void* memory = dynamic_cast<void*>(component);
+
+    component->~Component();
+    pool->Deallocate(memory);
+}
+
+void engine::GameObject::AttachComponent(engine::Component* component, engine::PoolAllocator* pool, engine::ComponentTypeId typeId)
+{
+    component->m_pool   = pool;
+    component->m_owner  = this;
+    component->m_typeId = typeId;
+    component->m_handle = GameObjectManager::GetInstance().m_componentHandles.Create(component);
+
+    m_components.push_back(component);
+    IndexComponent(component);
+
+    component->Create();
+}
+
+void engine::GameObject::IndexComponent(engine::Component* component)
+{
+    // only the first component of each type is indexed
+    if (m_componentMask.Test(component->m_typeId))
+    {
+        return;
     }
 
-    m_children.clear();
-    m_components.clear();
+    m_componentSlots.insert(m_componentSlots.begin() + m_componentMask.CountBefore(component->m_typeId), component);
+    m_componentMask.Set(component->m_typeId);
+
+    ArchetypeStorage::GetInstance().Refresh(this);
+}
+
+void engine::GameObject::UnindexComponent(engine::Component* component)
+{
+    size_t slot = m_componentMask.CountBefore(component->m_typeId);
+    if (m_componentMask.Test(component->m_typeId) == false || m_componentSlots[ slot ] != component)
+    {
+        return;
+    }
+
+    // promote the next component of the same type, if any
+    for (Component* other : m_components)
+    {
+        if (other != component && other->m_typeId == component->m_typeId)
+        {
+            m_componentSlots[ slot ] = other;
+            ArchetypeStorage::GetInstance().Refresh(this);
+            return;
+        }
+    }
+
+    m_componentSlots.erase(m_componentSlots.begin() + slot);
+    m_componentMask.Reset(component->m_typeId);
+
+    ArchetypeStorage::GetInstance().Refresh(this);
 }
 
 void engine::GameObject::DetachChild(engine::GameObject* child)
@@ -46,12 +165,11 @@ void engine::GameObject::DetachChild(engine::GameObject* child)
         throw std::runtime_error("Tried to detach a null child");
     }
 
-    if (std::find(m_children.begin(), m_children.end(), child) == m_children.end())
+    if (child->m_parent != this)
     {
         throw std::runtime_error("Tried to remove a child from a game object that does not own it");
     }
 
-    m_children.remove(child);
     child->MakeParent();
 }
 
@@ -70,7 +188,7 @@ void engine::GameObject::Initialize()
         component->Initialize();
     }
 
-    for (GameObject* child : m_children)
+    for (GameObject* child = m_children.m_first; child != nullptr; child = child->m_nextSibling)
     {
         child->Initialize();
     }
@@ -81,6 +199,16 @@ void engine::GameObject::Shutdown()
     GameObjectManager::GetInstance().DestroyGameObject(this);
 }
 
+engine::GameObjectHandle engine::GameObject::GetHandle() const
+{
+    return m_handle;
+}
+
+bool engine::GameObject::IsPendingDestroy() const
+{
+    return m_isPendingDestroy;
+}
+
 engine::GameObject* engine::GameObject::AddChild(engine::GameObject* child)
 {
     if (child == nullptr)
@@ -93,21 +221,18 @@ engine::GameObject* engine::GameObject::AddChild(engine::GameObject* child)
         throw std::runtime_error("Tried to make a game object children of itself");
     }
 
-    if (child->GetParent() == nullptr)
-    {
-        GameObjectManager::GetInstance().RemoveRootGameObject(child);
-    }
-
-    m_children.push_back(child);
     child->SetParent(this);
     return child;
 }
 
-engine::GameObject* engine::GameObject::CreateChild(const std::string& name)
+engine::GameObject* engine::GameObject::CreateChild(std::string_view name)
 {
-    // todo: memory manager
-    GameObject* newChild = new GameObject { name };
-    AddChild(newChild);
+    GameObject* newChild = GameObjectManager::AllocateGameObject(name);
+
+    // link the new object directly, it never was a root
+    newChild->m_parent = this;
+    LinkChild(newChild);
+
     return newChild;
 }
 
@@ -118,7 +243,7 @@ void engine::GameObject::RemoveChild(engine::GameObject* child)
         throw std::runtime_error("Tried to remove a null child");
     }
 
-    if (std::find(m_children.begin(), m_children.end(), child) == m_children.end())
+    if (child->m_parent != this)
     {
         throw std::runtime_error("Tried to remove a child from a game object that does not own it");
     }
@@ -126,22 +251,65 @@ void engine::GameObject::RemoveChild(engine::GameObject* child)
     child->Shutdown();
 }
 
-const std::list<engine::GameObject*>& engine::GameObject::GetChildren() const
+void engine::GameObject::LinkChild(engine::GameObject* child)
+{
+    m_children.PushBack(child);
+
+    child->m_childIndex = m_childArray.size();
+    m_childArray.push_back(child);
+}
+
+void engine::GameObject::UnlinkChild(engine::GameObject* child)
+{
+    m_children.Remove(child);
+
+    // swap and pop
+    GameObject* last                    = m_childArray.back();
+    m_childArray[ child->m_childIndex ] = last;
+    last->m_childIndex                  = child->m_childIndex;
+    m_childArray.pop_back();
+
+    child->m_childIndex = 0;
+}
+
+const std::vector<engine::GameObject*>& engine::GameObject::GetChildren() const
 {
-    return m_children;
+    return m_childArray;
 }
 
 engine::GameObject* engine::GameObject::GetChild(size_t index) const
 {
-    if (index >= m_children.size())
+    if (index >= m_children.m_count)
     {
         throw std::out_of_range("Child index out of range");
     }
 
-    std::list<GameObject*>::const_iterator it = m_children.begin();
-    std::advance(it, index);
+    return m_childArray[ index ];
+}
+
+size_t engine::GameObject::GetChildCount() const
+{
+    return m_children.m_count;
+}
+
+engine::GameObject* engine::GameObject::GetFirstChild() const
+{
+    return m_children.m_first;
+}
+
+engine::GameObject* engine::GameObject::GetLastChild() const
+{
+    return m_children.m_last;
+}
 
-    return *it;
+engine::GameObject* engine::GameObject::GetNextSibling() const
+{
+    return m_nextSibling;
+}
+
+engine::GameObject* engine::GameObject::GetPreviousSibling() const
+{
+    return m_previousSibling;
 }
 
 engine::GameObject* engine::GameObject::GetParent() const
@@ -151,44 +319,65 @@ engine::GameObject* engine::GameObject::GetParent() const
 
 void engine::GameObject::SetParent(engine::GameObject* parent)
 {
-    // detach from current parent
-    if (m_parent != nullptr)
+    if (parent == m_parent)
     {
-        m_parent->DetachChild(this);
+        return;
     }
 
-    // if previously an orfan and now has a parent
-    if (m_parent == nullptr && parent != nullptr)
+    // a game object can not be moved below itself
+    for (GameObject* ancestor = parent; ancestor != nullptr; ancestor = ancestor->m_parent)
     {
-        GameObjectManager::GetInstance().RemoveRootGameObject(this);
+        if (ancestor == this)
+        {
+            throw std::runtime_error("Tried to make a game object children of itself");
+        }
     }
-    else if (m_parent != nullptr && parent == nullptr)
+
+    // validate before touching the hierarchy
+    TransformationComponent* transformation_component        = GetComponent<TransformationComponent>();
+    TransformationComponent* parent_transformation_component = nullptr;
+
+    if (transformation_component != nullptr && parent != nullptr)
     {
-        // similarly, if the object becomes orfan
+        parent_transformation_component = parent->GetComponent<TransformationComponent>();
+
+        if (parent_transformation_component == nullptr)
+        {
+            throw std::runtime_error("Parent game object does not have a transformation component");
+        }
+    }
+
+    // detach from current parent, or from the root list if the object was an orfan
+    if (m_parent != nullptr)
+    {
+        m_parent->UnlinkChild(this);
+    }
+    else
+    {
+        GameObjectManager::GetInstance().RemoveRootGameObject(this);
+    }
 
+    // attach to the new parent, or to the root list if the object becomes orfan
+    if (parent != nullptr)
+    {
+        parent->LinkChild(this);
+    }
+    else
+    {
         GameObjectManager::GetInstance().AddGameObject(this);
     }
 
     m_parent = parent;
 
     // if the object has a transformation set the parent transformation accordingly
-    if (TransformationComponent* transformation_component = GetComponent<TransformationComponent>())
+    if (transformation_component != nullptr)
     {
-        if (m_parent == nullptr)
-        {
-            transformation_component->SetParent(nullptr);
-        }
-        else
-        {
-            TransformationComponent* parent_transformation_component = m_parent->GetComponent<TransformationComponent>();
-
-            if (parent_transformation_component == nullptr)
-            {
-                throw std::runtime_error("Parent game object does not have a transformation component");
-            }
-
-            transformation_component->SetParent(parent_transformation_component);
-        }
+        transformation_component->SetParent(parent_transformation_component);
+    }
+    else if (TransformSystem* transform_system = SystemScheduler::GetInstance().FindSystem<TransformSystem>())
+    {
+        // transformations below this object might hang from another ancestor now
+        transform_system->InvalidateHierarchy();
     }
 }
 
@@ -197,16 +386,50 @@ void engine::GameObject::MakeParent()
     SetParent(nullptr);
 }
 
-void engine::GameObject::SetName(const std::string& name)
+void engine::GameObject::SetName(std::string_view name)
 {
-    m_name = name;
+    NameId nameId = StringTable::GetInstance().Intern(name);
+    if (nameId == m_name)
+    {
+        return;
+    }
+
+    GameObjectManager& manager = GameObjectManager::GetInstance();
+    manager.UnindexName(this);
+    m_name = nameId;
+    manager.IndexName(this);
 }
 
-std::string engine::GameObject::GetName() const
+std::string_view engine::GameObject::GetName() const
+{
+    return StringTable::GetInstance().GetString(m_name);
+}
+
+engine::NameId engine::GameObject::GetNameId() const
 {
     return m_name;
 }
 
+bool engine::GameObject::HasComponent(engine::ComponentTypeId typeId) const
+{
+    return m_componentMask.Test(typeId);
+}
+
+engine::Component* engine::GameObject::GetComponent(engine::ComponentTypeId typeId) const
+{
+    if (m_componentMask.Test(typeId) == false)
+    {
+        return nullptr;
+    }
+
+    return m_componentSlots[ m_componentMask.CountBefore(typeId) ];
+}
+
+const engine::ComponentMask& engine::GameObject::GetComponentMask() const
+{
+    return m_componentMask;
+}
+
 const std::list<engine::Component*>& engine::GameObject::GetAllComponents() const
 {
     return m_components;
@@ -224,10 +447,15 @@ engine::Component* engine::GameObject::AddComponent(engine::Component* component
         throw std::runtime_error("Tried to add a component that is already owned by a game object");
     }
 
-    component->m_owner = this;
-    m_components.push_back(component);
+    ArchetypeStorage::GetInstance().CheckStructuralChange();
 
-    component->Create();
+    ComponentTypeId typeId = GetComponentTypeId(*component);
+    if (dynamic_cast<DataComponentBase*>(component) != nullptr && m_componentMask.Test(typeId))
+    {
+        throw std::runtime_error("Tried to add a second data component of the same type");
+    }
+
+    AttachComponent(component, nullptr, typeId);
 
     return component;
 }
@@ -244,10 +472,12 @@ void engine::GameObject::RemoveComponent(engine::Component* component)
         throw std::runtime_error("Tried to remove a component from a game object that does not own it");
     }
 
+    ArchetypeStorage::GetInstance().CheckStructuralChange();
+
     component->Shutdown();
 
+    UnindexComponent(component);
     m_components.remove(component);
 
-    // todo: memory manager
-    delete component;
+    DeleteComponent(component);
 }
\ No newline at end of file
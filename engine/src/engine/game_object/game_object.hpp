@@ -2,28 +2,86 @@
 #define GAME_OBJECT_HPP
 
 #include <list>
-#include <string>
+#include <string_view>
+#include <vector>
+
+#include "component_type.hpp"
+#include "handle.hpp"
+#include <engine/string/string_table.hpp>
 
 namespace engine
 {
+    class Archetype;
+    class ArchetypeStorage;
     class Component;
+    class DataComponentBase;
     class GameObjectManager;
+    class GameObject;
+    class MemoryManager;
+    class PoolAllocator;
 
-    class GameObject
+    // intrusive list of sibling game objects, linked through the objects themselves
+    struct GameObjectList
     {
-        friend class GameObjectManager;
+        GameObject* m_first;
+        GameObject* m_last;
+        size_t      m_count;
+
+        GameObjectList();
 
-        std::string            m_name;
-        GameObject*            m_parent;
-        std::list<GameObject*> m_children;
-        std::list<Component*>  m_components;
+        void PushBack(GameObject* object);
+        void Remove(GameObject* object);
+        void Clear();
+    };
 
-        GameObject(const std::string& name = "Game Object");
+    class GameObject
+    {
+        friend struct GameObjectList;
+        friend class ArchetypeStorage;
+        friend class DataComponentBase;
+        friend class GameObjectManager;
+        friend class MemoryManager;
+
+        NameId                m_name;
+        size_t                m_nameIndex; // position inside the name index of the game object manager
+        GameObjectHandle      m_handle;
+        GameObject*           m_parent;
+        GameObjectList        m_children;
+        GameObject*           m_previousSibling;
+        GameObject*           m_nextSibling;
+        std::list<Component*> m_components;
+
+        // the same children as m_children, for indexed access. removing a child moves the last one
+        // into its place, so the order only matches the sibling order until the first removal
+        std::vector<GameObject*> m_childArray;
+        size_t                   m_childIndex; // position inside the child array of the parent
+
+        // one bit per component type, plus the first component of each type ordered by type id
+        ComponentMask           m_componentMask;
+        std::vector<Component*> m_componentSlots;
+
+        // location inside the archetype storage, null while the object has no components
+        Archetype* m_archetype;
+        size_t     m_archetypeRow;
+
+        // set once the object is queued for destruction, or is being destroyed with an ancestor
+        bool   m_isPendingDestroy;
+        size_t m_killQueueIndex; // position inside the kill queue of the game object manager
+
+        GameObject(std::string_view name = "Game Object");
         GameObject(const GameObject& other)            = delete;
         GameObject& operator=(const GameObject& other) = delete;
 
-        void DestroyInternal();
         void DetachChild(GameObject* child);
+        void LinkChild(GameObject* child);
+        void UnlinkChild(GameObject* child);
+
+        static void DeleteComponent(Component* component);
+
+        void AttachComponent(Component* component, PoolAllocator* pool, ComponentTypeId typeId);
+
+        void IndexComponent(Component* component);
+        void UnindexComponent(Component* component);
 
         void ShutdownEvents();
 
@@ -31,27 +89,46 @@ namespace engine
         void Initialize();
         void Shutdown();
 
-        GameObject*                   AddChild(GameObject* child);
-        GameObject*                   CreateChild(const std::string& name = "Game Object");
-        void                          RemoveChild(GameObject* child);
-        const std::list<GameObject*>& GetChildren() const;
-        GameObject*                   GetChild(size_t index) const;
+        GameObjectHandle GetHandle() const;
+        bool             IsPendingDestroy() const;
+
+        GameObject*                     AddChild(GameObject* child);
+        GameObject*                     CreateChild(std::string_view name = "Game Object");
+        void                            RemoveChild(GameObject* child);
+        // unordered once a child has been removed. walk the siblings for the hierarchy order
+        const std::vector<GameObject*>& GetChildren() const;
+        GameObject*                     GetChild(size_t index) const;
+        size_t                          GetChildCount() const;
+
+        GameObject* GetFirstChild() const;
+        GameObject* GetLastChild() const;
+        GameObject* GetNextSibling() const;
+        GameObject* GetPreviousSibling() const;
 
         GameObject* GetParent() const;
         void        SetParent(GameObject* parent);
         void        MakeParent();
 
-        void        SetName(const std::string& name);
-        std::string GetName() const;
+        void             SetName(std::string_view name);
+        std::string_view GetName() const;
+        NameId           GetNameId() const;
 
         template <typename T>
         T* GetComponent() const;
 
+        template <typename T>
+        bool HasComponent() const;
+
+        bool                 HasComponent(ComponentTypeId typeId) const;
+        Component*           GetComponent(ComponentTypeId typeId) const;
+        const ComponentMask& GetComponentMask() const;
+
         template <typename T>
         std::list<T*> GetAllComponents() const;
 
         const std::list<Component*>& GetAllComponents() const;
 
+        // at most one data component of each type, see DataComponent
         template <typename T>
         T* AddComponent();
 
@@ -1,17 +1,22 @@
 #include "game_object.hpp"
 
+#include <stdexcept>
+
+#include "archetype_storage.hpp"
+#include "component.hpp"
+#include <engine/memory/memory_manager.hpp>
+
+// components are looked up by their exact type
 template <typename T>
 T* engine::GameObject::GetComponent() const
 {
-    for (Component* component : m_components)
-    {
-        if (T* castedComponent = dynamic_cast<T*>(component))
-        {
-            return castedComponent;
-        }
-    }
+    return static_cast<T*>(GetComponent(GetComponentTypeId<T>()));
+}
 
-    return nullptr;
+template <typename T>
+bool engine::GameObject::HasComponent() const
+{
+    return m_componentMask.Test(GetComponentTypeId<T>());
 }
 
 template <typename T>
@@ -19,11 +24,17 @@ std::list<T*> engine::GameObject::GetAllComponents() const
 {
     std::list<T*> components;
 
+    ComponentTypeId typeId = GetComponentTypeId<T>();
+    if (m_componentMask.Test(typeId) == false)
+    {
+        return components;
+    }
+
     for (Component* component : m_components)
     {
-        if (T* castedComponent = dynamic_cast<T*>(component))
+        if (component->m_typeId == typeId)
         {
-            components.push_back(castedComponent);
+            components.push_back(static_cast<T*>(component));
         }
     }
 
@@ -33,13 +44,21 @@ std::list<T*> engine::GameObject::GetAllComponents() const
 template <typename T>
 T* engine::GameObject::AddComponent()
 {
-    // todo: memory manager
-    T* component = new T {};
+    ArchetypeStorage::GetInstance().CheckStructuralChange();
+
+    // the inline data lives in the archetype row, which has room for one per type
+    if constexpr (HasInlineData<T>)
+    {
+        if (m_componentMask.Test(GetComponentTypeId<T>()))
+        {
+            throw std::runtime_error("Tried to add a second data component of the same type");
+        }
+    }
 
-    component->m_owner = this;
-    m_components.push_back(component);
+    MemoryManager& memoryManager = MemoryManager::GetInstance();
+    T*             component     = memoryManager.New<T>();
 
-    component->Create();
+    AttachComponent(component, &memoryManager.GetPool<T>(), GetComponentTypeId<T>());
 
     return component;
 }
@@ -54,24 +73,44 @@ void engine::GameObject::RemoveComponent()
         return;
     }
 
+    ArchetypeStorage::GetInstance().CheckStructuralChange();
+
     component->Shutdown();
 
+    UnindexComponent(component);
     m_components.remove(component);
 
-    // todo: memory manager
-    delete component;
+    DeleteComponent(component);
 }
 
 template <typename T>
 void engine::GameObject::RemoveAllComponents()
 {
-    for (T* component : m_components)
+    ComponentTypeId typeId = GetComponentTypeId<T>();
+    if (m_componentMask.Test(typeId) == false)
+    {
+        return;
+    }
+
+    ArchetypeStorage::GetInstance().CheckStructuralChange();
+
+    for (std::list<Component*>::iterator it = m_components.begin(); it != m_components.end();)
     {
+        Component* component = *it;
+        if (component->m_typeId != typeId)
+        {
+            it++;
+            continue;
+        }
+
         component->Shutdown();
+        it = m_components.erase(it);
 
-        // todo: memory manager
-        delete component;
+        DeleteComponent(component);
     }
 
-    m_components.clear();
+    m_componentSlots.erase(m_componentSlots.begin() + m_componentMask.CountBefore(typeId));
+    m_componentMask.Reset(typeId);
+
+    ArchetypeStorage::GetInstance().Refresh(this);
 }
\ No newline at end of file
@@ -1,8 +1,28 @@
 #include "game_object_manager.hpp"
 
-#include <stack>
-
+#include "archetype_storage.hpp"
+#include "component.hpp"
 #include "game_object.hpp"
+#include <memory/memory_manager.hpp>
+
+engine::GameObjectManager::GameObjectManager()
+    : m_rootGameObjects {}
+    , m_killQueue {}
+    , m_killQueueHead { 0 }
+    , m_destructionBudget { Constants::UNLIMITED_DESTRUCTION_BUDGET }
+    , m_teardownObjects {}
+    , m_teardownComponents {}
+    , m_gameObjectHandles {}
+    , m_componentHandles {}
+    , m_gameObjectsByName {}
+{
+}
+
+namespace
+{
+    // a stack, one buffer per traversal in progress on the thread
+    thread_local std::vector<std::vector<engine::GameObject*>> t_traversalBuffers;
+} // namespace
 
 engine::GameObjectManager& engine::GameObjectManager::GetInstance()
 {
@@ -10,59 +30,234 @@ engine::GameObjectManager& engine::GameObjectManager::GetInstance()
     return instance;
 }
 
+std::vector<engine::GameObject*> engine::GameObjectManager::BorrowTraversalBuffer()
+{
+    if (t_traversalBuffers.empty())
+    {
+        return std::vector<GameObject*> {};
+    }
+
+    std::vector<GameObject*> buffer = std::move(t_traversalBuffers.back());
+    t_traversalBuffers.pop_back();
+
+    buffer.clear();
+    return buffer;
+}
+
+void engine::GameObjectManager::ReturnTraversalBuffer(std::vector<engine::GameObject*>&& buffer)
+{
+    t_traversalBuffers.push_back(std::move(buffer));
+}
+
+bool engine::GameObjectManager::IsRootGameObject(engine::GameObject* object) const
+{
+    return object->m_parent == nullptr && (object->m_previousSibling != nullptr || m_rootGameObjects.m_first == object);
+}
+
 engine::GameObject* engine::GameObjectManager::AddGameObject(engine::GameObject* object)
 {
-    if (std::find(m_rootGameObjects.begin(), m_rootGameObjects.end(), object) != m_rootGameObjects.end())
+    if (IsRootGameObject(object))
     {
         throw std::runtime_error("Trying to add an object to the game object manager twice");
     }
 
-    m_rootGameObjects.push_back(object);
+    m_rootGameObjects.PushBack(object);
     return object;
 }
 
 void engine::GameObjectManager::RemoveRootGameObject(engine::GameObject* object)
 {
-    m_rootGameObjects.remove(object);
+    if (IsRootGameObject(object))
+    {
+        m_rootGameObjects.Remove(object);
+    }
+}
+
+engine::GameObject* engine::GameObjectManager::AllocateGameObject(std::string_view name)
+{
+    GameObjectManager& manager = GetInstance();
+
+    GameObject* object = MemoryManager::GetInstance().New<GameObject>(name);
+    object->m_handle   = manager.m_gameObjectHandles.Create(object);
+    manager.IndexName(object);
+
+    return object;
+}
+
+void engine::GameObjectManager::FreeGameObject(engine::GameObject* object)
+{
+    GameObjectManager& manager = GetInstance();
+
+    manager.UnindexName(object);
+    manager.m_gameObjectHandles.Release(object->m_handle);
+    MemoryManager::GetInstance().Delete(object);
+}
+
+void engine::GameObjectManager::IndexName(engine::GameObject* object)
+{
+    std::vector<GameObject*>& objects = m_gameObjectsByName[ object->m_name ];
+
+    object->m_nameIndex = objects.size();
+    objects.push_back(object);
+}
+
+void engine::GameObjectManager::UnindexName(engine::GameObject* object)
+{
+    std::unordered_map<NameId, std::vector<GameObject*>>::iterator it      = m_gameObjectsByName.find(object->m_name);
+    std::vector<GameObject*>&                                      objects = it->second;
+
+    // swap and pop
+    GameObject* last               = objects.back();
+    objects[ object->m_nameIndex ] = last;
+    last->m_nameIndex              = object->m_nameIndex;
+    objects.pop_back();
+
+    // so renamed and destroyed objects do not leave empty buckets behind
+    if (objects.empty())
+    {
+        m_gameObjectsByName.erase(it);
+    }
+}
+
+size_t engine::GameObjectManager::GatherForTeardown(engine::GameObject* root)
+{
+    size_t count = 0;
+
+    TraversePreOrder(root,
+        [ & ](GameObject* object)
+        {
+            // descendants that were queued on their own are destroyed here, drop their queue entry
+            if (object != root && object->m_isPendingDestroy)
+            {
+                m_killQueue[ object->m_killQueueIndex ] = nullptr;
+            }
+
+            object->m_isPendingDestroy = true;
+            m_teardownObjects.push_back(object);
+            count++;
+        });
+
+    return count;
+}
+
+void engine::GameObjectManager::TearDownGatheredObjects()
+{
+    // unhook every event first, so no component reacts to the others going away
+    for (GameObject* object : m_teardownObjects)
+    {
+        object->ShutdownEvents();
+    }
+
+    // shut components down grouped by type, so each kind of shutdown runs back to back
+    for (GameObject* object : m_teardownObjects)
+    {
+        m_teardownComponents.insert(m_teardownComponents.end(), object->m_components.begin(), object->m_components.end());
+    }
+
+    std::stable_sort(m_teardownComponents.begin(), m_teardownComponents.end(),
+        [](const Component* a, const Component* b)
+        {
+            return a->GetTypeId() < b->GetTypeId();
+        });
+
+    for (Component* component : m_teardownComponents)
+    {
+        component->Shutdown();
+    }
+
+    // free everything once no more callbacks can run. components are still grouped by type,
+    // so consecutive frees hit the same pool
+    ArchetypeStorage& storage = ArchetypeStorage::GetInstance();
+    for (GameObject* object : m_teardownObjects)
+    {
+        storage.Remove(object);
+    }
+
+    for (Component* component : m_teardownComponents)
+    {
+        GameObject::DeleteComponent(component);
+    }
+
+    for (GameObject* object : m_teardownObjects)
+    {
+        FreeGameObject(object);
+    }
+
+    m_teardownObjects.clear();
+    m_teardownComponents.clear();
 }
 
 void engine::GameObjectManager::Update()
 {
-    for (GameObject* object : m_gameObjectsMarkedAsDead)
+    size_t destroyedCount = 0;
+
+    while (m_killQueueHead < m_killQueue.size())
     {
-        GameObject* parent = object->GetParent();
+        if (m_destructionBudget != Constants::UNLIMITED_DESTRUCTION_BUDGET && destroyedCount >= m_destructionBudget)
+        {
+            break;
+        }
+
+        GameObject* object = m_killQueue[ m_killQueueHead++ ];
+
+        // already destroyed together with an ancestor
+        if (object == nullptr)
+        {
+            continue;
+        }
+
+        GameObject* parent = object->m_parent;
         if (parent == nullptr)
         {
-            m_rootGameObjects.remove(object);
+            RemoveRootGameObject(object);
         }
         else
         {
-            parent->m_children.remove(object);
+            parent->UnlinkChild(object);
+            object->m_parent = nullptr;
         }
 
-        object->DestroyInternal();
+        destroyedCount += GatherForTeardown(object);
     }
 
-    m_gameObjectsMarkedAsDead.clear();
+    if (m_teardownObjects.empty() == false)
+    {
+        TearDownGatheredObjects();
+    }
+
+    // drop the processed entries, components may have queued more objects while shutting down
+    if (m_killQueueHead == m_killQueue.size())
+    {
+        m_killQueue.clear();
+        m_killQueueHead = 0;
+    }
+    else if (m_killQueueHead * 2 >= m_killQueue.size())
+    {
+        m_killQueue.erase(m_killQueue.begin(), m_killQueue.begin() + m_killQueueHead);
+        m_killQueueHead = 0;
+
+        for (size_t i = 0; i < m_killQueue.size(); i++)
+        {
+            if (m_killQueue[ i ] != nullptr)
+            {
+                m_killQueue[ i ]->m_killQueueIndex = i;
+            }
+        }
+    }
 }
 
 void engine::GameObjectManager::Shutdown()
 {
-    for (GameObject* object : m_rootGameObjects)
+    for (GameObject* object = m_rootGameObjects.m_first; object != nullptr; object = object->m_nextSibling)
     {
-        object->ShutdownEvents();
+        GatherForTeardown(object);
     }
 
-    for (GameObject* object : m_rootGameObjects)
-    {
-        object->DestroyInternal();
-
-        // todo: memory manager!
-        delete object;
-    }
+    m_rootGameObjects.Clear();
+    m_killQueue.clear();
+    m_killQueueHead = 0;
 
-    m_rootGameObjects.clear();
-    m_gameObjectsMarkedAsDead.clear();
+    TearDownGatheredObjects();
 }
 
 void engine::GameObjectManager::DestroyGameObject(engine::GameObject* object)
@@ -73,10 +268,49 @@ void engine::GameObjectManager::DestroyGameObject(engine::GameObject* object)
     }
 
     // do not add an object twice
-    if (std::find(m_gameObjectsMarkedAsDead.begin(), m_gameObjectsMarkedAsDead.end(), object) == m_gameObjectsMarkedAsDead.end())
+    if (object->m_isPendingDestroy)
     {
-        m_gameObjectsMarkedAsDead.push_back(object);
+        return;
     }
+
+    object->m_isPendingDestroy = true;
+    object->m_killQueueIndex   = m_killQueue.size();
+    m_killQueue.push_back(object);
+}
+
+void engine::GameObjectManager::SetDestructionBudget(size_t budget)
+{
+    m_destructionBudget = budget;
+}
+
+size_t engine::GameObjectManager::GetDestructionBudget() const
+{
+    return m_destructionBudget;
+}
+
+size_t engine::GameObjectManager::GetPendingDestroyCount() const
+{
+    return m_killQueue.size() - m_killQueueHead;
+}
+
+engine::GameObject* engine::GameObjectManager::Resolve(engine::GameObjectHandle handle) const
+{
+    return m_gameObjectHandles.Resolve(handle);
+}
+
+engine::Component* engine::GameObjectManager::Resolve(engine::ComponentHandle handle) const
+{
+    return m_componentHandles.Resolve(handle);
+}
+
+bool engine::GameObjectManager::IsValid(engine::GameObjectHandle handle) const
+{
+    return m_gameObjectHandles.IsValid(handle);
+}
+
+bool engine::GameObjectManager::IsValid(engine::ComponentHandle handle) const
+{
+    return m_componentHandles.IsValid(handle);
 }
 
 engine::GameObject* engine::GameObjectManager::CreateGameObject(const char* name)
@@ -86,9 +320,8 @@ engine::GameObject* engine::GameObjectManager::CreateGameObject(const char* name
         throw std::runtime_error("Tried to create a game object with a null name");
     }
 
-    // todo: memory manager
-    GameObject* newObject = new GameObject { name };
-    m_rootGameObjects.push_back(newObject);
+    GameObject* newObject = AllocateGameObject(name);
+    m_rootGameObjects.PushBack(newObject);
     return newObject;
 }
 
@@ -98,82 +331,39 @@ engine::GameObject* engine::GameObjectManager::FindGameObjectByName(const char*
     {
         throw std::runtime_error("Null name provided to search for a game object");
     }
-    
-    GameObject* foundObject = nullptr;
 
-    TraverseGameObjectsPreOrder(
-        [ & ](GameObject* object)
-        {
-            if (object->GetName() == name)
-            {
-                foundObject = object;
-                return false; // stop searching
-            }
-
-            return true;
-        });
+    // a name that was never interned can not belong to any object
+    return FindGameObjectByName(StringTable::GetInstance().Find(name));
+}
 
-    return foundObject;
+engine::GameObject* engine::GameObjectManager::FindGameObjectByName(engine::NameId name) const
+{
+    std::span<GameObject* const> objects = FindAllGameObjectsWithName(name);
+    return objects.empty() ? nullptr : objects.front();
 }
 
-std::list<engine::GameObject*> engine::GameObjectManager::FindAllGameObjectsWithName(const char* name) const
+std::span<engine::GameObject* const> engine::GameObjectManager::FindAllGameObjectsWithName(const char* name) const
 {
     if (name == nullptr)
     {
         throw std::runtime_error("Null name provided to search for a game object");
     }
-    
-    std::list<engine::GameObject*> foundObjects;
-
-    TraverseGameObjectsPreOrder(
-        [ & ](GameObject* object)
-        {
-            if (object->GetName() == name)
-            {
-                foundObjects.push_back(object);
-            }
-
-            return true;
-        });
 
-    return foundObjects;
+    return FindAllGameObjectsWithName(StringTable::GetInstance().Find(name));
 }
 
-void engine::GameObjectManager::ForEachRootGameObject(const std::function<void(GameObject*)>& func) const
+std::span<engine::GameObject* const> engine::GameObjectManager::FindAllGameObjectsWithName(engine::NameId name) const
 {
-    for (GameObject* gameObject : m_rootGameObjects)
+    std::unordered_map<NameId, std::vector<GameObject*>>::const_iterator it = m_gameObjectsByName.find(name);
+    if (it == m_gameObjectsByName.end())
     {
-        func(gameObject);
+        return {};
     }
+
+    return it->second;
 }
 
-void engine::GameObjectManager::TraverseGameObjectsPreOrder(const std::function<bool(GameObject*)>& func) const
+size_t engine::GameObjectManager::GetRootGameObjectCount() const
 {
-    std::stack<GameObject*> stack;
-
-    // add root objects in reverse order
-    for (std::list<GameObject*>::const_reverse_iterator it = m_rootGameObjects.rbegin(); it != m_rootGameObjects.rend(); it++)
-    {
-        stack.push(*it);
-    }
-
-    while (stack.empty() == false)
-    {
-        GameObject* current = stack.top();
-        stack.pop();
-
-        // call the function
-        bool shouldKeepIterating = func(current);
-        if (shouldKeepIterating == false)
-        {
-            return;
-        }
-
-        // add children in reverse order
-        const std::list<GameObject*>& children = current->GetChildren();
-        for (std::list<GameObject*>::const_reverse_iterator it = children.rbegin(); it != children.rend(); it++)
-        {
-            stack.push(*it);
-        }
-    }
+    return m_rootGameObjects.m_count;
 }
\ No newline at end of file
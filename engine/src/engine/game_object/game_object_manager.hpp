@@ -1,43 +1,146 @@
 #ifndef GAME_OBJECT_MANAGER_HPP
 #define GAME_OBJECT_MANAGER_HPP
 
-#include <functional>
-#include <list>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "game_object.hpp"
+#include "handle.hpp"
 
 namespace engine
 {
-    class GameObject;
-
     class GameObjectManager
     {
         friend class GameObject;
 
-        std::list<GameObject*> m_rootGameObjects;
-        std::list<GameObject*> m_gameObjectsMarkedAsDead;
+      public:
+        struct Constants
+        {
+            static constexpr size_t UNLIMITED_DESTRUCTION_BUDGET = 0;
+        };
+
+      private:
+        GameObjectList m_rootGameObjects;
+
+        // objects waiting to be destroyed, in request order. entries become null when the
+        // object is destroyed together with an ancestor
+        std::vector<GameObject*> m_killQueue;
+        size_t                   m_killQueueHead; // first entry that was not processed yet
+        size_t                   m_destructionBudget;
+
+        // scratch buffers reused by every teardown
+        std::vector<GameObject*> m_teardownObjects;
+        std::vector<Component*>  m_teardownComponents;
+
+        HandleTable<GameObject> m_gameObjectHandles;
+        HandleTable<Component>  m_componentHandles;
 
-        GameObjectManager()                                    = default;
+        // every live game object, grouped by name
+        std::unordered_map<NameId, std::vector<GameObject*>> m_gameObjectsByName;
+
+        GameObjectManager();
         ~GameObjectManager()                                   = default;
         GameObjectManager(const GameObjectManager&)            = delete;
         GameObjectManager& operator=(const GameObjectManager&) = delete;
 
+        bool        IsRootGameObject(GameObject* object) const;
         GameObject* AddGameObject(GameObject* object);
         void        RemoveRootGameObject(GameObject* object);
 
+        static GameObject* AllocateGameObject(std::string_view name);
+        static void        FreeGameObject(GameObject* object);
+
+        void IndexName(GameObject* object);
+        void UnindexName(GameObject* object);
+
+        size_t GatherForTeardown(GameObject* root);
+        void   TearDownGatheredObjects();
+
+        template <typename Func>
+        static bool Visit(Func& func, GameObject* object);
+
+        // per thread buffers for the traversals, so that concurrent and nested traversals each
+        // get their own and steady traversals do not allocate
+        static std::vector<GameObject*> BorrowTraversalBuffer();
+        static void                     ReturnTraversalBuffer(std::vector<GameObject*>&& buffer);
+
+        // visits the queued objects, appending their children as it goes
+        template <typename Func>
+        static bool BreadthFirst(std::vector<GameObject*>& queue, Func& func);
+
       public:
         static GameObjectManager& GetInstance();
 
         void Update();
         void Shutdown();
 
+        // the object and its children are destroyed during the next updates. destroying an
+        // object twice is a no-op
         void DestroyGameObject(GameObject* object);
 
-        GameObject*            CreateGameObject(const char* name = "Game Object");
-        GameObject*            FindGameObjectByName(const char* name) const;
-        std::list<GameObject*> FindAllGameObjectsWithName(const char* name) const;
+        // maximum number of game objects destroyed by a single update. a subtree is never split,
+        // so at least one queued object is destroyed every update regardless of the budget
+        void   SetDestructionBudget(size_t budget);
+        size_t GetDestructionBudget() const;
+        size_t GetPendingDestroyCount() const; // queued requests, including objects already destroyed with an ancestor
 
-        void ForEachRootGameObject(const std::function<void(GameObject*)>& func) const;
-        void TraverseGameObjectsPreOrder(const std::function<bool(GameObject*)>& func) const;
+        // handles resolve to null once their object has been destroyed
+        GameObject* Resolve(GameObjectHandle handle) const;
+        Component*  Resolve(ComponentHandle handle) const;
+        bool        IsValid(GameObjectHandle handle) const;
+        bool        IsValid(ComponentHandle handle) const;
+
+        // null if the handle is stale or the component is not exactly of type T
+        template <typename T>
+        T* Resolve(ComponentHandle handle) const;
+
+        GameObject* CreateGameObject(const char* name = "Game Object");
+
+        // name lookups are a hash lookup. when several objects share a name, which one is returned is unspecified.
+        // the span returned by FindAllGameObjectsWithName points into the index, so it is only valid until the next
+        // creation, rename or destruction of an object with that name. copy it if the scene changes while using it
+        GameObject*                  FindGameObjectByName(const char* name) const;
+        GameObject*                  FindGameObjectByName(NameId name) const;
+        std::span<GameObject* const> FindAllGameObjectsWithName(const char* name) const;
+        std::span<GameObject* const> FindAllGameObjectsWithName(NameId name) const;
+
+        size_t GetRootGameObjectCount() const;
+
+        // visitors are called as func(object). they can return void, or a bool where false stops the
+        // traversal, in which case the traversal returns false. the hierarchy must not change while
+        // it is traversed, destroying objects is fine since destruction is deferred
+        template <typename Func>
+        void ForEachRootGameObject(Func&& func) const;
+
+        template <typename Func>
+        bool TraverseGameObjectsPreOrder(Func&& func) const;
+
+        template <typename Func>
+        bool TraverseGameObjectsPostOrder(Func&& func) const;
+
+        template <typename Func>
+        bool TraverseGameObjectsBreadthFirst(Func&& func) const;
+
+        // same traversals, limited to the subtree of root, root included
+        template <typename Func>
+        static bool TraversePreOrder(GameObject* root, Func&& func);
+
+        template <typename Func>
+        static bool TraversePostOrder(GameObject* root, Func&& func);
+
+        template <typename Func>
+        bool TraverseBreadthFirst(GameObject* root, Func&& func) const;
+
+        // pre-order traversal with the root subtrees spread over the job system workers. the
+        // order between subtrees is unspecified and func must be safe to call from several
+        // threads at once. returning false only stops the current subtree
+        template <typename Func>
+        void ParallelTraverseGameObjectsPreOrder(Func&& func) const;
     };
 } // namespace engine
 
+#include "game_object_manager.inl"
+
 #endif
\ No newline at end of file
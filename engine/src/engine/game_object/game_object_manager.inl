@@ -0,0 +1,205 @@
+#include "game_object_manager.hpp"
+
+#include <type_traits>
+
+#include "component.hpp"
+#include <engine/job/job_system.hpp>
+
+template <typename T>
+T* engine::GameObjectManager::Resolve(engine::ComponentHandle handle) const
+{
+    Component* component = m_componentHandles.Resolve(handle);
+    if (component == nullptr || component->GetTypeId() != GetComponentTypeId<T>())
+    {
+        return nullptr;
+    }
+
+    return static_cast<T*>(component);
+}
+
+template <typename Func>
+bool engine::GameObjectManager::Visit(Func& func, engine::GameObject* object)
+{
+    if constexpr (std::is_void_v<std::invoke_result_t<Func&, GameObject*>>)
+    {
+        func(object);
+        return true;
+    }
+    else
+    {
+        return static_cast<bool>(func(object));
+    }
+}
+
+template <typename Func>
+void engine::GameObjectManager::ForEachRootGameObject(Func&& func) const
+{
+    for (GameObject* root = m_rootGameObjects.m_first; root != nullptr; root = root->m_nextSibling)
+    {
+        func(root);
+    }
+}
+
+template <typename Func>
+bool engine::GameObjectManager::TraversePreOrder(engine::GameObject* root, Func&& func)
+{
+    // walks the sibling links, no stack needed
+    GameObject* object = root;
+    while (object != nullptr)
+    {
+        if (Visit(func, object) == false)
+        {
+            return false;
+        }
+
+        if (object->m_children.m_first != nullptr)
+        {
+            object = object->m_children.m_first;
+            continue;
+        }
+
+        while (object != root && object->m_nextSibling == nullptr)
+        {
+            object = object->m_parent;
+        }
+
+        object = (object == root) ? nullptr : object->m_nextSibling;
+    }
+
+    return true;
+}
+
+template <typename Func>
+bool engine::GameObjectManager::TraversePostOrder(engine::GameObject* root, Func&& func)
+{
+    GameObject* object = root;
+    while (object->m_children.m_first != nullptr)
+    {
+        object = object->m_children.m_first;
+    }
+
+    while (true)
+    {
+        if (Visit(func, object) == false)
+        {
+            return false;
+        }
+
+        if (object == root)
+        {
+            return true;
+        }
+
+        // next sibling subtree starts at its deepest first child, otherwise the parent is next
+        if (object->m_nextSibling != nullptr)
+        {
+            object = object->m_nextSibling;
+            while (object->m_children.m_first != nullptr)
+            {
+                object = object->m_children.m_first;
+            }
+        }
+        else
+        {
+            object = object->m_parent;
+        }
+    }
+}
+
+template <typename Func>
+bool engine::GameObjectManager::BreadthFirst(std::vector<engine::GameObject*>& queue, Func& func)
+{
+    // the queue is never popped, objects stay in place and head walks over them
+    for (size_t head = 0; head < queue.size(); head++)
+    {
+        GameObject* object = queue[ head ];
+        if (Visit(func, object) == false)
+        {
+            return false;
+        }
+
+        for (GameObject* child = object->m_children.m_first; child != nullptr; child = child->m_nextSibling)
+        {
+            queue.push_back(child);
+        }
+    }
+
+    return true;
+}
+
+template <typename Func>
+bool engine::GameObjectManager::TraverseBreadthFirst(engine::GameObject* root, Func&& func) const
+{
+    std::vector<GameObject*> queue = BorrowTraversalBuffer();
+    queue.push_back(root);
+
+    bool completed = BreadthFirst(queue, func);
+
+    ReturnTraversalBuffer(std::move(queue));
+    return completed;
+}
+
+template <typename Func>
+bool engine::GameObjectManager::TraverseGameObjectsPreOrder(Func&& func) const
+{
+    for (GameObject* root = m_rootGameObjects.m_first; root != nullptr; root = root->m_nextSibling)
+    {
+        if (TraversePreOrder(root, func) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename Func>
+bool engine::GameObjectManager::TraverseGameObjectsPostOrder(Func&& func) const
+{
+    for (GameObject* root = m_rootGameObjects.m_first; root != nullptr; root = root->m_nextSibling)
+    {
+        if (TraversePostOrder(root, func) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename Func>
+bool engine::GameObjectManager::TraverseGameObjectsBreadthFirst(Func&& func) const
+{
+    std::vector<GameObject*> queue = BorrowTraversalBuffer();
+
+    for (GameObject* root = m_rootGameObjects.m_first; root != nullptr; root = root->m_nextSibling)
+    {
+        queue.push_back(root);
+    }
+
+    bool completed = BreadthFirst(queue, func);
+
+    ReturnTraversalBuffer(std::move(queue));
+    return completed;
+}
+
+template <typename Func>
+void engine::GameObjectManager::ParallelTraverseGameObjectsPreOrder(Func&& func) const
+{
+    // roots are independent subtrees, each one becomes a unit of work that idle workers can steal
+    std::vector<GameObject*> roots = BorrowTraversalBuffer();
+
+    for (GameObject* root = m_rootGameObjects.m_first; root != nullptr; root = root->m_nextSibling)
+    {
+        roots.push_back(root);
+    }
+
+    JobSystem::GetInstance().ParallelFor(0, roots.size(),
+        [ & ](size_t index)
+        {
+            TraversePreOrder(roots[ index ], func);
+        },
+        1);
+
+    ReturnTraversalBuffer(std::move(roots));
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#ifndef HANDLE_HPP
+#define HANDLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine
+{
+    // weak reference to an object owned by a handle table. a handle is plain data: it can be
+    // copied across threads or serialized as is, and resolving it after the object was
+    // destroyed yields null instead of a dangling pointer
+    template <typename T>
+    struct Handle
+    {
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        uint32_t m_index;
+        uint32_t m_generation;
+
+        constexpr Handle()
+            : m_index { INVALID_INDEX }
+            , m_generation { 0 }
+        {
+        }
+
+        constexpr Handle(uint32_t index, uint32_t generation)
+            : m_index { index }
+            , m_generation { generation }
+        {
+        }
+
+        constexpr bool IsNull() const
+        {
+            return m_index == INVALID_INDEX;
+        }
+
+        constexpr uint64_t ToBits() const
+        {
+            return (static_cast<uint64_t>(m_generation) << 32) | m_index;
+        }
+
+        static constexpr Handle FromBits(uint64_t bits)
+        {
+            return Handle { static_cast<uint32_t>(bits), static_cast<uint32_t>(bits >> 32) };
+        }
+
+        constexpr bool operator==(const Handle& other) const
+        {
+            return m_index == other.m_index && m_generation == other.m_generation;
+        }
+
+        constexpr bool operator!=(const Handle& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    class Component;
+    class GameObject;
+
+    using GameObjectHandle = Handle<GameObject>;
+    using ComponentHandle  = Handle<Component>;
+
+    // slots are reused after release, bumping their generation so that old handles stop resolving
+    template <typename T>
+    class HandleTable
+    {
+        struct Slot
+        {
+            T*       m_object;
+            uint32_t m_generation;
+            uint32_t m_nextFree;
+        };
+
+        std::vector<Slot> m_slots;
+        uint32_t          m_firstFree;
+        size_t            m_count;
+
+      public:
+        HandleTable();
+
+        Handle<T> Create(T* object);
+        void      Release(Handle<T> handle);
+
+        T*   Resolve(Handle<T> handle) const;
+        bool IsValid(Handle<T> handle) const;
+
+        size_t GetCount() const;
+    };
+} // namespace engine
+
+#include "handle.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "handle.hpp"
+
+#include <stdexcept>
+
+template <typename T>
+engine::HandleTable<T>::HandleTable()
+    : m_slots {}
+    , m_firstFree { Handle<T>::INVALID_INDEX }
+    , m_count { 0 }
+{
+}
+
+template <typename T>
+engine::Handle<T> engine::HandleTable<T>::Create(T* object)
+{
+    if (object == nullptr)
+    {
+        throw std::runtime_error("Tried to create a handle to a null object");
+    }
+
+    uint32_t index = m_firstFree;
+    if (index != Handle<T>::INVALID_INDEX)
+    {
+        m_firstFree = m_slots[ index ].m_nextFree;
+    }
+    else
+    {
+        if (m_slots.size() >= Handle<T>::INVALID_INDEX)
+        {
+            throw std::runtime_error("Handle table is full");
+        }
+
+        // generation 0 is never handed out
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.push_back(Slot { nullptr, 1, Handle<T>::INVALID_INDEX });
+    }
+
+    Slot& slot      = m_slots[ index ];
+    slot.m_object   = object;
+    slot.m_nextFree = Handle<T>::INVALID_INDEX;
+    m_count++;
+
+    return Handle<T> { index, slot.m_generation };
+}
+
+template <typename T>
+void engine::HandleTable<T>::Release(engine::Handle<T> handle)
+{
+    if (IsValid(handle) == false)
+    {
+        return;
+    }
+
+    Slot& slot    = m_slots[ handle.m_index ];
+    slot.m_object = nullptr;
+
+    // skip generation 0 when wrapping around
+    slot.m_generation++;
+    if (slot.m_generation == 0)
+    {
+        slot.m_generation = 1;
+    }
+
+    slot.m_nextFree = m_firstFree;
+    m_firstFree     = handle.m_index;
+    m_count--;
+}
+
+template <typename T>
+T* engine::HandleTable<T>::Resolve(engine::Handle<T> handle) const
+{
+    if (handle.m_index >= m_slots.size())
+    {
+        return nullptr;
+    }
+
+    const Slot& slot = m_slots[ handle.m_index ];
+    return slot.m_generation == handle.m_generation ? slot.m_object : nullptr;
+}
+
+template <typename T>
+bool engine::HandleTable<T>::IsValid(engine::Handle<T> handle) const
+{
+    return Resolve(handle) != nullptr;
+}
+
+template <typename T>
+size_t engine::HandleTable<T>::GetCount() const
+{
+    return m_count;
+}
\ No newline at end of file
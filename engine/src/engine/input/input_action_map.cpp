@@ -0,0 +1,366 @@
+#include "input_action_map.hpp"
+
+#include <cctype> // tolower
+#include <stdexcept>
+
+#include <SDL3/SDL.h>
+
+#include "input_manager.hpp"
+
+namespace
+{
+    size_t GetWordCount(size_t bitCount)
+    {
+        return (bitCount + 63) / 64;
+    }
+
+    // key codes become scancodes with the current keyboard layout
+    engine::InputBinding ResolveKeyCode(engine::InputBinding binding)
+    {
+        if (binding.m_type == engine::InputBinding::Type::KeyCode)
+        {
+            SDL_Keycode keyCode = static_cast<SDL_Keycode>(std::tolower(static_cast<int>(binding.m_code)));
+
+            binding.m_type = engine::InputBinding::Type::Keyboard;
+            binding.m_code = static_cast<size_t>(SDL_GetScancodeFromKey(keyCode, nullptr));
+        }
+
+        return binding;
+    }
+
+    bool IsButtonPressed(const engine::InputManager& input, const engine::InputBinding& binding)
+    {
+        switch (binding.m_type)
+        {
+            case engine::InputBinding::Type::Keyboard:
+                return binding.m_code < engine::KeyboardBits::Constants::BIT_COUNT && input.GetKeyboardState().Test(binding.m_code);
+            case engine::InputBinding::Type::Mouse:
+                return input.GetMouseState().Test(binding.m_code);
+            case engine::InputBinding::Type::Controller:
+                return input.IsControllerConnected() && input.GetControllerState().Test(binding.m_code);
+            case engine::InputBinding::Type::KeyCode:
+            case engine::InputBinding::Type::ControllerAxis:
+                break;
+        }
+
+        return false;
+    }
+} // namespace
+
+engine::InputActionMap::InputActionMap()
+    : m_actions {}
+    , m_axes {}
+    , m_actionsByName {}
+    , m_axesByName {}
+    , m_resolvedActions {}
+    , m_resolvedThresholds {}
+    , m_resolvedAxes {}
+    , m_resolvedAxisBindings {}
+    , m_isDirty { false }
+    , m_pressedActions {}
+    , m_previousActions {}
+    , m_triggeredActions {}
+    , m_releasedActions {}
+    , m_axisValues {}
+{
+}
+
+engine::InputActionId engine::InputActionMap::CreateAction(std::string_view name)
+{
+    NameId nameId = StringTable::GetInstance().Intern(name);
+
+    std::unordered_map<NameId, InputActionId>::const_iterator it = m_actionsByName.find(nameId);
+    if (it != m_actionsByName.end())
+    {
+        return it->second;
+    }
+
+    InputActionId action = static_cast<InputActionId>(m_actions.size());
+    m_actions.push_back(Action { nameId, {} });
+    m_actionsByName.emplace(nameId, action);
+
+    // the state grows now, so that the new action can be queried before the next update
+    size_t wordCount = GetWordCount(m_actions.size());
+    m_pressedActions.resize(wordCount, 0);
+    m_previousActions.resize(wordCount, 0);
+    m_triggeredActions.resize(wordCount, 0);
+    m_releasedActions.resize(wordCount, 0);
+
+    m_isDirty = true;
+
+    return action;
+}
+
+engine::InputAxisId engine::InputActionMap::CreateAxis(std::string_view name)
+{
+    NameId nameId = StringTable::GetInstance().Intern(name);
+
+    std::unordered_map<NameId, InputAxisId>::const_iterator it = m_axesByName.find(nameId);
+    if (it != m_axesByName.end())
+    {
+        return it->second;
+    }
+
+    InputAxisId axis = static_cast<InputAxisId>(m_axes.size());
+    m_axes.push_back(Action { nameId, {} });
+    m_axesByName.emplace(nameId, axis);
+    m_axisValues.push_back(0.0f);
+
+    m_isDirty = true;
+
+    return axis;
+}
+
+engine::InputActionId engine::InputActionMap::FindAction(std::string_view name) const
+{
+    std::unordered_map<NameId, InputActionId>::const_iterator it = m_actionsByName.find(StringTable::GetInstance().Find(name));
+    return it != m_actionsByName.end() ? it->second : Constants::INVALID_ACTION;
+}
+
+engine::InputAxisId engine::InputActionMap::FindAxis(std::string_view name) const
+{
+    std::unordered_map<NameId, InputAxisId>::const_iterator it = m_axesByName.find(StringTable::GetInstance().Find(name));
+    return it != m_axesByName.end() ? it->second : Constants::INVALID_AXIS;
+}
+
+size_t engine::InputActionMap::GetActionCount() const
+{
+    return m_actions.size();
+}
+
+size_t engine::InputActionMap::GetAxisCount() const
+{
+    return m_axes.size();
+}
+
+void engine::InputActionMap::Bind(std::vector<engine::InputActionMap::Action>& targets, uint32_t id, engine::InputBinding binding)
+{
+    if (id >= targets.size())
+    {
+        throw std::runtime_error("Tried to bind an input to an action or axis that does not exist");
+    }
+
+    targets[ id ].m_bindings.push_back(binding);
+    m_isDirty = true;
+}
+
+void engine::InputActionMap::BindAction(engine::InputActionId action, engine::Keyboard key)
+{
+    Bind(m_actions, action, InputBinding { InputBinding::Type::Keyboard, static_cast<size_t>(key), 0.0f });
+}
+
+void engine::InputActionMap::BindAction(engine::InputActionId action, int keyCode)
+{
+    Bind(m_actions, action, InputBinding { InputBinding::Type::KeyCode, static_cast<size_t>(keyCode), 0.0f });
+}
+
+void engine::InputActionMap::BindAction(engine::InputActionId action, engine::Mouse button)
+{
+    Bind(m_actions, action, InputBinding { InputBinding::Type::Mouse, static_cast<size_t>(button), 0.0f });
+}
+
+void engine::InputActionMap::BindAction(engine::InputActionId action, engine::Controller button)
+{
+    Bind(m_actions, action, InputBinding { InputBinding::Type::Controller, static_cast<size_t>(button), 0.0f });
+}
+
+void engine::InputActionMap::BindAction(engine::InputActionId action, engine::ControllerAxis axis, float threshold)
+{
+    if (threshold == 0.0f)
+    {
+        throw std::runtime_error("Tried to bind a controller axis to an action with a threshold of 0");
+    }
+
+    Bind(m_actions, action, InputBinding { InputBinding::Type::ControllerAxis, static_cast<size_t>(axis), threshold });
+}
+
+void engine::InputActionMap::BindAxis(engine::InputAxisId axis, engine::ControllerAxis controllerAxis, float scale)
+{
+    Bind(m_axes, axis, InputBinding { InputBinding::Type::ControllerAxis, static_cast<size_t>(controllerAxis), scale });
+}
+
+void engine::InputActionMap::BindAxis(engine::InputAxisId axis, engine::Keyboard key, float value)
+{
+    Bind(m_axes, axis, InputBinding { InputBinding::Type::Keyboard, static_cast<size_t>(key), value });
+}
+
+void engine::InputActionMap::BindAxis(engine::InputAxisId axis, int keyCode, float value)
+{
+    Bind(m_axes, axis, InputBinding { InputBinding::Type::KeyCode, static_cast<size_t>(keyCode), value });
+}
+
+void engine::InputActionMap::BindAxis(engine::InputAxisId axis, engine::Mouse button, float value)
+{
+    Bind(m_axes, axis, InputBinding { InputBinding::Type::Mouse, static_cast<size_t>(button), value });
+}
+
+void engine::InputActionMap::BindAxis(engine::InputAxisId axis, engine::Controller button, float value)
+{
+    Bind(m_axes, axis, InputBinding { InputBinding::Type::Controller, static_cast<size_t>(button), value });
+}
+
+void engine::InputActionMap::ClearActionBindings(engine::InputActionId action)
+{
+    m_actions.at(action).m_bindings.clear();
+    m_isDirty = true;
+}
+
+void engine::InputActionMap::ClearAxisBindings(engine::InputAxisId axis)
+{
+    m_axes.at(axis).m_bindings.clear();
+    m_isDirty = true;
+}
+
+const std::vector<engine::InputBinding>& engine::InputActionMap::GetActionBindings(engine::InputActionId action) const
+{
+    return m_actions.at(action).m_bindings;
+}
+
+const std::vector<engine::InputBinding>& engine::InputActionMap::GetAxisBindings(engine::InputAxisId axis) const
+{
+    return m_axes.at(axis).m_bindings;
+}
+
+void engine::InputActionMap::Resolve()
+{
+    m_resolvedActions.resize(m_actions.size());
+    m_resolvedThresholds.clear();
+
+    for (size_t i = 0; i < m_actions.size(); i++)
+    {
+        ResolvedAction& resolved = m_resolvedActions[ i ];
+        resolved.m_keys.Clear();
+        resolved.m_mouseButtons.Clear();
+        resolved.m_controllerButtons.Clear();
+        resolved.m_thresholdBegin = static_cast<uint32_t>(m_resolvedThresholds.size());
+
+        for (const InputBinding& source : m_actions[ i ].m_bindings)
+        {
+            InputBinding binding = ResolveKeyCode(source);
+
+            switch (binding.m_type)
+            {
+                case InputBinding::Type::Keyboard:
+                    // unknown key codes resolve to scancode 0, which is never pressed
+                    if (binding.m_code < KeyboardBits::Constants::BIT_COUNT)
+                    {
+                        resolved.m_keys.Set(binding.m_code, true);
+                    }
+                    break;
+                case InputBinding::Type::Mouse:
+                    resolved.m_mouseButtons.Set(binding.m_code, true);
+                    break;
+                case InputBinding::Type::Controller:
+                    resolved.m_controllerButtons.Set(binding.m_code, true);
+                    break;
+                case InputBinding::Type::ControllerAxis:
+                    m_resolvedThresholds.push_back(binding);
+                    break;
+                case InputBinding::Type::KeyCode:
+                    break;
+            }
+        }
+
+        resolved.m_thresholdEnd = static_cast<uint32_t>(m_resolvedThresholds.size());
+    }
+
+    m_resolvedAxes.resize(m_axes.size());
+    m_resolvedAxisBindings.clear();
+
+    for (size_t i = 0; i < m_axes.size(); i++)
+    {
+        m_resolvedAxes[ i ].m_begin = static_cast<uint32_t>(m_resolvedAxisBindings.size());
+
+        for (const InputBinding& source : m_axes[ i ].m_bindings)
+        {
+            m_resolvedAxisBindings.push_back(ResolveKeyCode(source));
+        }
+
+        m_resolvedAxes[ i ].m_end = static_cast<uint32_t>(m_resolvedAxisBindings.size());
+    }
+
+    m_isDirty = false;
+}
+
+void engine::InputActionMap::Update(const engine::InputManager& input)
+{
+    if (m_isDirty)
+    {
+        Resolve();
+    }
+
+    m_previousActions.swap(m_pressedActions);
+    std::fill(m_pressedActions.begin(), m_pressedActions.end(), 0);
+
+    const KeyboardBits&   keyboard           = input.GetKeyboardState();
+    const MouseBits&      mouse              = input.GetMouseState();
+    const ControllerBits& controller         = input.GetControllerState();
+    bool                  isControllerActive = input.IsControllerConnected();
+
+    for (size_t i = 0; i < m_resolvedActions.size(); i++)
+    {
+        const ResolvedAction& action = m_resolvedActions[ i ];
+
+        bool isPressed = action.m_keys.Intersects(keyboard) || action.m_mouseButtons.Intersects(mouse) || (isControllerActive && action.m_controllerButtons.Intersects(controller));
+
+        for (uint32_t j = action.m_thresholdBegin; j < action.m_thresholdEnd && !isPressed; j++)
+        {
+            const InputBinding& threshold = m_resolvedThresholds[ j ];
+            float               value     = input.GetAxis(static_cast<ControllerAxis>(threshold.m_code));
+
+            isPressed = threshold.m_value > 0.0f ? value >= threshold.m_value : value <= threshold.m_value;
+        }
+
+        m_pressedActions[ i / 64 ] |= static_cast<uint64_t>(isPressed) << (i % 64);
+    }
+
+    // word-wide edges, like the input bits
+    for (size_t i = 0; i < m_pressedActions.size(); i++)
+    {
+        uint64_t changed = m_pressedActions[ i ] ^ m_previousActions[ i ];
+
+        m_triggeredActions[ i ] = changed & m_pressedActions[ i ];
+        m_releasedActions[ i ]  = changed & m_previousActions[ i ];
+    }
+
+    for (size_t i = 0; i < m_resolvedAxes.size(); i++)
+    {
+        float value = 0.0f;
+
+        for (uint32_t j = m_resolvedAxes[ i ].m_begin; j < m_resolvedAxes[ i ].m_end; j++)
+        {
+            const InputBinding& binding = m_resolvedAxisBindings[ j ];
+
+            if (binding.m_type == InputBinding::Type::ControllerAxis)
+            {
+                value += input.GetAxis(static_cast<ControllerAxis>(binding.m_code)) * binding.m_value;
+            }
+            else if (IsButtonPressed(input, binding))
+            {
+                value += binding.m_value;
+            }
+        }
+
+        m_axisValues[ i ] = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+    }
+}
+
+bool engine::InputActionMap::IsTriggered(engine::InputActionId action) const
+{
+    return (m_triggeredActions[ action / 64 ] >> (action % 64)) & 1;
+}
+
+bool engine::InputActionMap::IsPressed(engine::InputActionId action) const
+{
+    return (m_pressedActions[ action / 64 ] >> (action % 64)) & 1;
+}
+
+bool engine::InputActionMap::IsReleased(engine::InputActionId action) const
+{
+    return (m_releasedActions[ action / 64 ] >> (action % 64)) & 1;
+}
+
+float engine::InputActionMap::GetAxisValue(engine::InputAxisId axis) const
+{
+    return m_axisValues[ axis ];
+}
\ No newline at end of file
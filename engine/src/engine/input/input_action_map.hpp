@@ -0,0 +1,147 @@
+#ifndef INPUT_ACTION_MAP_HPP
+#define INPUT_ACTION_MAP_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "input_bits.hpp"
+#include "key_codes.hpp"
+#include <engine/string/string_table.hpp>
+
+namespace engine
+{
+    class InputManager;
+
+    using InputActionId = uint32_t;
+    using InputAxisId   = uint32_t;
+
+    // a physical input bound to an action or an axis
+    struct InputBinding
+    {
+        enum class Type : uint8_t
+        {
+            Keyboard,
+            KeyCode, // an SDL key code, translated to a scancode when the bindings are resolved
+            Mouse,
+            Controller,
+            ControllerAxis
+        };
+
+        Type   m_type;
+        size_t m_code;  // the Keyboard, Mouse, Controller or ControllerAxis value, or the key code
+        float  m_value; // actions: threshold of an axis, negative for the negative direction.
+                        // axes: added to the axis while a button is pressed, or scale of an axis
+    };
+
+    // named digital actions and analog axes, each bound to any number of inputs. bindings are
+    // resolved into bitmasks once, and every action and axis is evaluated in a single pass at the
+    // end of InputManager::Update, so queries are a bit test or a load. changing bindings
+    // re-resolves the tables on the next update
+    class InputActionMap
+    {
+      public:
+        struct Constants
+        {
+            static constexpr InputActionId INVALID_ACTION = UINT32_MAX;
+            static constexpr InputAxisId   INVALID_AXIS   = UINT32_MAX;
+        };
+
+      private:
+        struct Action
+        {
+            NameId                    m_name;
+            std::vector<InputBinding> m_bindings;
+        };
+
+        // all the buttons of an action, plus a range of m_resolvedThresholds
+        struct ResolvedAction
+        {
+            KeyboardBits   m_keys;
+            MouseBits      m_mouseButtons;
+            ControllerBits m_controllerButtons;
+            uint32_t       m_thresholdBegin;
+            uint32_t       m_thresholdEnd;
+        };
+
+        // a range of m_resolvedAxisBindings
+        struct ResolvedAxis
+        {
+            uint32_t m_begin;
+            uint32_t m_end;
+        };
+
+        std::vector<Action>                       m_actions;
+        std::vector<Action>                       m_axes;
+        std::unordered_map<NameId, InputActionId> m_actionsByName;
+        std::unordered_map<NameId, InputAxisId>   m_axesByName;
+
+        // resolved tables, key codes are already scancodes
+        std::vector<ResolvedAction> m_resolvedActions;
+        std::vector<InputBinding>   m_resolvedThresholds;
+        std::vector<ResolvedAxis>   m_resolvedAxes;
+        std::vector<InputBinding>   m_resolvedAxisBindings;
+        bool                        m_isDirty;
+
+        // one bit per action
+        std::vector<uint64_t> m_pressedActions;
+        std::vector<uint64_t> m_previousActions;
+        std::vector<uint64_t> m_triggeredActions;
+        std::vector<uint64_t> m_releasedActions;
+        std::vector<float>    m_axisValues;
+
+        void Bind(std::vector<Action>& targets, uint32_t id, InputBinding binding);
+
+      public:
+        InputActionMap();
+
+        // return the existing action or axis if the name is already in use
+        InputActionId CreateAction(std::string_view name);
+        InputAxisId   CreateAxis(std::string_view name);
+
+        // Constants::INVALID_ACTION or INVALID_AXIS if the name is not in use
+        InputActionId FindAction(std::string_view name) const;
+        InputAxisId   FindAxis(std::string_view name) const;
+
+        size_t GetActionCount() const;
+        size_t GetAxisCount() const;
+
+        // an action is pressed while any of its inputs is, or while a bound axis is past its
+        // threshold. key codes are characters or SDL key codes, like InputManager::IsPressed(int)
+        void BindAction(InputActionId action, Keyboard key);
+        void BindAction(InputActionId action, int keyCode);
+        void BindAction(InputActionId action, Mouse button);
+        void BindAction(InputActionId action, Controller button);
+        void BindAction(InputActionId action, ControllerAxis axis, float threshold);
+
+        // an axis is the sum of its bound controller axes times their scale, plus the value of
+        // every bound button that is pressed, clamped to [-1, 1]
+        void BindAxis(InputAxisId axis, ControllerAxis controllerAxis, float scale = 1.0f);
+        void BindAxis(InputAxisId axis, Keyboard key, float value);
+        void BindAxis(InputAxisId axis, int keyCode, float value);
+        void BindAxis(InputAxisId axis, Mouse button, float value);
+        void BindAxis(InputAxisId axis, Controller button, float value);
+
+        void ClearActionBindings(InputActionId action);
+        void ClearAxisBindings(InputAxisId axis);
+
+        const std::vector<InputBinding>& GetActionBindings(InputActionId action) const;
+        const std::vector<InputBinding>& GetAxisBindings(InputAxisId axis) const;
+
+        // rebuilds the tables from the bindings. Update does it when needed, this is only for
+        // resolving eagerly, like after the keyboard layout changed
+        void Resolve();
+
+        // evaluates every action and axis against the current state of the input manager
+        void Update(const InputManager& input);
+
+        // ids are not checked, they must come from CreateAction or CreateAxis
+        bool  IsTriggered(InputActionId action) const;
+        bool  IsPressed(InputActionId action) const;
+        bool  IsReleased(InputActionId action) const;
+        float GetAxisValue(InputAxisId axis) const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
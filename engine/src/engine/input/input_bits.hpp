@@ -0,0 +1,54 @@
+#ifndef INPUT_BITS_HPP
+#define INPUT_BITS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "key_codes.hpp"
+
+namespace engine
+{
+    // fixed size set of button states packed in 64 bit words, so that a whole frame of input is
+    // copied, compared and reduced a word at a time instead of a button at a time
+    template <size_t BitCount>
+    struct InputBits
+    {
+        struct Constants
+        {
+            static constexpr size_t BIT_COUNT  = BitCount;
+            static constexpr size_t WORD_BITS  = 64;
+            static constexpr size_t WORD_COUNT = (BitCount + WORD_BITS - 1) / WORD_BITS;
+        };
+
+        uint64_t m_words[ Constants::WORD_COUNT ];
+
+        // indices are not checked, they must be below BitCount
+        bool Test(size_t index) const;
+        void Set(size_t index, bool value);
+
+        void   Clear();
+        bool   IsAnySet() const;
+        size_t GetSetCount() const;
+        bool   Intersects(const InputBits& other) const; // any bit set in both
+
+        // packs count bools, starting at bit 0. the remaining bits are cleared
+        void Pack(const bool* values, size_t count);
+
+        // calls func(index) for every set bit, in increasing order
+        template <typename Func>
+        void ForEachSet(Func&& func) const;
+
+        // triggered holds the bits set in current and not in previous, released the opposite.
+        // returns whether anything was triggered
+        static bool ComputeEdges(const InputBits& current, const InputBits& previous, InputBits& triggered, InputBits& released);
+    };
+
+    // one bit per scancode, mouse button (indexed by the Mouse value) and controller button
+    using KeyboardBits   = InputBits<512>; // SDL_SCANCODE_COUNT
+    using MouseBits      = InputBits<static_cast<size_t>(Mouse::MaxEnum)>;
+    using ControllerBits = InputBits<static_cast<size_t>(Controller::MaxEnum)>;
+} // namespace engine
+
+#include "input_bits.inl"
+
+#endif
\ No newline at end of file
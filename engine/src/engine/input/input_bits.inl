@@ -0,0 +1,127 @@
+#include "input_bits.hpp"
+
+#include <bit>
+#include <cstring>
+
+template <size_t BitCount>
+bool engine::InputBits<BitCount>::Test(size_t index) const
+{
+    return (m_words[ index / Constants::WORD_BITS ] >> (index % Constants::WORD_BITS)) & 1;
+}
+
+template <size_t BitCount>
+void engine::InputBits<BitCount>::Set(size_t index, bool value)
+{
+    uint64_t mask = uint64_t { 1 } << (index % Constants::WORD_BITS);
+    uint64_t bits = value ? mask : 0;
+
+    m_words[ index / Constants::WORD_BITS ] = (m_words[ index / Constants::WORD_BITS ] & ~mask) | bits;
+}
+
+template <size_t BitCount>
+void engine::InputBits<BitCount>::Clear()
+{
+    for (uint64_t& word : m_words)
+    {
+        word = 0;
+    }
+}
+
+template <size_t BitCount>
+bool engine::InputBits<BitCount>::IsAnySet() const
+{
+    uint64_t any = 0;
+    for (uint64_t word : m_words)
+    {
+        any |= word;
+    }
+
+    return any != 0;
+}
+
+template <size_t BitCount>
+size_t engine::InputBits<BitCount>::GetSetCount() const
+{
+    size_t count = 0;
+    for (uint64_t word : m_words)
+    {
+        count += static_cast<size_t>(std::popcount(word));
+    }
+
+    return count;
+}
+
+template <size_t BitCount>
+bool engine::InputBits<BitCount>::Intersects(const engine::InputBits<BitCount>& other) const
+{
+    uint64_t any = 0;
+    for (size_t i = 0; i < Constants::WORD_COUNT; i++)
+    {
+        any |= m_words[ i ] & other.m_words[ i ];
+    }
+
+    return any != 0;
+}
+
+template <size_t BitCount>
+void engine::InputBits<BitCount>::Pack(const bool* values, size_t count)
+{
+    if (count > BitCount)
+    {
+        count = BitCount;
+    }
+
+    Clear();
+
+    size_t i = 0;
+
+    // bools are bytes holding 0 or 1. multiplying 8 of them by this constant moves byte n to
+    // bit 56 + n without any carries, which packs them with one multiply
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        constexpr uint64_t GATHER = 0x0102040810204080;
+
+        for (; i + 8 <= count; i += 8)
+        {
+            uint64_t bytes = 0;
+            std::memcpy(&bytes, values + i, sizeof(bytes));
+
+            m_words[ i / Constants::WORD_BITS ] |= ((bytes * GATHER) >> 56) << (i % Constants::WORD_BITS);
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        m_words[ i / Constants::WORD_BITS ] |= static_cast<uint64_t>(values[ i ]) << (i % Constants::WORD_BITS);
+    }
+}
+
+template <size_t BitCount>
+template <typename Func>
+void engine::InputBits<BitCount>::ForEachSet(Func&& func) const
+{
+    for (size_t word = 0; word < Constants::WORD_COUNT; word++)
+    {
+        for (uint64_t bits = m_words[ word ]; bits != 0; bits &= bits - 1)
+        {
+            func(word * Constants::WORD_BITS + static_cast<size_t>(std::countr_zero(bits)));
+        }
+    }
+}
+
+template <size_t BitCount>
+bool engine::InputBits<BitCount>::ComputeEdges(const engine::InputBits<BitCount>& current, const engine::InputBits<BitCount>& previous, engine::InputBits<BitCount>& triggered, engine::InputBits<BitCount>& released)
+{
+    uint64_t any = 0;
+
+    for (size_t i = 0; i < Constants::WORD_COUNT; i++)
+    {
+        uint64_t changed = current.m_words[ i ] ^ previous.m_words[ i ];
+
+        triggered.m_words[ i ] = changed & current.m_words[ i ];
+        released.m_words[ i ]  = changed & previous.m_words[ i ];
+        any |= triggered.m_words[ i ];
+    }
+
+    return any != 0;
+}
\ No newline at end of file
@@ -9,22 +9,33 @@ engine::InputManager::InputManager()
     : m_isAnythingTriggered { false }
     , m_isAnyKeyTriggered { false }
     , m_keyCount { 0 }
-    , m_currentKeyboardState { nullptr }
-    , m_previousKeyboardState { nullptr }
+    , m_currentKeyboardState {}
+    , m_previousKeyboardState {}
+    , m_triggeredKeys {}
+    , m_releasedKeys {}
     , m_isMouseTriggered { false }
     , m_mouseScroll { 0.f }
-    , m_currentMouseState { 0 }
-    , m_previousMouseState { 0 }
+    , m_currentMouseState {}
+    , m_previousMouseState {}
+    , m_triggeredMouseButtons {}
+    , m_releasedMouseButtons {}
     , m_currentMousePositionX { 0.0f }
     , m_currentMousePositionY { 0.0f }
     , m_previousMousePositionX { 0.0f }
     , m_previousMousePositionY { 0.0f }
     , m_isUsingController { false }
     , m_isControllerTriggered { false }
+    , m_isControllerConnected { false }
     , m_controller { nullptr }
     , m_currentControllerState {}
     , m_previousControllerState {}
+    , m_triggeredControllerButtons {}
+    , m_releasedControllerButtons {}
     , m_gamepadAxes {}
+    , m_actionMap {}
+    , m_recorder { nullptr }
+    , m_playback { nullptr }
+    , m_inputThread {}
 {
 }
 
@@ -37,19 +48,25 @@ engine::InputManager& engine::InputManager::GetInstance()
 void engine::InputManager::Initialize()
 {
     // KEYBOARD
-    // get the key count and allocate memory for it
+    // get the key count, scancodes past the capacity of the bitset are ignored
     const bool* keyboardStatus = SDL_GetKeyboardState(&m_keyCount);
-    m_currentKeyboardState     = new bool[ m_keyCount ];
-    m_previousKeyboardState    = new bool[ m_keyCount ];
+    if (m_keyCount > static_cast<int>(KeyboardBits::Constants::BIT_COUNT))
+    {
+        m_keyCount = static_cast<int>(KeyboardBits::Constants::BIT_COUNT);
+    }
 
     // copy the state of the keyboard to the states
-    memcpy(m_currentKeyboardState, keyboardStatus, m_keyCount);
-    memcpy(m_previousKeyboardState, keyboardStatus, m_keyCount);
+    m_currentKeyboardState.Pack(keyboardStatus, static_cast<size_t>(m_keyCount));
+    m_previousKeyboardState = m_currentKeyboardState;
+    m_triggeredKeys.Clear();
+    m_releasedKeys.Clear();
 
     // MOUSE
     // initialize data
-    m_currentMouseState  = 0;
-    m_previousMouseState = 0;
+    m_currentMouseState.Clear();
+    m_previousMouseState.Clear();
+    m_triggeredMouseButtons.Clear();
+    m_releasedMouseButtons.Clear();
 
     m_currentMousePositionX  = 0.0f;
     m_currentMousePositionY  = 0.0f;
@@ -57,16 +74,15 @@ void engine::InputManager::Initialize()
     m_previousMousePositionY = 0.0f;
 
     // CONTROLLER
-    m_isUsingController = true;
-    m_controller        = nullptr;
+    m_isUsingController     = true;
+    m_isControllerConnected = false;
+    m_controller            = nullptr;
 
-    // initialize state arrays
-    constexpr size_t controllerStateSize = static_cast<size_t>(sizeof(m_currentControllerState) / sizeof(m_currentControllerState[ 0 ]));
-    for (size_t i = 0; i < controllerStateSize; i++)
-    {
-        m_currentControllerState[ i ]  = false;
-        m_previousControllerState[ i ] = false;
-    }
+    // initialize state bits
+    m_currentControllerState.Clear();
+    m_previousControllerState.Clear();
+    m_triggeredControllerButtons.Clear();
+    m_releasedControllerButtons.Clear();
 
     constexpr size_t gamepadAxesSize = static_cast<size_t>(sizeof(m_gamepadAxes) / sizeof(m_gamepadAxes[ 0 ]));
     for (size_t i = 0; i < gamepadAxesSize; i++)
@@ -84,7 +100,8 @@ void engine::InputManager::ConnectController()
     }
 
     // get the first connected controller
-    m_controller = SDL_OpenGamepad(0);
+    m_controller            = SDL_OpenGamepad(0);
+    m_isControllerConnected = m_controller != nullptr;
 
     m_isUsingController = true;
 }
@@ -97,96 +114,58 @@ void engine::InputManager::DisconnectController()
         m_controller = nullptr;
     }
 
-    m_isUsingController = false;
+    m_isControllerConnected = false;
+    m_isUsingController     = false;
 }
 
 void engine::InputManager::Update()
 {
-    SDL_PumpEvents();
-
-    // KEYBOARD
-    // get the current state of the keyboard
-    const bool* keyboardState = SDL_GetKeyboardState(nullptr);
-
-    // update the previous and current states of the keyboard
-    memcpy(m_previousKeyboardState, m_currentKeyboardState, m_keyCount);
-    memcpy(m_currentKeyboardState, keyboardState, m_keyCount);
-
-    // determine if ANY key was triggered this frame
-    m_isAnyKeyTriggered = false;
-    for (int i = 0; i < m_keyCount; i++)
+    // the events that happened since the last update, in order
+    if (m_inputThread.IsRunning())
     {
-        if (m_currentKeyboardState[ i ] == true && m_previousKeyboardState[ i ] == false)
-        {
-            m_isAnyKeyTriggered = true;
-            break;
-        }
+        m_inputThread.Drain();
     }
 
-    // MOUSE
-    // update the previous state of the mouse
+    // update the previous states. the controller keeps its previous state while disconnected
+    ControllerBits controllerState = m_currentControllerState;
+
+    m_previousKeyboardState  = m_currentKeyboardState;
     m_previousMouseState     = m_currentMouseState;
     m_previousMousePositionX = m_currentMousePositionX;
     m_previousMousePositionY = m_currentMousePositionY;
 
-    // update the current state of the mouse
-    m_currentMouseState = SDL_GetMouseState(&m_currentMousePositionX, &m_currentMousePositionY);
-
-    // determine if ANY mouse button was triggered this frame
-    m_isMouseTriggered = false;
-    for (size_t i = 1; i < static_cast<size_t>(Mouse::MaxEnum); i++)
+    // get the current states, from the devices or from the recording
+    if (m_playback != nullptr)
     {
-        if ((m_currentMouseState & SDL_BUTTON_MASK(i)) && (m_previousMouseState & SDL_BUTTON_MASK(i)) == false)
-        {
-            m_isMouseTriggered = true;
-            break;
-        }
+        InputFrame frame {};
+        m_playback->ReadFrame(frame);
+        SetFrame(frame);
+    }
+    else
+    {
+        SampleDevices();
     }
 
+    // KEYBOARD
+    // triggered and released keys, and whether ANY key was triggered this frame
+    m_isAnyKeyTriggered = KeyboardBits::ComputeEdges(m_currentKeyboardState, m_previousKeyboardState, m_triggeredKeys, m_releasedKeys);
+
+    // MOUSE
+    // triggered and released buttons, and whether ANY mouse button was triggered this frame
+    m_isMouseTriggered = MouseBits::ComputeEdges(m_currentMouseState, m_previousMouseState, m_triggeredMouseButtons, m_releasedMouseButtons);
+
     // CONTROLLER
     m_isControllerTriggered = false;
+    m_triggeredControllerButtons.Clear();
+    m_releasedControllerButtons.Clear();
 
     // only update controller if one is present
-    if (m_controller)
+    if (m_isControllerConnected)
     {
-        // update the previous state of the controller
-        constexpr size_t controllerStateSize = static_cast<size_t>(sizeof(m_currentControllerState) / sizeof(m_currentControllerState[ 0 ]));
-        for (size_t i = 0; i < controllerStateSize; i++)
-        {
-            m_previousControllerState[ i ] = m_currentControllerState[ i ];
-        }
-
-        // get the current state of controller's axes
-        for (size_t i = 0; i < static_cast<size_t>(ControllerAxis::MaxEnum); i++)
-        {
-            // SDL_GetGamepadAxis returns a number in the range
-            // [-32768,32767], or [-int16_t::max, int16_t::max]
-            // (except for triggers, which are in range [0, 32767]
-            // divide by int16_t::max to keep the numbers in range
-            // [-1.0f, 1.0f] (or [0.0f, 1.0f] in the case of triggers).
-            constexpr int16_t INT16_MAX_VALUE = std::numeric_limits<int16_t>().max();
-
-            int16_t value = SDL_GetGamepadAxis(static_cast<SDL_Gamepad*>(m_controller), static_cast<SDL_GamepadAxis>(i));
-
-            m_gamepadAxes[ i ] = value / static_cast<float>(INT16_MAX_VALUE);
-        }
-
-        // get the current state of the controller
-        // triggers information is computed separately
-        for (size_t i = 0; i < controllerStateSize; i++)
-        {
-            m_currentControllerState[ i ] = SDL_GetGamepadButton(static_cast<SDL_Gamepad*>(m_controller), static_cast<SDL_GamepadButton>(i));
-        }
+        m_previousControllerState = controllerState;
 
-        // check if any button was triggered this frame
-        for (size_t i = 0; i < controllerStateSize; i++)
-        {
-            if (m_currentControllerState[ i ] == true && m_previousControllerState[ i ] == false)
-            {
-                m_isControllerTriggered = true;
-                break;
-            }
-        }
+        // triggered and released buttons, and whether any button was triggered this frame
+        m_isControllerTriggered = ControllerBits::ComputeEdges(m_currentControllerState, m_previousControllerState, m_triggeredControllerButtons, m_releasedControllerButtons);
     }
 
     // check if anything was triggered this frame
@@ -201,7 +180,7 @@ void engine::InputManager::Update()
         m_isUsingController = false;
     }
 
-    if (m_controller)
+    if (m_isControllerConnected)
     {
         if (m_isControllerTriggered)
         {
@@ -226,10 +205,132 @@ void engine::InputManager::Update()
             }
         }
     }
+
+    // RECORDING
+    if (m_recorder != nullptr)
+    {
+        m_recorder->RecordFrame(GetFrame());
+    }
+
+    // ACTIONS
+    m_actionMap.Update(*this);
+}
+
+void engine::InputManager::SampleDevices()
+{
+    SDL_PumpEvents();
+
+    // KEYBOARD
+    // get the current state of the keyboard
+    const bool* keyboardState = SDL_GetKeyboardState(nullptr);
+    m_currentKeyboardState.Pack(keyboardState, static_cast<size_t>(m_keyCount));
+
+    // MOUSE
+    // update the current state of the mouse. SDL_BUTTON_MASK(i) is bit i - 1, shifting
+    // once indexes the bits by the Mouse values
+    SDL_MouseButtonFlags mouseState = SDL_GetMouseState(&m_currentMousePositionX, &m_currentMousePositionY);
+    m_currentMouseState.m_words[ 0 ] = (static_cast<uint64_t>(mouseState) << 1) & ((uint64_t { 1 } << static_cast<size_t>(Mouse::MaxEnum)) - 1);
+
+    // CONTROLLER
+    if (m_controller)
+    {
+        // get the current state of controller's axes
+        for (size_t i = 0; i < static_cast<size_t>(ControllerAxis::MaxEnum); i++)
+        {
+            // SDL_GetGamepadAxis returns a number in the range
+            // [-32768,32767], or [-int16_t::max, int16_t::max]
+            // (except for triggers, which are in range [0, 32767]
+            // divide by int16_t::max to keep the numbers in range
+            // [-1.0f, 1.0f] (or [0.0f, 1.0f] in the case of triggers).
+            constexpr int16_t INT16_MAX_VALUE = std::numeric_limits<int16_t>().max();
+
+            int16_t value = SDL_GetGamepadAxis(static_cast<SDL_Gamepad*>(m_controller), static_cast<SDL_GamepadAxis>(i));
+
+            m_gamepadAxes[ i ] = value / static_cast<float>(INT16_MAX_VALUE);
+        }
+
+        // get the current state of the controller
+        // triggers information is computed separately
+        for (size_t i = 0; i < ControllerBits::Constants::BIT_COUNT; i++)
+        {
+            m_currentControllerState.Set(i, SDL_GetGamepadButton(static_cast<SDL_Gamepad*>(m_controller), static_cast<SDL_GamepadButton>(i)));
+        }
+    }
+}
+
+engine::InputFrame engine::InputManager::GetFrame() const
+{
+    InputFrame frame {};
+    frame.m_keyboard              = m_currentKeyboardState;
+    frame.m_mouseButtons          = m_currentMouseState;
+    frame.m_controllerButtons     = m_currentControllerState;
+    frame.m_mousePositionX        = m_currentMousePositionX;
+    frame.m_mousePositionY        = m_currentMousePositionY;
+    frame.m_mouseScroll           = m_mouseScroll;
+    frame.m_isControllerConnected = m_isControllerConnected;
+
+    for (size_t i = 0; i < static_cast<size_t>(ControllerAxis::MaxEnum); i++)
+    {
+        frame.m_axes[ i ] = m_gamepadAxes[ i ];
+    }
+
+    return frame;
+}
+
+void engine::InputManager::SetFrame(const engine::InputFrame& frame)
+{
+    m_currentKeyboardState  = frame.m_keyboard;
+    m_currentMouseState     = frame.m_mouseButtons;
+    m_currentMousePositionX = frame.m_mousePositionX;
+    m_currentMousePositionY = frame.m_mousePositionY;
+    m_mouseScroll           = frame.m_mouseScroll;
+    m_isControllerConnected = frame.m_isControllerConnected;
+
+    // a disconnected controller keeps its last state, like a live one
+    if (m_isControllerConnected)
+    {
+        m_currentControllerState = frame.m_controllerButtons;
+
+        for (size_t i = 0; i < static_cast<size_t>(ControllerAxis::MaxEnum); i++)
+        {
+            m_gamepadAxes[ i ] = frame.m_axes[ i ];
+        }
+    }
+}
+
+void engine::InputManager::SetRecorder(engine::InputRecorder* recorder)
+{
+    m_recorder = recorder;
+}
+
+void engine::InputManager::SetPlayback(engine::InputPlayback* playback)
+{
+    m_playback = playback;
+}
+
+bool engine::InputManager::IsPlayingBack() const
+{
+    return m_playback != nullptr;
+}
+
+engine::InputThread& engine::InputManager::GetInputThread()
+{
+    return m_inputThread;
+}
+
+const engine::InputThread& engine::InputManager::GetInputThread() const
+{
+    return m_inputThread;
 }
 
 void engine::InputManager::ProcessEvents(void* sdl_ev)
 {
+    // the recording already holds the effect of the events it was made with
+    if (m_playback != nullptr)
+    {
+        return;
+    }
+
     SDL_Event* ev = static_cast<SDL_Event*>(sdl_ev);
 
     switch (ev->type)
@@ -242,12 +343,12 @@ void engine::InputManager::ProcessEvents(void* sdl_ev)
 
 void engine::InputManager::Shutdown()
 {
-    delete[] m_previousKeyboardState;
-    m_previousKeyboardState = nullptr;
-
-    delete[] m_currentKeyboardState;
-    m_currentKeyboardState = nullptr;
+    m_currentKeyboardState.Clear();
+    m_previousKeyboardState.Clear();
+    m_triggeredKeys.Clear();
+    m_releasedKeys.Clear();
 
+    m_inputThread.Stop();
     DisconnectController();
 }
 
@@ -273,7 +374,7 @@ float engine::InputManager::GetRightJoystickY() const
 
 float engine::InputManager::GetAxis(engine::ControllerAxis axis) const
 {
-    if (m_controller == nullptr)
+    if (m_isControllerConnected == false)
     {
         return 0.0f;
     }
@@ -296,24 +397,22 @@ bool engine::InputManager::IsTriggered(int key) const
 
 bool engine::InputManager::IsTriggered(engine::Keyboard key) const
 {
-    return m_currentKeyboardState[ static_cast<size_t>(key) ] == true && m_previousKeyboardState[ static_cast<size_t>(key) ] == false;
+    return m_triggeredKeys.Test(static_cast<size_t>(key));
 }
 
 bool engine::InputManager::IsTriggered(engine::Controller button) const
 {
-    if (m_controller == nullptr)
+    if (m_isControllerConnected == false)
     {
         return false;
     }
 
-    return m_currentControllerState[ static_cast<size_t>(button) ] == true && m_previousControllerState[ static_cast<size_t>(button) ] == false;
+    return m_triggeredControllerButtons.Test(static_cast<size_t>(button));
 }
 
 bool engine::InputManager::IsTriggered(engine::Mouse button) const
 {
-    int mask = SDL_BUTTON_MASK(static_cast<size_t>(button));
-
-    return (m_currentMouseState & mask) && (m_previousMouseState & mask) == false;
+    return m_triggeredMouseButtons.Test(static_cast<size_t>(button));
 }
 
 bool engine::InputManager::IsPressed(int key) const
@@ -324,24 +423,22 @@ bool engine::InputManager::IsPressed(int key) const
 
 bool engine::InputManager::IsPressed(engine::Keyboard key) const
 {
-    return m_currentKeyboardState[ static_cast<size_t>(key) ];
+    return m_currentKeyboardState.Test(static_cast<size_t>(key));
 }
 
 bool engine::InputManager::IsPressed(engine::Controller button) const
 {
-    if (m_controller == nullptr)
+    if (m_isControllerConnected == false)
     {
         return false;
     }
 
-    return m_currentControllerState[ static_cast<size_t>(button) ] == true;
+    return m_currentControllerState.Test(static_cast<size_t>(button));
 }
 
 bool engine::InputManager::IsPressed(engine::Mouse button) const
 {
-    int mask = SDL_BUTTON_MASK(static_cast<size_t>(button));
-
-    return (m_currentMouseState & mask);
+    return m_currentMouseState.Test(static_cast<size_t>(button));
 }
 
 bool engine::InputManager::IsReleased(int key) const
@@ -352,24 +449,22 @@ bool engine::InputManager::IsReleased(int key) const
 
 bool engine::InputManager::IsReleased(engine::Keyboard key) const
 {
-    return m_currentKeyboardState[ static_cast<size_t>(key) ] == false && m_previousKeyboardState[ static_cast<size_t>(key) ] == true;
+    return m_releasedKeys.Test(static_cast<size_t>(key));
 }
 
 bool engine::InputManager::IsReleased(engine::Controller button) const
 {
-    if (m_controller == nullptr)
+    if (m_isControllerConnected == false)
     {
         return false;
     }
 
-    return m_currentControllerState[ static_cast<size_t>(button) ] == false && m_previousControllerState[ static_cast<size_t>(button) ] == true;
+    return m_releasedControllerButtons.Test(static_cast<size_t>(button));
 }
 
 bool engine::InputManager::IsReleased(engine::Mouse button) const
 {
-    int mask = SDL_BUTTON_MASK(static_cast<size_t>(button));
-
-    return (m_currentMouseState & mask) == false && (m_previousMouseState & mask);
+    return m_releasedMouseButtons.Test(static_cast<size_t>(button));
 }
 
 float engine::InputManager::GetMousePositionX() const
@@ -432,9 +527,64 @@ bool engine::InputManager::IsUsingController() const
     return m_isUsingController;
 }
 
+engine::InputActionMap& engine::InputManager::GetActionMap()
+{
+    return m_actionMap;
+}
+
+const engine::InputActionMap& engine::InputManager::GetActionMap() const
+{
+    return m_actionMap;
+}
+
+const engine::KeyboardBits& engine::InputManager::GetKeyboardState() const
+{
+    return m_currentKeyboardState;
+}
+
+const engine::MouseBits& engine::InputManager::GetMouseState() const
+{
+    return m_currentMouseState;
+}
+
+const engine::ControllerBits& engine::InputManager::GetControllerState() const
+{
+    return m_currentControllerState;
+}
+
+const engine::KeyboardBits& engine::InputManager::GetTriggeredKeys() const
+{
+    return m_triggeredKeys;
+}
+
+const engine::KeyboardBits& engine::InputManager::GetReleasedKeys() const
+{
+    return m_releasedKeys;
+}
+
+const engine::MouseBits& engine::InputManager::GetTriggeredMouseButtons() const
+{
+    return m_triggeredMouseButtons;
+}
+
+const engine::MouseBits& engine::InputManager::GetReleasedMouseButtons() const
+{
+    return m_releasedMouseButtons;
+}
+
+const engine::ControllerBits& engine::InputManager::GetTriggeredControllerButtons() const
+{
+    return m_triggeredControllerButtons;
+}
+
+const engine::ControllerBits& engine::InputManager::GetReleasedControllerButtons() const
+{
+    return m_releasedControllerButtons;
+}
+
 bool engine::InputManager::IsControllerConnected() const
 {
-    return m_controller != nullptr;
+    return m_isControllerConnected;
 }
 
 void engine::InputManager::VibrateController(float force, float duration) const
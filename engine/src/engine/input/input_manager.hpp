@@ -1,6 +1,10 @@
 #ifndef INPUT_MANAGER_HPP
 #define INPUT_MANAGER_HPP
 
+#include "input_action_map.hpp"
+#include "input_bits.hpp"
+#include "input_recording.hpp"
+#include "input_thread.hpp"
 #include "key_codes.hpp" // Keyboard, Mouse, Controller, ControllerAxis enum classes
 
 namespace engine
@@ -15,28 +19,45 @@ namespace engine
         bool m_isAnythingTriggered;
 
         // KEYBOARD
-        bool  m_isAnyKeyTriggered;
-        int   m_keyCount;
-        bool* m_currentKeyboardState;
-        bool* m_previousKeyboardState;
+        bool         m_isAnyKeyTriggered;
+        int          m_keyCount;
+        KeyboardBits m_currentKeyboardState;
+        KeyboardBits m_previousKeyboardState;
+        KeyboardBits m_triggeredKeys;
+        KeyboardBits m_releasedKeys;
 
         // MOUSE
-        bool     m_isMouseTriggered;
-        float    m_mouseScroll;
-        unsigned m_currentMouseState;
-        unsigned m_previousMouseState;
-        float    m_currentMousePositionX;
-        float    m_currentMousePositionY;
-        float    m_previousMousePositionX;
-        float    m_previousMousePositionY;
+        bool      m_isMouseTriggered;
+        float     m_mouseScroll;
+        MouseBits m_currentMouseState;
+        MouseBits m_previousMouseState;
+        MouseBits m_triggeredMouseButtons;
+        MouseBits m_releasedMouseButtons;
+        float     m_currentMousePositionX;
+        float     m_currentMousePositionY;
+        float     m_previousMousePositionX;
+        float     m_previousMousePositionY;
 
         // CONTROLLER
-        bool  m_isUsingController;
-        bool  m_isControllerTriggered;
-        void* m_controller;
-        bool  m_currentControllerState[ static_cast<size_t>(Controller::MaxEnum) ];
-        bool  m_previousControllerState[ static_cast<size_t>(Controller::MaxEnum) ];
-        float m_gamepadAxes[ static_cast<size_t>(ControllerAxis::MaxEnum) ];
+        bool           m_isUsingController;
+        bool           m_isControllerTriggered;
+        bool           m_isControllerConnected; // a live controller, or one in the recording played back
+        void*          m_controller;
+        ControllerBits m_currentControllerState;
+        ControllerBits m_previousControllerState;
+        ControllerBits m_triggeredControllerButtons;
+        ControllerBits m_releasedControllerButtons;
+        float          m_gamepadAxes[ static_cast<size_t>(ControllerAxis::MaxEnum) ];
+
+        // ACTIONS
+        InputActionMap m_actionMap;
+
+        // RECORDING
+        InputRecorder* m_recorder; // null while not recording
+        InputPlayback* m_playback; // null while sampling the devices
+
+        // TIMESTAMPED EVENTS
+        InputThread m_inputThread;
 
         InputManager();
         ~InputManager()                              = default;
@@ -46,6 +67,9 @@ namespace engine
         void ConnectController();
         void DisconnectController();
 
+        void SampleDevices();
+        void SetFrame(const InputFrame& frame);
+
       public:
         static InputManager& GetInstance();
 
@@ -54,6 +78,23 @@ namespace engine
         void ProcessEvents(void* sdl_ev);
         void Shutdown();
 
+        // the state sampled by the last update
+        InputFrame GetFrame() const;
+
+        // every update appends its frame to the recorder. null stops recording. the edges of the
+        // first frame depend on the state before it, so exact replays start right after Initialize
+        void SetRecorder(InputRecorder* recorder);
+
+        // updates read their frame from the playback instead of SDL, and SDL events are ignored.
+        // once the playback is finished the last frame repeats. null goes back to the devices
+        void SetPlayback(InputPlayback* playback);
+        bool IsPlayingBack() const;
+
+        // timestamped events, drained at the start of every update while running. the polled
+        // state above is unaffected
+        InputThread&       GetInputThread();
+        const InputThread& GetInputThread() const;
+
         float GetLeftJoystickX() const;
         float GetLeftJoystickY() const;
         float GetRightJoystickX() const;
@@ -89,6 +130,24 @@ namespace engine
         bool IsMouseTriggered() const;
         bool IsUsingController() const;
 
+        // evaluated at the end of every Update
+        InputActionMap&       GetActionMap();
+        const InputActionMap& GetActionMap() const;
+
+        // current state of every button, the controller state is stale while disconnected
+        const KeyboardBits&   GetKeyboardState() const;
+        const MouseBits&      GetMouseState() const;
+        const ControllerBits& GetControllerState() const;
+
+        // whole frame edge masks, to visit only what changed with ForEachSet.
+        // the controller masks are empty while no controller is connected
+        const KeyboardBits&   GetTriggeredKeys() const;
+        const KeyboardBits&   GetReleasedKeys() const;
+        const MouseBits&      GetTriggeredMouseButtons() const;
+        const MouseBits&      GetReleasedMouseButtons() const;
+        const ControllerBits& GetTriggeredControllerButtons() const;
+        const ControllerBits& GetReleasedControllerButtons() const;
+
         bool IsControllerConnected() const;
         void VibrateController(float force = 1.0f, float duration = 1.0f) const;
         void VibrateControllerLowHigh(float low = 1.0f, float high = 1.0f, float duration = 1.0f) const;
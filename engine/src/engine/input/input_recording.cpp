@@ -0,0 +1,306 @@
+#include "input_recording.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    // which parts of a frame changed. the connection state is stored as a flag directly
+    enum FrameFlags : uint8_t
+    {
+        KEYBOARD             = 1 << 0,
+        MOUSE_BUTTONS        = 1 << 1,
+        MOUSE_POSITION       = 1 << 2,
+        MOUSE_SCROLL         = 1 << 3,
+        CONTROLLER_BUTTONS   = 1 << 4,
+        AXES                 = 1 << 5,
+        CONTROLLER_CONNECTED = 1 << 6
+    };
+
+    constexpr size_t AXIS_COUNT = static_cast<size_t>(engine::ControllerAxis::MaxEnum);
+
+    static_assert(engine::MouseBits::Constants::BIT_COUNT <= 8, "mouse buttons are stored in a byte");
+    static_assert(engine::ControllerBits::Constants::BIT_COUNT <= 32, "controller buttons are stored in 32 bits");
+    static_assert(AXIS_COUNT <= 8, "the changed axes are stored in a byte");
+
+    engine::InputFrame GetEmptyFrame()
+    {
+        engine::InputFrame frame {};
+        return frame;
+    }
+
+    template <typename T>
+    void Write(std::vector<uint8_t>& data, T value)
+    {
+        size_t offset = data.size();
+        data.resize(offset + sizeof(T));
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T Read(const std::vector<uint8_t>& data, size_t& offset)
+    {
+        if (offset + sizeof(T) > data.size())
+        {
+            throw std::runtime_error("Tried to read past the end of an input recording");
+        }
+
+        T value;
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return value;
+    }
+
+    // floats are compared bitwise, so that the playback is exact
+    bool HasChanged(float a, float b)
+    {
+        return std::memcmp(&a, &b, sizeof(float)) != 0;
+    }
+} // namespace
+
+engine::InputRecording::InputRecording()
+    : m_data {}
+    , m_frameCount { 0 }
+{
+}
+
+void engine::InputRecording::Clear()
+{
+    m_data.clear();
+    m_frameCount = 0;
+}
+
+size_t engine::InputRecording::GetFrameCount() const
+{
+    return m_frameCount;
+}
+
+size_t engine::InputRecording::GetSizeInBytes() const
+{
+    return m_data.size();
+}
+
+void engine::InputRecording::SaveToFile(const std::string& path) const
+{
+    std::ofstream file { path, std::ios::binary };
+    if (!file)
+    {
+        throw std::runtime_error("Tried to save an input recording to a file that can not be opened");
+    }
+
+    uint64_t header[ 3 ] = { (static_cast<uint64_t>(Constants::VERSION) << 32) | Constants::MAGIC, m_frameCount, m_data.size() };
+
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_data.data()), static_cast<std::streamsize>(m_data.size()));
+
+    if (!file)
+    {
+        throw std::runtime_error("Tried to save an input recording but writing failed");
+    }
+}
+
+void engine::InputRecording::LoadFromFile(const std::string& path)
+{
+    std::ifstream file { path, std::ios::binary };
+    if (!file)
+    {
+        throw std::runtime_error("Tried to load an input recording from a file that can not be opened");
+    }
+
+    uint64_t header[ 3 ] = {};
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+    if (!file || header[ 0 ] != ((static_cast<uint64_t>(Constants::VERSION) << 32) | Constants::MAGIC))
+    {
+        throw std::runtime_error("Tried to load a file that is not an input recording of this version");
+    }
+
+    std::vector<uint8_t> data(static_cast<size_t>(header[ 2 ]));
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    if (!file)
+    {
+        throw std::runtime_error("Tried to load an input recording that is truncated");
+    }
+
+    m_data       = std::move(data);
+    m_frameCount = static_cast<size_t>(header[ 1 ]);
+}
+
+engine::InputRecorder::InputRecorder(engine::InputRecording& recording)
+    : m_recording { &recording }
+    , m_previous { GetEmptyFrame() }
+{
+    // continue from the state the recording ends with
+    InputPlayback playback { recording };
+    while (playback.ReadFrame(m_previous))
+    {
+    }
+}
+
+void engine::InputRecorder::RecordFrame(const engine::InputFrame& frame)
+{
+    std::vector<uint8_t>& data = m_recording->m_data;
+
+    KeyboardBits changedKeys {};
+    for (size_t i = 0; i < KeyboardBits::Constants::WORD_COUNT; i++)
+    {
+        changedKeys.m_words[ i ] = frame.m_keyboard.m_words[ i ] ^ m_previous.m_keyboard.m_words[ i ];
+    }
+
+    uint8_t changedAxes = 0;
+    for (size_t i = 0; i < AXIS_COUNT; i++)
+    {
+        changedAxes |= static_cast<uint8_t>(HasChanged(frame.m_axes[ i ], m_previous.m_axes[ i ])) << i;
+    }
+
+    uint8_t flags = 0;
+    flags |= changedKeys.IsAnySet() ? KEYBOARD : 0;
+    flags |= frame.m_mouseButtons.m_words[ 0 ] != m_previous.m_mouseButtons.m_words[ 0 ] ? MOUSE_BUTTONS : 0;
+    flags |= HasChanged(frame.m_mousePositionX, m_previous.m_mousePositionX) || HasChanged(frame.m_mousePositionY, m_previous.m_mousePositionY) ? MOUSE_POSITION : 0;
+    flags |= HasChanged(frame.m_mouseScroll, m_previous.m_mouseScroll) ? MOUSE_SCROLL : 0;
+    flags |= frame.m_controllerButtons.m_words[ 0 ] != m_previous.m_controllerButtons.m_words[ 0 ] ? CONTROLLER_BUTTONS : 0;
+    flags |= changedAxes != 0 ? AXES : 0;
+    flags |= frame.m_isControllerConnected ? CONTROLLER_CONNECTED : 0;
+
+    Write<uint8_t>(data, flags);
+
+    // the keys that toggled, rather than the whole keyboard
+    if (flags & KEYBOARD)
+    {
+        Write<uint16_t>(data, static_cast<uint16_t>(changedKeys.GetSetCount()));
+        changedKeys.ForEachSet(
+            [ &data ](size_t key)
+            {
+                Write<uint16_t>(data, static_cast<uint16_t>(key));
+            });
+    }
+
+    if (flags & MOUSE_BUTTONS)
+    {
+        Write<uint8_t>(data, static_cast<uint8_t>(frame.m_mouseButtons.m_words[ 0 ]));
+    }
+
+    if (flags & MOUSE_POSITION)
+    {
+        Write<float>(data, frame.m_mousePositionX);
+        Write<float>(data, frame.m_mousePositionY);
+    }
+
+    if (flags & MOUSE_SCROLL)
+    {
+        Write<float>(data, frame.m_mouseScroll);
+    }
+
+    if (flags & CONTROLLER_BUTTONS)
+    {
+        Write<uint32_t>(data, static_cast<uint32_t>(frame.m_controllerButtons.m_words[ 0 ]));
+    }
+
+    if (flags & AXES)
+    {
+        Write<uint8_t>(data, changedAxes);
+        for (size_t i = 0; i < AXIS_COUNT; i++)
+        {
+            if (changedAxes & (1 << i))
+            {
+                Write<float>(data, frame.m_axes[ i ]);
+            }
+        }
+    }
+
+    m_recording->m_frameCount++;
+    m_previous = frame;
+}
+
+engine::InputPlayback::InputPlayback(const engine::InputRecording& recording)
+    : m_recording { &recording }
+    , m_current { GetEmptyFrame() }
+    , m_offset { 0 }
+    , m_frameIndex { 0 }
+{
+}
+
+bool engine::InputPlayback::ReadFrame(engine::InputFrame& frame)
+{
+    if (IsFinished())
+    {
+        frame = m_current;
+        return false;
+    }
+
+    const std::vector<uint8_t>& data  = m_recording->m_data;
+    uint8_t                     flags = Read<uint8_t>(data, m_offset);
+
+    if (flags & KEYBOARD)
+    {
+        uint16_t count = Read<uint16_t>(data, m_offset);
+        for (uint16_t i = 0; i < count; i++)
+        {
+            uint16_t key = Read<uint16_t>(data, m_offset);
+            if (key >= KeyboardBits::Constants::BIT_COUNT)
+            {
+                throw std::runtime_error("Tried to play back an input recording with an invalid key");
+            }
+
+            m_current.m_keyboard.Set(key, !m_current.m_keyboard.Test(key));
+        }
+    }
+
+    if (flags & MOUSE_BUTTONS)
+    {
+        m_current.m_mouseButtons.m_words[ 0 ] = Read<uint8_t>(data, m_offset);
+    }
+
+    if (flags & MOUSE_POSITION)
+    {
+        m_current.m_mousePositionX = Read<float>(data, m_offset);
+        m_current.m_mousePositionY = Read<float>(data, m_offset);
+    }
+
+    if (flags & MOUSE_SCROLL)
+    {
+        m_current.m_mouseScroll = Read<float>(data, m_offset);
+    }
+
+    if (flags & CONTROLLER_BUTTONS)
+    {
+        m_current.m_controllerButtons.m_words[ 0 ] = Read<uint32_t>(data, m_offset);
+    }
+
+    if (flags & AXES)
+    {
+        uint8_t changedAxes = Read<uint8_t>(data, m_offset);
+        for (size_t i = 0; i < AXIS_COUNT; i++)
+        {
+            if (changedAxes & (1 << i))
+            {
+                m_current.m_axes[ i ] = Read<float>(data, m_offset);
+            }
+        }
+    }
+
+    m_current.m_isControllerConnected = (flags & CONTROLLER_CONNECTED) != 0;
+
+    m_frameIndex++;
+    frame = m_current;
+    return true;
+}
+
+void engine::InputPlayback::Rewind()
+{
+    m_current    = GetEmptyFrame();
+    m_offset     = 0;
+    m_frameIndex = 0;
+}
+
+bool engine::InputPlayback::IsFinished() const
+{
+    return m_frameIndex >= m_recording->m_frameCount;
+}
+
+size_t engine::InputPlayback::GetFrameIndex() const
+{
+    return m_frameIndex;
+}
\ No newline at end of file
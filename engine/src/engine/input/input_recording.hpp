@@ -0,0 +1,89 @@
+#ifndef INPUT_RECORDING_HPP
+#define INPUT_RECORDING_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "input_bits.hpp"
+#include "key_codes.hpp"
+
+namespace engine
+{
+    // everything the input manager samples in one frame
+    struct InputFrame
+    {
+        KeyboardBits   m_keyboard;
+        MouseBits      m_mouseButtons;
+        ControllerBits m_controllerButtons;
+        float          m_mousePositionX;
+        float          m_mousePositionY;
+        float          m_mouseScroll;
+        float          m_axes[ static_cast<size_t>(ControllerAxis::MaxEnum) ]; // before the dead zone
+        bool           m_isControllerConnected;
+    };
+
+    // a recorded input session: one delta against the previous frame per frame. a frame where
+    // nothing changed takes a single byte, a key press a few more
+    class InputRecording
+    {
+      public:
+        struct Constants
+        {
+            static constexpr uint32_t MAGIC   = 0x504E4945; // "EINP"
+            static constexpr uint32_t VERSION = 1;
+        };
+
+      private:
+        std::vector<uint8_t> m_data;
+        size_t               m_frameCount;
+
+        friend class InputRecorder;
+        friend class InputPlayback;
+
+      public:
+        InputRecording();
+
+        void   Clear();
+        size_t GetFrameCount() const;
+        size_t GetSizeInBytes() const;
+
+        // throw if the file can not be written or read, or is not a recording of this version
+        void SaveToFile(const std::string& path) const;
+        void LoadFromFile(const std::string& path);
+    };
+
+    // appends frames to a recording, see InputManager::SetRecorder
+    class InputRecorder
+    {
+        InputRecording* m_recording;
+        InputFrame      m_previous;
+
+      public:
+        // appends after whatever the recording already holds
+        explicit InputRecorder(InputRecording& recording);
+
+        void RecordFrame(const InputFrame& frame);
+    };
+
+    // reads the frames of a recording back in order, see InputManager::SetPlayback
+    class InputPlayback
+    {
+        const InputRecording* m_recording;
+        InputFrame            m_current;
+        size_t                m_offset;
+        size_t                m_frameIndex;
+
+      public:
+        explicit InputPlayback(const InputRecording& recording);
+
+        // returns false once every frame was read, and keeps returning the last frame
+        bool ReadFrame(InputFrame& frame);
+
+        void   Rewind();
+        bool   IsFinished() const;
+        size_t GetFrameIndex() const; // frames read so far
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,246 @@
+#include "input_thread.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits> // numeric_limits
+#include <stdexcept>
+
+#include <SDL3/SDL.h>
+
+namespace
+{
+    // returns false for the events that are not input
+    bool ConvertEvent(const SDL_Event& ev, engine::InputEvent& event)
+    {
+        event             = engine::InputEvent {};
+        event.m_timestamp = ev.common.timestamp;
+
+        switch (ev.type)
+        {
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+                event.m_type     = ev.type == SDL_EVENT_KEY_DOWN ? engine::InputEvent::Type::KeyDown : engine::InputEvent::Type::KeyUp;
+                event.m_isRepeat = ev.key.repeat;
+                event.m_code     = static_cast<uint16_t>(ev.key.scancode);
+                return static_cast<size_t>(ev.key.scancode) < engine::KeyboardBits::Constants::BIT_COUNT;
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                event.m_type = ev.type == SDL_EVENT_MOUSE_BUTTON_DOWN ? engine::InputEvent::Type::MouseButtonDown : engine::InputEvent::Type::MouseButtonUp;
+                event.m_code = ev.button.button;
+                event.m_x    = ev.button.x;
+                event.m_y    = ev.button.y;
+                return ev.button.button < engine::MouseBits::Constants::BIT_COUNT;
+            case SDL_EVENT_MOUSE_MOTION:
+                event.m_type = engine::InputEvent::Type::MouseMotion;
+                event.m_x    = ev.motion.x;
+                event.m_y    = ev.motion.y;
+                return true;
+            case SDL_EVENT_MOUSE_WHEEL:
+                event.m_type = engine::InputEvent::Type::MouseWheel;
+                event.m_x    = ev.wheel.x;
+                event.m_y    = ev.wheel.y;
+                return true;
+            case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+            case SDL_EVENT_GAMEPAD_BUTTON_UP:
+                event.m_type = ev.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN ? engine::InputEvent::Type::ControllerButtonDown : engine::InputEvent::Type::ControllerButtonUp;
+                event.m_code = ev.gbutton.button;
+                return ev.gbutton.button < engine::ControllerBits::Constants::BIT_COUNT;
+            case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+                event.m_type = engine::InputEvent::Type::ControllerAxis;
+                event.m_code = ev.gaxis.axis;
+                event.m_x    = ev.gaxis.value / static_cast<float>(std::numeric_limits<int16_t>::max());
+                return ev.gaxis.axis < static_cast<size_t>(engine::ControllerAxis::MaxEnum);
+        }
+
+        return false;
+    }
+
+    bool SDLCALL WatchEvents(void* userdata, SDL_Event* ev)
+    {
+        engine::InputEvent event;
+        if (ConvertEvent(*ev, event))
+        {
+            static_cast<engine::InputThread*>(userdata)->PushEvent(event);
+        }
+
+        // the return value of a watch is ignored
+        return true;
+    }
+} // namespace
+
+engine::InputThread::InputThread()
+    : m_queue {}
+    , m_droppedCount { 0 }
+    , m_isPumping { false }
+    , m_pumpThread {}
+    , m_pumpInterval { Constants::DEFAULT_PUMP_INTERVAL }
+    , m_isRunning { false }
+    , m_frameEvents {}
+    , m_keyPressTimes {}
+    , m_mousePressTimes {}
+    , m_controllerPressTimes {}
+{
+}
+
+engine::InputThread::~InputThread()
+{
+    Stop();
+}
+
+bool engine::InputThread::PushEvent(const engine::InputEvent& event)
+{
+    if (m_queue.TryPush(event) == false)
+    {
+        m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+void engine::InputThread::PumpLoop()
+{
+    uint64_t next = SDL_GetTicksNS();
+
+    while (m_isPumping.load(std::memory_order_acquire))
+    {
+        SDL_PumpEvents();
+
+        // fixed rate, without accumulating the drift of every sleep
+        next += m_pumpInterval;
+
+        uint64_t now = SDL_GetTicksNS();
+        if (next > now)
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds { next - now });
+        }
+        else
+        {
+            next = now;
+        }
+    }
+}
+
+void engine::InputThread::Start(bool isPumping, uint64_t pumpInterval)
+{
+    if (m_isRunning)
+    {
+        throw std::runtime_error("Tried to start the input thread twice");
+    }
+
+    if (SDL_AddEventWatch(WatchEvents, this) == false)
+    {
+        throw std::runtime_error("Tried to start the input thread but the event watch could not be added");
+    }
+
+    m_isRunning    = true;
+    m_pumpInterval = pumpInterval;
+    m_droppedCount.store(0, std::memory_order_relaxed);
+
+    // a full queue fits, so draining never allocates
+    m_frameEvents.reserve(Constants::QUEUE_CAPACITY);
+
+    std::fill(std::begin(m_keyPressTimes), std::end(m_keyPressTimes), Constants::NEVER);
+    std::fill(std::begin(m_mousePressTimes), std::end(m_mousePressTimes), Constants::NEVER);
+    std::fill(std::begin(m_controllerPressTimes), std::end(m_controllerPressTimes), Constants::NEVER);
+
+    if (isPumping)
+    {
+        m_isPumping.store(true, std::memory_order_release);
+        m_pumpThread = std::thread { &InputThread::PumpLoop, this };
+    }
+}
+
+void engine::InputThread::Stop()
+{
+    if (m_isRunning == false)
+    {
+        return;
+    }
+
+    if (m_pumpThread.joinable())
+    {
+        m_isPumping.store(false, std::memory_order_release);
+        m_pumpThread.join();
+    }
+
+    SDL_RemoveEventWatch(WatchEvents, this);
+
+    // anything still queued is stale once stopped
+    InputEvent event;
+    while (m_queue.TryPop(event))
+    {
+    }
+
+    m_frameEvents.clear();
+    m_isRunning = false;
+}
+
+bool engine::InputThread::IsRunning() const
+{
+    return m_isRunning;
+}
+
+void engine::InputThread::Drain()
+{
+    m_frameEvents.clear();
+
+    InputEvent event;
+    while (m_queue.TryPop(event))
+    {
+        m_frameEvents.push_back(event);
+    }
+
+    // events of one source arrive in order, but the os may timestamp sources differently
+    std::stable_sort(m_frameEvents.begin(), m_frameEvents.end(),
+        [](const InputEvent& a, const InputEvent& b)
+        {
+            return a.m_timestamp < b.m_timestamp;
+        });
+
+    for (const InputEvent& frameEvent : m_frameEvents)
+    {
+        switch (frameEvent.m_type)
+        {
+            case InputEvent::Type::KeyDown:
+                if (frameEvent.m_isRepeat == false)
+                {
+                    m_keyPressTimes[ frameEvent.m_code ] = frameEvent.m_timestamp;
+                }
+                break;
+            case InputEvent::Type::MouseButtonDown:
+                m_mousePressTimes[ frameEvent.m_code ] = frameEvent.m_timestamp;
+                break;
+            case InputEvent::Type::ControllerButtonDown:
+                m_controllerPressTimes[ frameEvent.m_code ] = frameEvent.m_timestamp;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+const std::vector<engine::InputEvent>& engine::InputThread::GetFrameEvents() const
+{
+    return m_frameEvents;
+}
+
+uint64_t engine::InputThread::GetPressTimestamp(engine::Keyboard key) const
+{
+    return m_keyPressTimes[ static_cast<size_t>(key) ];
+}
+
+uint64_t engine::InputThread::GetPressTimestamp(engine::Mouse button) const
+{
+    return m_mousePressTimes[ static_cast<size_t>(button) ];
+}
+
+uint64_t engine::InputThread::GetPressTimestamp(engine::Controller button) const
+{
+    return m_controllerPressTimes[ static_cast<size_t>(button) ];
+}
+
+size_t engine::InputThread::GetDroppedCount() const
+{
+    return m_droppedCount.load(std::memory_order_relaxed);
+}
\ No newline at end of file
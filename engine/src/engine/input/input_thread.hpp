@@ -0,0 +1,105 @@
+#ifndef INPUT_THREAD_HPP
+#define INPUT_THREAD_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "input_bits.hpp"
+#include "key_codes.hpp"
+#include <engine/job/spsc_queue.hpp>
+
+namespace engine
+{
+    // an input event with the time it happened, rather than the time the frame saw it
+    struct InputEvent
+    {
+        enum class Type : uint8_t
+        {
+            KeyDown,
+            KeyUp,
+            MouseButtonDown,
+            MouseButtonUp,
+            MouseMotion,
+            MouseWheel,
+            ControllerButtonDown,
+            ControllerButtonUp,
+            ControllerAxis
+        };
+
+        uint64_t m_timestamp; // nanoseconds on the SDL_GetTicksNS clock, from the os event when it has one
+        Type     m_type;
+        bool     m_isRepeat; // key repeats generated by the os
+        uint16_t m_code;     // scancode, or the Mouse, Controller or ControllerAxis value
+        float    m_x;        // mouse position, wheel movement, or axis value in [-1, 1]
+        float    m_y;
+    };
+
+    // collects input events as SDL produces them, through an event watch, into a lock-free
+    // single producer single consumer queue. the game thread drains the queue once per frame and
+    // gets every event in order with its own timestamp, independent of the frame rate.
+    //
+    // SDL calls the watch on whichever thread pumps events, holding its watcher lock, so pushes
+    // never overlap. optionally a dedicated thread pumps at a fixed rate so that events are
+    // timestamped even while the frame is busy. only use it where SDL allows pumping away from
+    // the thread that created the window (not on windows or macos, where the os timestamps of the
+    // events already give sub-frame accuracy when the main thread pumps)
+    class InputThread
+    {
+      public:
+        struct Constants
+        {
+            static constexpr size_t   QUEUE_CAPACITY        = 4096;
+            static constexpr uint64_t DEFAULT_PUMP_INTERVAL = 1000000; // nanoseconds, 1 khz
+            static constexpr uint64_t NEVER                 = 0;       // press timestamp of a button never pressed
+        };
+
+      private:
+        SpscQueue<InputEvent, Constants::QUEUE_CAPACITY> m_queue;
+        std::atomic<size_t>                              m_droppedCount; // events lost to a full queue
+        std::atomic<bool>                                m_isPumping;
+        std::thread                                      m_pumpThread;
+        uint64_t                                         m_pumpInterval;
+        bool                                             m_isRunning;
+
+        // owned by the game thread
+        std::vector<InputEvent> m_frameEvents;
+        uint64_t                m_keyPressTimes[ KeyboardBits::Constants::BIT_COUNT ];
+        uint64_t                m_mousePressTimes[ MouseBits::Constants::BIT_COUNT ];
+        uint64_t                m_controllerPressTimes[ ControllerBits::Constants::BIT_COUNT ];
+
+        void PumpLoop();
+
+      public:
+        InputThread();
+        ~InputThread();
+        InputThread(const InputThread&)            = delete;
+        InputThread& operator=(const InputThread&) = delete;
+
+        // isPumping starts the dedicated pumping thread, see the class comment
+        void Start(bool isPumping = false, uint64_t pumpInterval = Constants::DEFAULT_PUMP_INTERVAL);
+        void Stop();
+        bool IsRunning() const;
+
+        // producer side, called by the event watch. returns false and counts the event as
+        // dropped if the queue is full
+        bool PushEvent(const InputEvent& event);
+
+        // game thread only: replaces the frame events with the ones queued since the last drain,
+        // sorted by timestamp, and records the press timestamps
+        void Drain();
+
+        const std::vector<InputEvent>& GetFrameEvents() const;
+
+        // when the button was last pressed, Constants::NEVER if it was not since Start
+        uint64_t GetPressTimestamp(Keyboard key) const;
+        uint64_t GetPressTimestamp(Mouse button) const;
+        uint64_t GetPressTimestamp(Controller button) const;
+
+        size_t GetDroppedCount() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,290 @@
+#include "job_system.hpp"
+
+#include <stdexcept>
+
+namespace
+{
+    // deque owned by the current thread, 0 is shared by every thread that is not a worker
+    thread_local size_t t_queueIndex = 0;
+
+    thread_local std::vector<engine::Job> t_chunkBuffer {};
+} // namespace
+
+engine::JobCounter::JobCounter()
+    : m_count { 0 }
+{
+}
+
+bool engine::JobCounter::IsDone() const
+{
+    return m_count.load(std::memory_order_acquire) == 0;
+}
+
+size_t engine::JobCounter::GetCount() const
+{
+    return m_count.load(std::memory_order_acquire);
+}
+
+engine::JobSystem::JobSystem()
+    : m_queues {}
+    , m_workers {}
+    , m_queuedJobCount { 0 }
+    , m_sleepingWorkerCount { 0 }
+    , m_isRunning { false }
+    , m_sleepMutex {}
+    , m_wakeCondition {}
+{
+    // jobs can be scheduled before initialization, they run on the thread that waits for them
+    m_queues.push_back(std::make_unique<WorkQueue>());
+}
+
+engine::JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+engine::JobSystem& engine::JobSystem::GetInstance()
+{
+    static JobSystem instance {};
+    return instance;
+}
+
+void engine::JobSystem::Initialize(size_t workerCount)
+{
+    if (m_isRunning)
+    {
+        throw std::runtime_error("Tried to initialize the job system twice");
+    }
+
+    if (workerCount == 0)
+    {
+        size_t hardwareThreads = std::thread::hardware_concurrency();
+        workerCount            = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    m_isRunning = true;
+
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    m_workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        m_workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+    }
+}
+
+void engine::JobSystem::Shutdown()
+{
+    if (m_isRunning == false)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock { m_sleepMutex };
+        m_isRunning = false;
+    }
+
+    m_wakeCondition.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    m_workers.clear();
+
+    // finish whatever was left so no counter stays pending forever
+    while (TryRunOne())
+    {
+    }
+
+    m_queues.resize(1);
+}
+
+size_t engine::JobSystem::GetWorkerCount() const
+{
+    return m_workers.size();
+}
+
+void engine::JobSystem::WorkerLoop(size_t queueIndex)
+{
+    t_queueIndex = queueIndex;
+
+    size_t idleCount = 0;
+    while (true)
+    {
+        if (TryRunOne())
+        {
+            idleCount = 0;
+            continue;
+        }
+
+        if (m_isRunning.load(std::memory_order_acquire) == false)
+        {
+            break;
+        }
+
+        // spin for a while before going to sleep, new jobs usually come in bursts
+        if (++idleCount < Constants::SPIN_COUNT)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock { m_sleepMutex };
+
+        m_sleepingWorkerCount++;
+        m_wakeCondition.wait(lock,
+            [ this ]()
+            {
+                return m_queuedJobCount.load() > 0 || m_isRunning.load() == false;
+            });
+        m_sleepingWorkerCount--;
+
+        idleCount = 0;
+    }
+}
+
+bool engine::JobSystem::TryPop(size_t queueIndex, engine::Job& job)
+{
+    WorkQueue&                  queue = *m_queues[ queueIndex ];
+    std::lock_guard<std::mutex> lock { queue.m_mutex };
+
+    if (queue.m_jobs.empty())
+    {
+        return false;
+    }
+
+    // newest first, its data is most likely still in cache
+    job = queue.m_jobs.back();
+    queue.m_jobs.pop_back();
+
+    return true;
+}
+
+bool engine::JobSystem::TrySteal(size_t thiefIndex, engine::Job& job)
+{
+    size_t queueCount = m_queues.size();
+
+    for (size_t i = 1; i < queueCount; i++)
+    {
+        WorkQueue&                  queue = *m_queues[ (thiefIndex + i) % queueCount ];
+        std::lock_guard<std::mutex> lock { queue.m_mutex };
+
+        if (queue.m_jobs.empty() == false)
+        {
+            // oldest first, it is usually the biggest piece of work left
+            job = queue.m_jobs.front();
+            queue.m_jobs.pop_front();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool engine::JobSystem::TryRunOne()
+{
+    // cheap early out, avoids locking every deque while there is nothing to do
+    if (m_queuedJobCount.load(std::memory_order_acquire) == 0)
+    {
+        return false;
+    }
+
+    Job job {};
+    if (TryPop(t_queueIndex, job) == false && TrySteal(t_queueIndex, job) == false)
+    {
+        return false;
+    }
+
+    m_queuedJobCount.fetch_sub(1);
+    RunJob(job);
+
+    return true;
+}
+
+void engine::JobSystem::RunJob(const engine::Job& job)
+{
+    job.m_function(job.m_data, job.m_begin, job.m_end);
+
+    if (job.m_counter != nullptr)
+    {
+        job.m_counter->m_count.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void engine::JobSystem::WakeWorkers(size_t jobCount)
+{
+    if (m_sleepingWorkerCount.load() == 0)
+    {
+        return;
+    }
+
+    // taking the lock orders the notification after a worker that is about to sleep checked the queues
+    {
+        std::lock_guard<std::mutex> lock { m_sleepMutex };
+    }
+
+    if (jobCount == 1)
+    {
+        m_wakeCondition.notify_one();
+    }
+    else
+    {
+        m_wakeCondition.notify_all();
+    }
+}
+
+std::vector<engine::Job>& engine::JobSystem::GetChunkBuffer()
+{
+    return t_chunkBuffer;
+}
+
+void engine::JobSystem::Schedule(const engine::Job& job)
+{
+    Schedule(std::span<const Job> { &job, 1 });
+}
+
+void engine::JobSystem::Schedule(std::span<const engine::Job> jobs)
+{
+    if (jobs.empty())
+    {
+        return;
+    }
+
+    for (const Job& job : jobs)
+    {
+        if (job.m_counter != nullptr)
+        {
+            job.m_counter->m_count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // counted before they are visible, so the count never goes below the real number of jobs
+    m_queuedJobCount.fetch_add(jobs.size());
+
+    {
+        WorkQueue&                  queue = *m_queues[ t_queueIndex ];
+        std::lock_guard<std::mutex> lock { queue.m_mutex };
+
+        queue.m_jobs.insert(queue.m_jobs.end(), jobs.begin(), jobs.end());
+    }
+
+    WakeWorkers(jobs.size());
+}
+
+void engine::JobSystem::Wait(engine::JobCounter& counter)
+{
+    while (counter.IsDone() == false)
+    {
+        if (TryRunOne() == false)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
\ No newline at end of file
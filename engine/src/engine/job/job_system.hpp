@@ -0,0 +1,116 @@
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace engine
+{
+    // counts the jobs of a group that did not finish yet. must outlive the jobs it tracks
+    class JobCounter
+    {
+        friend class JobSystem;
+
+        std::atomic<size_t> m_count;
+
+      public:
+        JobCounter();
+        JobCounter(const JobCounter&)            = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool   IsDone() const;
+        size_t GetCount() const;
+    };
+
+    // a range of work, run as function(data, begin, end). jobs must not throw
+    struct Job
+    {
+        void (*m_function)(void* data, size_t begin, size_t end);
+        void*       m_data;
+        size_t      m_begin;
+        size_t      m_end;
+        JobCounter* m_counter;
+    };
+
+    // work-stealing job system. every worker thread owns a deque: it pushes and pops its own
+    // jobs from the back, and steals from the front of the other deques when it runs out.
+    // threads that are not workers share one extra deque, and help running jobs while they wait
+    class JobSystem
+    {
+        struct Constants
+        {
+            static constexpr size_t SPIN_COUNT        = 64;
+            static constexpr size_t CHUNKS_PER_THREAD = 4;
+        };
+
+        struct WorkQueue
+        {
+            std::mutex      m_mutex;
+            std::deque<Job> m_jobs;
+        };
+
+        std::vector<std::unique_ptr<WorkQueue>> m_queues; // one per worker, plus the shared one at index 0
+        std::vector<std::thread>                m_workers;
+
+        std::atomic<size_t>     m_queuedJobCount;
+        std::atomic<size_t>     m_sleepingWorkerCount;
+        std::atomic<bool>       m_isRunning;
+        std::mutex              m_sleepMutex;
+        std::condition_variable m_wakeCondition;
+
+        JobSystem();
+        ~JobSystem();
+        JobSystem(const JobSystem&)            = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        void WorkerLoop(size_t queueIndex);
+        bool TryPop(size_t queueIndex, Job& job);
+        bool TrySteal(size_t thiefIndex, Job& job);
+        bool TryRunOne();
+        void RunJob(const Job& job);
+        void WakeWorkers(size_t jobCount);
+
+        template <typename Func>
+        static void RunRange(void* data, size_t begin, size_t end);
+
+        // per thread, reused by ParallelFor to build its chunks without allocating every call
+        static std::vector<Job>& GetChunkBuffer();
+
+      public:
+        static JobSystem& GetInstance();
+
+        // workerCount 0 uses one worker per hardware thread, minus the calling thread
+        void Initialize(size_t workerCount = 0);
+        void Shutdown();
+
+        size_t GetWorkerCount() const;
+
+        // the counter of each job is incremented before it is queued
+        void Schedule(const Job& job);
+        void Schedule(std::span<const Job> jobs);
+
+        // runs func() on any thread. func is not copied, it must stay alive until the counter is done
+        template <typename Func>
+        void Run(JobCounter& counter, Func& func);
+
+        // blocks until the counter reaches zero, running queued jobs in the meantime
+        void Wait(JobCounter& counter);
+
+        // splits [begin, end) into chunks of at least grainSize elements and blocks until all ran.
+        // func is called either as func(index) or as func(chunkBegin, chunkEnd).
+        // grainSize 0 picks a chunk size from the worker count
+        template <typename Func>
+        void ParallelFor(size_t begin, size_t end, Func&& func, size_t grainSize = 0);
+    };
+} // namespace engine
+
+#include "job_system.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "job_system.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+template <typename Func>
+void engine::JobSystem::RunRange(void* data, size_t begin, size_t end)
+{
+    Func& func = *static_cast<Func*>(data);
+
+    if constexpr (std::is_invocable_v<Func&, size_t, size_t>)
+    {
+        func(begin, end);
+    }
+    else
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            func(i);
+        }
+    }
+}
+
+template <typename Func>
+void engine::JobSystem::Run(engine::JobCounter& counter, Func& func)
+{
+    static_assert(std::is_invocable_v<Func&>, "Jobs run with Run must be callable as func()");
+
+    Job job {};
+    job.m_function = [](void* data, size_t, size_t)
+    {
+        (*static_cast<Func*>(data))();
+    };
+    job.m_data    = const_cast<void*>(static_cast<const void*>(&func));
+    job.m_begin   = 0;
+    job.m_end     = 1;
+    job.m_counter = &counter;
+
+    Schedule(job);
+}
+
+template <typename Func>
+void engine::JobSystem::ParallelFor(size_t begin, size_t end, Func&& func, size_t grainSize)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    using FuncType = std::remove_reference_t<Func>;
+
+    size_t count       = end - begin;
+    size_t threadCount = GetWorkerCount() + 1;
+
+    if (grainSize == 0)
+    {
+        grainSize = std::max<size_t>(1, count / (threadCount * Constants::CHUNKS_PER_THREAD));
+    }
+
+    // not worth going through the queues
+    if (count <= grainSize || threadCount == 1)
+    {
+        RunRange<FuncType>(&func, begin, end);
+        return;
+    }
+
+    // schedule copies the jobs into the queue, so the buffer is free again before a nested
+    // ParallelFor can run on this thread while waiting
+    JobCounter        counter {};
+    std::vector<Job>& jobs = GetChunkBuffer();
+    jobs.clear();
+
+    for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize)
+    {
+        Job job {};
+        job.m_function = &RunRange<FuncType>;
+        job.m_data     = const_cast<void*>(static_cast<const void*>(&func));
+        job.m_begin    = chunkBegin;
+        job.m_end      = std::min(chunkBegin + grainSize, end);
+        job.m_counter  = &counter;
+
+        jobs.push_back(job);
+    }
+
+    Schedule(jobs);
+    jobs.clear();
+
+    Wait(counter);
+}
\ No newline at end of file
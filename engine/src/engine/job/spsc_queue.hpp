@@ -0,0 +1,53 @@
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace engine
+{
+    // bounded lock-free queue for exactly one producer thread and one consumer thread. the two
+    // indices live on separate cache lines, and each side caches the index of the other so
+    // that it only touches the shared line when the queue looks full or empty
+    template <typename T, size_t Capacity>
+    class SpscQueue
+    {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "The capacity of a queue must be a power of two");
+
+        struct Constants
+        {
+            static constexpr size_t CACHE_LINE_SIZE = 64;
+            static constexpr size_t INDEX_MASK      = Capacity - 1;
+        };
+
+        // indices grow forever and are masked on access, so full and empty are distinguishable
+        alignas(Constants::CACHE_LINE_SIZE) std::atomic<size_t> m_head; // next element to pop
+        size_t m_cachedTail;                                             // consumer copy of m_tail
+
+        alignas(Constants::CACHE_LINE_SIZE) std::atomic<size_t> m_tail; // next slot to push
+        size_t m_cachedHead;                                             // producer copy of m_head
+
+        alignas(Constants::CACHE_LINE_SIZE) T m_elements[ Capacity ];
+
+      public:
+        SpscQueue();
+        SpscQueue(const SpscQueue&)            = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        // producer only. returns false if the queue is full
+        bool TryPush(const T& element);
+
+        // consumer only. returns false if the queue is empty
+        bool TryPop(T& element);
+
+        // a snapshot, exact only on the consumer side while the producer is idle
+        size_t GetSize() const;
+        bool   IsEmpty() const;
+
+        static constexpr size_t GetCapacity();
+    };
+} // namespace engine
+
+#include "spsc_queue.inl"
+
+#endif
\ No newline at end of file
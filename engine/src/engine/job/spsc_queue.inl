@@ -0,0 +1,74 @@
+#include "spsc_queue.hpp"
+
+template <typename T, size_t Capacity>
+engine::SpscQueue<T, Capacity>::SpscQueue()
+    : m_head { 0 }
+    , m_cachedTail { 0 }
+    , m_tail { 0 }
+    , m_cachedHead { 0 }
+    , m_elements {}
+{
+}
+
+template <typename T, size_t Capacity>
+bool engine::SpscQueue<T, Capacity>::TryPush(const T& element)
+{
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_cachedHead == Capacity)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        if (tail - m_cachedHead == Capacity)
+        {
+            return false;
+        }
+    }
+
+    m_elements[ tail & Constants::INDEX_MASK ] = element;
+
+    // publishes the element to the consumer
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t Capacity>
+bool engine::SpscQueue<T, Capacity>::TryPop(T& element)
+{
+    size_t head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_cachedTail)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cachedTail)
+        {
+            return false;
+        }
+    }
+
+    element = m_elements[ head & Constants::INDEX_MASK ];
+
+    // hands the slot back to the producer
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t Capacity>
+size_t engine::SpscQueue<T, Capacity>::GetSize() const
+{
+    size_t head = m_head.load(std::memory_order_acquire);
+    size_t tail = m_tail.load(std::memory_order_acquire);
+
+    return tail - head;
+}
+
+template <typename T, size_t Capacity>
+bool engine::SpscQueue<T, Capacity>::IsEmpty() const
+{
+    return GetSize() == 0;
+}
+
+template <typename T, size_t Capacity>
+constexpr size_t engine::SpscQueue<T, Capacity>::GetCapacity()
+{
+    return Capacity;
+}
\ No newline at end of file
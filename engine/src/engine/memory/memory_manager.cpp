@@ -0,0 +1,29 @@
+#include "memory_manager.hpp"
+
+engine::MemoryManager& engine::MemoryManager::GetInstance()
+{
+    static MemoryManager instance {};
+    return instance;
+}
+
+engine::PoolAllocator& engine::MemoryManager::CreatePool(const char* name, size_t slotSize, size_t slotAlignment)
+{
+    m_pools.push_back(std::make_unique<PoolAllocator>(name, slotSize, slotAlignment));
+    return *m_pools.back();
+}
+
+void engine::MemoryManager::Trim()
+{
+    for (const std::unique_ptr<PoolAllocator>& pool : m_pools)
+    {
+        pool->Trim();
+    }
+}
+
+void engine::MemoryManager::ForEachPool(const std::function<void(const PoolAllocator&)>& func) const
+{
+    for (const std::unique_ptr<PoolAllocator>& pool : m_pools)
+    {
+        func(*pool);
+    }
+}
\ No newline at end of file
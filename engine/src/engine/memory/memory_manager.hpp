@@ -0,0 +1,45 @@
+#ifndef MEMORY_MANAGER_HPP
+#define MEMORY_MANAGER_HPP
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "pool_allocator.hpp"
+
+namespace engine
+{
+    // owns one pool per allocated type
+    class MemoryManager
+    {
+        std::vector<std::unique_ptr<PoolAllocator>> m_pools;
+
+        MemoryManager()                                = default;
+        ~MemoryManager()                               = default;
+        MemoryManager(const MemoryManager&)            = delete;
+        MemoryManager& operator=(const MemoryManager&) = delete;
+
+        PoolAllocator& CreatePool(const char* name, size_t slotSize, size_t slotAlignment);
+
+      public:
+        static MemoryManager& GetInstance();
+
+        template <typename T>
+        PoolAllocator& GetPool();
+
+        template <typename T, typename... Args>
+        T* New(Args&&... args);
+
+        template <typename T>
+        void Delete(T* object);
+
+        // releases the empty slabs of every pool
+        void Trim();
+
+        void ForEachPool(const std::function<void(const PoolAllocator&)>& func) const;
+    };
+} // namespace engine
+
+#include "memory_manager.inl"
+
+#endif
\ No newline at end of file
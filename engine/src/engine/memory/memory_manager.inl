@@ -0,0 +1,42 @@
+#include "memory_manager.hpp"
+
+#include <new>
+#include <typeinfo>
+#include <utility>
+
+template <typename T>
+engine::PoolAllocator& engine::MemoryManager::GetPool()
+{
+    // resolved once per type
+    static PoolAllocator& pool = CreatePool(typeid(T).name(), sizeof(T), alignof(T));
+    return pool;
+}
+
+template <typename T, typename... Args>
+T* engine::MemoryManager::New(Args&&... args)
+{
+    PoolAllocator& pool   = GetPool<T>();
+    void*          memory = pool.Allocate();
+
+    try
+    {
+        return new (memory) T { std::forward<Args>(args)... };
+    }
+    catch (...)
+    {
+        pool.Deallocate(memory);
+        throw;
+    }
+}
+
+template <typename T>
+void engine::MemoryManager::Delete(T* object)
+{
+    if (object == nullptr)
+    {
+        return;
+    }
+
+    object->~T();
+    GetPool<T>().Deallocate(object);
+}
\ No newline at end of file
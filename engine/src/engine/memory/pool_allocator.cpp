@@ -0,0 +1,267 @@
+#include "pool_allocator.hpp"
+
+#include <new> // align_val_t
+#include <stdexcept>
+
+namespace
+{
+    size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    size_t NextPowerOfTwo(size_t value)
+    {
+        size_t result = 1;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+
+        return result;
+    }
+} // namespace
+
+float engine::PoolStats::GetOccupancy() const
+{
+    if (m_capacity == 0)
+    {
+        return 0.0f;
+    }
+
+    return static_cast<float>(m_liveCount) / static_cast<float>(m_capacity);
+}
+
+engine::PoolAllocator::PoolAllocator(const char* name, size_t slotSize, size_t slotAlignment)
+    : m_name { name != nullptr ? name : "" }
+    , m_slotSize { 0 }
+    , m_slotAlignment { 0 }
+    , m_slabSize { 0 }
+    , m_firstSlotOffset { 0 }
+    , m_slotsPerSlab { 0 }
+    , m_emptySlabCount { 0 }
+    , m_liveCount { 0 }
+    , m_peakLiveCount { 0 }
+    , m_allocationCount { 0 }
+    , m_deallocationCount { 0 }
+{
+    if (slotSize == 0)
+    {
+        throw std::runtime_error("Tried to create a pool with a slot size of zero");
+    }
+
+    // free slots store the free list link in place
+    m_slotAlignment = slotAlignment < alignof(FreeSlot) ? alignof(FreeSlot) : slotAlignment;
+    m_slotSize      = AlignUp(slotSize < sizeof(FreeSlot) ? sizeof(FreeSlot) : slotSize, m_slotAlignment);
+
+    // the slab header lives at the start of the slab, slots come right after it
+    m_firstSlotOffset = AlignUp(sizeof(Slab), m_slotAlignment);
+
+    // slabs are power of two sized so that they can be aligned to their own size
+    m_slabSize = NextPowerOfTwo(m_firstSlotOffset + m_slotSize * Constants::MIN_SLAB_SLOTS);
+    if (m_slabSize < Constants::MIN_SLAB_SIZE)
+    {
+        m_slabSize = Constants::MIN_SLAB_SIZE;
+    }
+
+    m_slotsPerSlab = (m_slabSize - m_firstSlotOffset) / m_slotSize;
+}
+
+engine::PoolAllocator::~PoolAllocator()
+{
+    for (Slab* slab : m_slabs)
+    {
+        ::operator delete(slab, std::align_val_t { m_slabSize });
+    }
+
+    m_slabs.clear();
+    m_availableSlabs.clear();
+}
+
+engine::PoolAllocator::Slab* engine::PoolAllocator::CreateSlab()
+{
+    void* memory = ::operator new(m_slabSize, std::align_val_t { m_slabSize });
+
+    Slab* slab             = static_cast<Slab*>(memory);
+    slab->m_owner          = this;
+    slab->m_freeList       = nullptr;
+    slab->m_liveCount      = 0;
+    slab->m_bumpIndex      = 0;
+    slab->m_slabIndex      = m_slabs.size();
+    slab->m_availableIndex = Constants::NOT_IN_LIST;
+
+    m_slabs.push_back(slab);
+    AddAvailableSlab(slab);
+    m_emptySlabCount++;
+
+    return slab;
+}
+
+void engine::PoolAllocator::ReleaseSlab(engine::PoolAllocator::Slab* slab)
+{
+    RemoveAvailableSlab(slab);
+
+    // swap and pop from the slab list
+    Slab* last                   = m_slabs.back();
+    m_slabs[ slab->m_slabIndex ] = last;
+    last->m_slabIndex            = slab->m_slabIndex;
+    m_slabs.pop_back();
+
+    m_emptySlabCount--;
+
+    ::operator delete(slab, std::align_val_t { m_slabSize });
+}
+
+engine::PoolAllocator::Slab* engine::PoolAllocator::GetSlab(void* slot) const
+{
+    return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(slot) & ~(static_cast<uintptr_t>(m_slabSize) - 1));
+}
+
+void engine::PoolAllocator::AddAvailableSlab(engine::PoolAllocator::Slab* slab)
+{
+    slab->m_availableIndex = m_availableSlabs.size();
+    m_availableSlabs.push_back(slab);
+}
+
+void engine::PoolAllocator::RemoveAvailableSlab(engine::PoolAllocator::Slab* slab)
+{
+    if (slab->m_availableIndex == Constants::NOT_IN_LIST)
+    {
+        return;
+    }
+
+    Slab* last                                 = m_availableSlabs.back();
+    m_availableSlabs[ slab->m_availableIndex ] = last;
+    last->m_availableIndex                     = slab->m_availableIndex;
+    m_availableSlabs.pop_back();
+
+    slab->m_availableIndex = Constants::NOT_IN_LIST;
+}
+
+void* engine::PoolAllocator::Allocate()
+{
+    if (m_availableSlabs.empty())
+    {
+        CreateSlab();
+    }
+
+    Slab* slab = m_availableSlabs.back();
+
+    // reuse a freed slot first, otherwise take the next untouched one
+    void* slot = nullptr;
+    if (slab->m_freeList != nullptr)
+    {
+        slot             = slab->m_freeList;
+        slab->m_freeList = slab->m_freeList->m_next;
+    }
+    else
+    {
+        slot = reinterpret_cast<char*>(slab) + m_firstSlotOffset + slab->m_bumpIndex * m_slotSize;
+        slab->m_bumpIndex++;
+    }
+
+    if (slab->m_liveCount == 0)
+    {
+        m_emptySlabCount--;
+    }
+
+    slab->m_liveCount++;
+    if (slab->m_liveCount == m_slotsPerSlab)
+    {
+        RemoveAvailableSlab(slab);
+    }
+
+    m_liveCount++;
+    m_allocationCount++;
+    if (m_liveCount > m_peakLiveCount)
+    {
+        m_peakLiveCount = m_liveCount;
+    }
+
+    return slot;
+}
+
+void engine::PoolAllocator::Deallocate(void* slot)
+{
+    if (slot == nullptr)
+    {
+        return;
+    }
+
+    Slab* slab = GetSlab(slot);
+    if (slab->m_owner != this)
+    {
+        throw std::runtime_error("Tried to deallocate memory that does not belong to this pool");
+    }
+
+    // a full slab becomes available again
+    if (slab->m_liveCount == m_slotsPerSlab)
+    {
+        AddAvailableSlab(slab);
+    }
+
+    FreeSlot* freeSlot = static_cast<FreeSlot*>(slot);
+    freeSlot->m_next   = slab->m_freeList;
+    slab->m_freeList   = freeSlot;
+
+    slab->m_liveCount--;
+    m_liveCount--;
+    m_deallocationCount++;
+
+    if (slab->m_liveCount == 0)
+    {
+        m_emptySlabCount++;
+
+        // keep a few empty slabs around to avoid thrashing when objects are created and destroyed every frame
+        if (m_emptySlabCount > Constants::MAX_EMPTY_SLABS)
+        {
+            ReleaseSlab(slab);
+        }
+    }
+}
+
+bool engine::PoolAllocator::Owns(void* slot) const
+{
+    if (slot == nullptr)
+    {
+        return false;
+    }
+
+    for (Slab* slab : m_slabs)
+    {
+        if (slab == GetSlab(slot))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void engine::PoolAllocator::Trim()
+{
+    for (size_t i = m_slabs.size(); i > 0; i--)
+    {
+        Slab* slab = m_slabs[ i - 1 ];
+        if (slab->m_liveCount == 0)
+        {
+            ReleaseSlab(slab);
+        }
+    }
+}
+
+engine::PoolStats engine::PoolAllocator::GetStats() const
+{
+    PoolStats stats;
+    stats.m_name              = m_name.c_str();
+    stats.m_slotSize          = m_slotSize;
+    stats.m_slotsPerSlab      = m_slotsPerSlab;
+    stats.m_slabCount         = m_slabs.size();
+    stats.m_capacity          = m_slabs.size() * m_slotsPerSlab;
+    stats.m_liveCount         = m_liveCount;
+    stats.m_peakLiveCount     = m_peakLiveCount;
+    stats.m_allocationCount   = m_allocationCount;
+    stats.m_deallocationCount = m_deallocationCount;
+
+    return stats;
+}
\ No newline at end of file
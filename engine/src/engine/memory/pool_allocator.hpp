@@ -0,0 +1,96 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+    struct PoolStats
+    {
+        const char* m_name;
+        size_t      m_slotSize;
+        size_t      m_slotsPerSlab;
+        size_t      m_slabCount;
+        size_t      m_capacity;
+        size_t      m_liveCount;
+        size_t      m_peakLiveCount;
+        size_t      m_allocationCount;
+        size_t      m_deallocationCount;
+
+        // live slots / capacity, in range [0.0f, 1.0f]
+        float GetOccupancy() const;
+    };
+
+    // fixed-size slot allocator. memory is requested in slabs that are aligned to their own
+    // size, so the slab that owns a slot can be found by masking the slot address.
+    // freed slots are reused before a new slab is requested, and slabs with free slots are
+    // filled first so that objects of the same type stay packed together
+    // note: not thread safe
+    class PoolAllocator
+    {
+        struct Constants
+        {
+            static constexpr size_t MIN_SLAB_SIZE   = 64 * 1024;
+            static constexpr size_t MIN_SLAB_SLOTS  = 16;
+            static constexpr size_t NOT_IN_LIST     = static_cast<size_t>(-1);
+            static constexpr size_t MAX_EMPTY_SLABS = 1;
+        };
+
+        struct FreeSlot
+        {
+            FreeSlot* m_next;
+        };
+
+        struct Slab
+        {
+            PoolAllocator* m_owner;
+            FreeSlot*      m_freeList;
+            size_t         m_liveCount;
+            size_t         m_bumpIndex;
+            size_t         m_slabIndex;
+            size_t         m_availableIndex;
+        };
+
+        std::string m_name;
+        size_t      m_slotSize;
+        size_t      m_slotAlignment;
+        size_t      m_slabSize;
+        size_t      m_firstSlotOffset;
+        size_t      m_slotsPerSlab;
+
+        std::vector<Slab*> m_slabs;
+        std::vector<Slab*> m_availableSlabs; // slabs with at least one free slot
+        size_t             m_emptySlabCount;
+
+        size_t m_liveCount;
+        size_t m_peakLiveCount;
+        size_t m_allocationCount;
+        size_t m_deallocationCount;
+
+        Slab* CreateSlab();
+        void  ReleaseSlab(Slab* slab);
+        Slab* GetSlab(void* slot) const;
+
+        void AddAvailableSlab(Slab* slab);
+        void RemoveAvailableSlab(Slab* slab);
+
+      public:
+        PoolAllocator(const char* name, size_t slotSize, size_t slotAlignment);
+        ~PoolAllocator();
+        PoolAllocator(const PoolAllocator&)            = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        void* Allocate();
+        void  Deallocate(void* slot);
+        bool  Owns(void* slot) const;
+
+        // releases every slab without live slots
+        void Trim();
+
+        PoolStats GetStats() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,292 @@
+#include "render_pipeline.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <timing/frame_pacer.hpp>
+
+engine::RenderPipeline::RenderPipeline()
+    : m_snapshots {}
+    , m_states {}
+    , m_snapshotCount { 0 }
+    , m_writeSlot { 0 }
+    , m_handoff { Handoff::Queue }
+    , m_renderer { nullptr }
+    , m_renderThread {}
+    , m_mutex {}
+    , m_readyCondition {}
+    , m_freeCondition {}
+    , m_isRunning { false }
+    , m_isStopping { false }
+    , m_nextFrameIndex { 0 }
+    , m_publishedCount { 0 }
+    , m_presentedCount { 0 }
+    , m_droppedCount { 0 }
+    , m_waitTime { 0 }
+    , m_lastLatency { 0 }
+    , m_maxLatency { 0 }
+{
+}
+
+engine::RenderPipeline::~RenderPipeline()
+{
+    Stop();
+}
+
+void engine::RenderPipeline::Start(engine::Renderer& renderer, size_t snapshotCount, engine::RenderPipeline::Handoff handoff)
+{
+    if (m_isRunning)
+    {
+        throw std::runtime_error("Tried to start a render pipeline that is already running");
+    }
+
+    if (snapshotCount < Constants::MIN_SNAPSHOT_COUNT || snapshotCount > Constants::MAX_SNAPSHOT_COUNT)
+    {
+        throw std::runtime_error("Tried to start a render pipeline with an unsupported number of snapshots");
+    }
+
+    // with two snapshots, one being written and one being rendered, there would be none left for
+    // a newer frame to replace
+    if (handoff == Handoff::Latest && snapshotCount < Constants::MAX_SNAPSHOT_COUNT)
+    {
+        throw std::runtime_error("Tried to start a render pipeline that drops stale frames without three snapshots");
+    }
+
+    std::fill(std::begin(m_states), std::end(m_states), SlotState::Free);
+    m_snapshotCount = snapshotCount;
+    m_writeSlot     = snapshotCount;
+    m_handoff       = handoff;
+    m_renderer      = &renderer;
+    m_isRunning     = true;
+    m_isStopping    = false;
+
+    m_nextFrameIndex = 0;
+    m_publishedCount = 0;
+    m_presentedCount = 0;
+    m_droppedCount   = 0;
+    m_waitTime       = 0;
+    m_lastLatency    = 0;
+    m_maxLatency     = 0;
+
+    m_renderThread = std::thread { &RenderPipeline::RenderLoop, this };
+}
+
+void engine::RenderPipeline::Stop()
+{
+    if (!m_isRunning)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock { m_mutex };
+        m_isStopping = true;
+    }
+
+    m_readyCondition.notify_one();
+    m_renderThread.join();
+
+    // a frame begun but never ended is lost
+    m_writeSlot = m_snapshotCount;
+    m_renderer  = nullptr;
+    m_isRunning = false;
+}
+
+bool engine::RenderPipeline::IsRunning() const
+{
+    return m_isRunning;
+}
+
+size_t engine::RenderPipeline::FindFreeSlot() const
+{
+    for (size_t i = 0; i < m_snapshotCount; i++)
+    {
+        if (m_states[ i ] == SlotState::Free)
+        {
+            return i;
+        }
+    }
+
+    return m_snapshotCount;
+}
+
+size_t engine::RenderPipeline::FindReadySlot() const
+{
+    size_t result = m_snapshotCount;
+
+    for (size_t i = 0; i < m_snapshotCount; i++)
+    {
+        if (m_states[ i ] == SlotState::Ready && (result == m_snapshotCount || m_snapshots[ i ].m_frameIndex < m_snapshots[ result ].m_frameIndex))
+        {
+            result = i;
+        }
+    }
+
+    return result;
+}
+
+engine::RenderSnapshot& engine::RenderPipeline::BeginFrame()
+{
+    if (!m_isRunning)
+    {
+        throw std::runtime_error("Tried to begin a render frame on a render pipeline that is not running");
+    }
+
+    if (m_writeSlot != m_snapshotCount)
+    {
+        throw std::runtime_error("Tried to begin a render frame before ending the previous one");
+    }
+
+    uint64_t start = GetClockTime();
+    size_t   slot  = m_snapshotCount;
+
+    {
+        std::unique_lock<std::mutex> lock { m_mutex };
+        m_freeCondition.wait(lock,
+            [ & ]()
+            {
+                slot = FindFreeSlot();
+                return slot != m_snapshotCount;
+            });
+
+        m_states[ slot ]  = SlotState::Writing;
+        m_waitTime       += GetClockTime() - start;
+    }
+
+    m_writeSlot = slot;
+
+    RenderSnapshot& snapshot = m_snapshots[ slot ];
+    snapshot.Clear();
+
+    return snapshot;
+}
+
+void engine::RenderPipeline::EndFrame()
+{
+    if (m_writeSlot == m_snapshotCount)
+    {
+        throw std::runtime_error("Tried to end a render frame that was not begun");
+    }
+
+    RenderSnapshot& snapshot = m_snapshots[ m_writeSlot ];
+    snapshot.m_frameIndex    = m_nextFrameIndex++;
+    snapshot.m_publishTime   = GetClockTime();
+
+    {
+        std::lock_guard<std::mutex> lock { m_mutex };
+
+        if (m_handoff == Handoff::Latest)
+        {
+            for (size_t i = 0; i < m_snapshotCount; i++)
+            {
+                if (m_states[ i ] == SlotState::Ready)
+                {
+                    m_states[ i ] = SlotState::Free;
+                    ++m_droppedCount;
+                }
+            }
+        }
+
+        m_states[ m_writeSlot ] = SlotState::Ready;
+        ++m_publishedCount;
+    }
+
+    m_writeSlot = m_snapshotCount;
+    m_readyCondition.notify_one();
+}
+
+void engine::RenderPipeline::Flush()
+{
+    if (!m_isRunning)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock { m_mutex };
+    m_freeCondition.wait(lock, [ this ]() { return m_presentedCount + m_droppedCount == m_publishedCount; });
+}
+
+void engine::RenderPipeline::RenderLoop()
+{
+    m_renderer->Initialize();
+
+    while (true)
+    {
+        size_t slot = m_snapshotCount;
+
+        {
+            std::unique_lock<std::mutex> lock { m_mutex };
+            m_readyCondition.wait(lock,
+                [ & ]()
+                {
+                    slot = FindReadySlot();
+                    return slot != m_snapshotCount || m_isStopping;
+                });
+
+            // the frames published before Stop are still rendered
+            if (slot == m_snapshotCount)
+            {
+                break;
+            }
+
+            m_states[ slot ] = SlotState::Rendering;
+        }
+
+        RenderSnapshot& snapshot = m_snapshots[ slot ];
+        snapshot.Prepare();
+
+        m_renderer->Render(snapshot);
+        m_renderer->Present();
+
+        uint64_t latency = GetClockTime() - snapshot.m_publishTime;
+
+        {
+            std::lock_guard<std::mutex> lock { m_mutex };
+
+            m_states[ slot ] = SlotState::Free;
+            ++m_presentedCount;
+            m_lastLatency = latency;
+            m_maxLatency  = std::max(m_maxLatency, latency);
+        }
+
+        m_freeCondition.notify_all();
+    }
+
+    m_renderer->Shutdown();
+}
+
+uint64_t engine::RenderPipeline::GetPublishedCount() const
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    return m_publishedCount;
+}
+
+uint64_t engine::RenderPipeline::GetPresentedCount() const
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    return m_presentedCount;
+}
+
+uint64_t engine::RenderPipeline::GetDroppedCount() const
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    return m_droppedCount;
+}
+
+uint64_t engine::RenderPipeline::GetWaitTime() const
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    return m_waitTime;
+}
+
+uint64_t engine::RenderPipeline::GetLastLatency() const
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    return m_lastLatency;
+}
+
+uint64_t engine::RenderPipeline::GetMaxLatency() const
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    return m_maxLatency;
+}
\ No newline at end of file
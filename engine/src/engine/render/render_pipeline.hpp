@@ -0,0 +1,103 @@
+#ifndef RENDER_PIPELINE_HPP
+#define RENDER_PIPELINE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "render_snapshot.hpp"
+#include "renderer.hpp"
+
+namespace engine
+{
+    // runs a renderer on a dedicated thread, so that the simulation of frame n + 1 overlaps the
+    // submission and the swap of frame n. the two threads share a ring of two or three snapshots:
+    // the simulation fills one between BeginFrame and EndFrame while the render thread prepares
+    // and draws another, and they only synchronize to hand a snapshot over
+    class RenderPipeline
+    {
+      public:
+        struct Constants
+        {
+            static constexpr size_t MIN_SNAPSHOT_COUNT = 2;
+            static constexpr size_t MAX_SNAPSHOT_COUNT = 3;
+        };
+
+        enum class Handoff
+        {
+            // every frame is rendered in order. BeginFrame blocks while all the snapshots are in
+            // use, so the simulation is at most snapshotCount - 1 frames ahead of the render thread
+            Queue,
+            // needs three snapshots. the simulation never blocks: a new frame replaces the one
+            // waiting to be rendered, which is dropped, so the render thread only ever draws the
+            // newest frame
+            Latest
+        };
+
+      private:
+        enum class SlotState : uint8_t
+        {
+            Free,
+            Writing,
+            Ready,
+            Rendering
+        };
+
+        RenderSnapshot m_snapshots[ Constants::MAX_SNAPSHOT_COUNT ];
+        SlotState      m_states[ Constants::MAX_SNAPSHOT_COUNT ];
+        size_t         m_snapshotCount;
+        size_t         m_writeSlot;
+        Handoff        m_handoff;
+
+        Renderer*               m_renderer;
+        std::thread             m_renderThread;
+        mutable std::mutex      m_mutex;
+        std::condition_variable m_readyCondition; // a frame was published, or the pipeline stops
+        std::condition_variable m_freeCondition;  // a snapshot was freed
+        bool                    m_isRunning;
+        bool                    m_isStopping;
+
+        uint64_t m_nextFrameIndex;
+        uint64_t m_publishedCount;
+        uint64_t m_presentedCount;
+        uint64_t m_droppedCount;
+        uint64_t m_waitTime;    // the simulation spent blocked in BeginFrame, in nanoseconds
+        uint64_t m_lastLatency; // from EndFrame to the end of Present
+        uint64_t m_maxLatency;
+
+        void   RenderLoop();
+        size_t FindFreeSlot() const;  // m_snapshotCount if there is none
+        size_t FindReadySlot() const; // the oldest ready frame, m_snapshotCount if there is none
+
+      public:
+        RenderPipeline();
+        ~RenderPipeline();
+        RenderPipeline(const RenderPipeline&)            = delete;
+        RenderPipeline& operator=(const RenderPipeline&) = delete;
+
+        // the renderer must outlive the pipeline, or at least the call to Stop
+        void Start(Renderer& renderer, size_t snapshotCount = Constants::MIN_SNAPSHOT_COUNT, Handoff handoff = Handoff::Queue);
+
+        // renders the frames already published, then shuts the renderer down and joins the thread
+        void Stop();
+        bool IsRunning() const;
+
+        // simulation thread only. the snapshot is cleared, and belongs to the caller until EndFrame
+        RenderSnapshot& BeginFrame();
+        void            EndFrame();
+
+        // blocks until every published frame was presented or dropped
+        void Flush();
+
+        uint64_t GetPublishedCount() const;
+        uint64_t GetPresentedCount() const;
+        uint64_t GetDroppedCount() const;
+        uint64_t GetWaitTime() const;
+        uint64_t GetLastLatency() const;
+        uint64_t GetMaxLatency() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
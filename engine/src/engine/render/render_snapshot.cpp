@@ -0,0 +1,195 @@
+#include "render_snapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric> // iota
+#include <stdexcept>
+
+engine::RenderSnapshot::RenderSnapshot()
+    : m_frameIndex { 0 }
+    , m_publishTime { 0 }
+    , m_alpha { 0.0f }
+    , m_viewProjection { 1.0f }
+    , m_frustum {}
+    , m_hasCamera { false }
+    , m_isPrepared { false }
+    , m_transformations {}
+    , m_boundingRadii {}
+    , m_drawPackets {}
+    , m_matrices {}
+    , m_bounds {}
+    , m_visibleIndices {}
+    , m_isVisible {}
+{
+}
+
+void engine::RenderSnapshot::Clear()
+{
+    m_alpha          = 0.0f;
+    m_viewProjection = glm::mat4 { 1.0f };
+    m_hasCamera      = false;
+    m_isPrepared     = false;
+
+    m_transformations.Resize(0);
+    m_boundingRadii.clear();
+    m_drawPackets.clear();
+    m_matrices.clear();
+    m_visibleIndices.clear();
+}
+
+void engine::RenderSnapshot::SetAlpha(float alpha)
+{
+    m_alpha = alpha;
+}
+
+void engine::RenderSnapshot::SetCamera(const glm::mat4& viewProjection)
+{
+    m_viewProjection = viewProjection;
+    m_frustum        = Frustum::FromMatrix(viewProjection);
+    m_hasCamera      = true;
+}
+
+uint32_t engine::RenderSnapshot::AddTransformation(const engine::Transformation& transformation, float boundingRadius)
+{
+    size_t index = m_transformations.GetCount();
+
+    m_transformations.Resize(index + 1);
+    m_transformations.Set(index, transformation);
+    m_boundingRadii.push_back(boundingRadius);
+
+    return static_cast<uint32_t>(index);
+}
+
+uint32_t engine::RenderSnapshot::AddTransformations(const engine::TransformationArrays& transformations, const float* boundingRadii)
+{
+    size_t first = m_transformations.GetCount();
+    size_t count = transformations.m_count;
+
+    m_transformations.Resize(first + count);
+    m_boundingRadii.insert(m_boundingRadii.end(), boundingRadii, boundingRadii + count);
+
+    if (count == 0)
+    {
+        return static_cast<uint32_t>(first);
+    }
+
+    TransformationArrays arrays = m_transformations.GetArrays();
+    size_t               size   = count * sizeof(float);
+
+    std::memcpy(arrays.m_positionX + first, transformations.m_positionX, size);
+    std::memcpy(arrays.m_positionY + first, transformations.m_positionY, size);
+    std::memcpy(arrays.m_positionZ + first, transformations.m_positionZ, size);
+    std::memcpy(arrays.m_rotationX + first, transformations.m_rotationX, size);
+    std::memcpy(arrays.m_rotationY + first, transformations.m_rotationY, size);
+    std::memcpy(arrays.m_rotationZ + first, transformations.m_rotationZ, size);
+    std::memcpy(arrays.m_rotationW + first, transformations.m_rotationW, size);
+    std::memcpy(arrays.m_scaleX + first, transformations.m_scaleX, size);
+    std::memcpy(arrays.m_scaleY + first, transformations.m_scaleY, size);
+    std::memcpy(arrays.m_scaleZ + first, transformations.m_scaleZ, size);
+
+    return static_cast<uint32_t>(first);
+}
+
+void engine::RenderSnapshot::AddDrawPacket(const engine::DrawPacket& packet)
+{
+    if (packet.m_transformationIndex >= m_transformations.GetCount())
+    {
+        throw std::runtime_error("Tried to add a draw packet for a transformation not in the snapshot");
+    }
+
+    m_drawPackets.push_back(packet);
+}
+
+void engine::RenderSnapshot::Prepare()
+{
+    size_t               count  = m_transformations.GetCount();
+    TransformationArrays arrays = m_transformations.GetArrays();
+
+    m_matrices.resize(count);
+    if (count > 0)
+    {
+        ComputeTransformationMatrices(arrays, m_matrices.data());
+    }
+
+    m_visibleIndices.resize(count);
+    if (m_hasCamera)
+    {
+        m_bounds.Resize(count);
+        BoundingSphereArrays spheres = m_bounds.GetArrays();
+
+        ComputeBoundingSpheres(arrays, m_boundingRadii.data(), spheres);
+        m_visibleIndices.resize(CullSpheres(m_frustum, spheres, m_visibleIndices.data()));
+    }
+    else
+    {
+        std::iota(m_visibleIndices.begin(), m_visibleIndices.end(), 0u);
+    }
+
+    m_isVisible.assign(count, 0);
+    for (uint32_t index : m_visibleIndices)
+    {
+        m_isVisible[ index ] = 1;
+    }
+
+    std::erase_if(m_drawPackets, [ this ](const DrawPacket& packet) { return m_isVisible[ packet.m_transformationIndex ] == 0; });
+
+    // stable, so packets with the same key are drawn in the order they were added
+    std::stable_sort(m_drawPackets.begin(), m_drawPackets.end(), [](const DrawPacket& a, const DrawPacket& b) { return a.m_sortKey < b.m_sortKey; });
+
+    m_isPrepared = true;
+}
+
+bool engine::RenderSnapshot::IsPrepared() const
+{
+    return m_isPrepared;
+}
+
+uint64_t engine::RenderSnapshot::GetFrameIndex() const
+{
+    return m_frameIndex;
+}
+
+uint64_t engine::RenderSnapshot::GetPublishTime() const
+{
+    return m_publishTime;
+}
+
+float engine::RenderSnapshot::GetAlpha() const
+{
+    return m_alpha;
+}
+
+const glm::mat4& engine::RenderSnapshot::GetViewProjection() const
+{
+    return m_viewProjection;
+}
+
+bool engine::RenderSnapshot::HasCamera() const
+{
+    return m_hasCamera;
+}
+
+size_t engine::RenderSnapshot::GetTransformationCount() const
+{
+    return m_transformations.GetCount();
+}
+
+engine::Transformation engine::RenderSnapshot::GetTransformation(size_t index) const
+{
+    return m_transformations.Get(index);
+}
+
+const std::vector<glm::mat4>& engine::RenderSnapshot::GetMatrices() const
+{
+    return m_matrices;
+}
+
+const std::vector<uint32_t>& engine::RenderSnapshot::GetVisibleIndices() const
+{
+    return m_visibleIndices;
+}
+
+const std::vector<engine::DrawPacket>& engine::RenderSnapshot::GetDrawPackets() const
+{
+    return m_drawPackets;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef RENDER_SNAPSHOT_HPP
+#define RENDER_SNAPSHOT_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <engine/culling/frustum.hpp>
+#include <engine/culling/frustum_culling.hpp>
+#include <engine/transformation/transformation.hpp>
+#include <engine/transformation/transformation_batch.hpp>
+
+namespace engine
+{
+    // one draw of a mesh with a material at one of the transformations of a snapshot. the ids
+    // belong to the renderer, the engine only sorts the packets by key
+    struct DrawPacket
+    {
+        uint64_t m_sortKey;
+        uint32_t m_transformationIndex;
+        uint32_t m_mesh;
+        uint32_t m_material;
+    };
+
+    // everything a renderer needs to draw a frame, copied out of the game objects by the
+    // simulation, so that the render thread never reads state the next frame is changing.
+    // the containers keep their capacity between frames, so steady frames do not allocate
+    class RenderSnapshot
+    {
+        friend class RenderPipeline;
+
+        uint64_t  m_frameIndex;
+        uint64_t  m_publishTime; // on the GetClockTime clock
+        float     m_alpha;
+        glm::mat4 m_viewProjection;
+        Frustum   m_frustum;
+        bool      m_hasCamera;
+        bool      m_isPrepared;
+
+        TransformationBuffer m_transformations;
+        std::vector<float>   m_boundingRadii; // of a sphere centered on the origin of each transformation
+
+        std::vector<DrawPacket> m_drawPackets;
+
+        // computed by Prepare
+        std::vector<glm::mat4> m_matrices;
+        BoundingSphereBuffer   m_bounds;
+        std::vector<uint32_t>  m_visibleIndices;
+        std::vector<uint8_t>   m_isVisible;
+
+      public:
+        RenderSnapshot();
+
+        // simulation side
+        void Clear();
+        void SetAlpha(float alpha);
+        void SetCamera(const glm::mat4& viewProjection); // without a camera everything is visible
+
+        // return the index of the first transformation added, for the draw packets
+        uint32_t AddTransformation(const Transformation& transformation, float boundingRadius);
+        uint32_t AddTransformations(const TransformationArrays& transformations, const float* boundingRadii);
+
+        void AddDrawPacket(const DrawPacket& packet);
+
+        // computes the matrices and the visibility, then drops the draw packets of invisible
+        // transformations and sorts the rest by key. done by the render pipeline on the render
+        // thread, which takes the work off the simulation
+        void Prepare();
+        bool IsPrepared() const;
+
+        // renderer side
+        uint64_t         GetFrameIndex() const;
+        uint64_t         GetPublishTime() const;
+        float            GetAlpha() const;
+        const glm::mat4& GetViewProjection() const;
+        bool             HasCamera() const;
+
+        size_t         GetTransformationCount() const;
+        Transformation GetTransformation(size_t index) const;
+
+        // valid after Prepare
+        const std::vector<glm::mat4>&  GetMatrices() const;
+        const std::vector<uint32_t>&   GetVisibleIndices() const; // transformation indices, in increasing order
+        const std::vector<DrawPacket>& GetDrawPackets() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
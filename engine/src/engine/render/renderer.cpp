@@ -0,0 +1,74 @@
+#include "renderer.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include "render_snapshot.hpp"
+#include <timing/frame_pacer.hpp>
+
+engine::NullRenderer::NullRenderer()
+    : m_submitTime { 0 }
+    , m_presentTime { 0 }
+    , m_frameCount { 0 }
+    , m_drawCount { 0 }
+    , m_lastFrameIndex { 0 }
+    , m_outOfOrderCount { 0 }
+{
+}
+
+void engine::NullRenderer::SetSubmitTime(uint64_t submitTime)
+{
+    m_submitTime = submitTime;
+}
+
+void engine::NullRenderer::SetPresentTime(uint64_t presentTime)
+{
+    m_presentTime = presentTime;
+}
+
+void engine::NullRenderer::Render(const engine::RenderSnapshot& snapshot)
+{
+    if (m_frameCount > 0 && snapshot.GetFrameIndex() <= m_lastFrameIndex)
+    {
+        ++m_outOfOrderCount;
+    }
+
+    ++m_frameCount;
+    m_drawCount      += snapshot.GetDrawPackets().size();
+    m_lastFrameIndex  = snapshot.GetFrameIndex();
+
+    // busy, like a driver recording commands
+    uint64_t end = GetClockTime() + m_submitTime;
+    while (GetClockTime() < end)
+    {
+    }
+}
+
+void engine::NullRenderer::Present()
+{
+    // idle, like a swap waiting for the gpu
+    if (m_presentTime > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::nanoseconds { m_presentTime });
+    }
+}
+
+uint64_t engine::NullRenderer::GetFrameCount() const
+{
+    return m_frameCount;
+}
+
+uint64_t engine::NullRenderer::GetDrawCount() const
+{
+    return m_drawCount;
+}
+
+uint64_t engine::NullRenderer::GetLastFrameIndex() const
+{
+    return m_lastFrameIndex;
+}
+
+uint64_t engine::NullRenderer::GetOutOfOrderCount() const
+{
+    return m_outOfOrderCount;
+}
\ No newline at end of file
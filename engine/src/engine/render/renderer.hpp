@@ -0,0 +1,57 @@
+#ifndef RENDERER_HPP
+#define RENDERER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace engine
+{
+    class RenderSnapshot;
+
+    // a rendering backend, driven by the render thread of a RenderPipeline. the functions are all
+    // called on that thread, so a backend with a graphics context makes it current in Initialize.
+    // none of them may throw
+    class Renderer
+    {
+      public:
+        virtual ~Renderer() = default;
+
+        virtual void Initialize() {}
+        virtual void Shutdown() {}
+
+        // submits the draws of a prepared snapshot
+        virtual void Render(const RenderSnapshot& snapshot) = 0;
+
+        // shows the frame, this is where a backend blocks on the swap
+        virtual void Present() = 0;
+    };
+
+    // draws nothing, for servers and for testing the pipeline without a window. it can pretend
+    // to spend time submitting and presenting, to measure how much of it the pipeline hides
+    class NullRenderer : public Renderer
+    {
+        uint64_t m_submitTime;  // nanoseconds spent busy in Render
+        uint64_t m_presentTime; // nanoseconds blocked in Present
+
+        uint64_t m_frameCount;
+        uint64_t m_drawCount;
+        uint64_t m_lastFrameIndex;
+        uint64_t m_outOfOrderCount; // frames not newer than the one before them, which a pipeline must never produce
+
+      public:
+        NullRenderer();
+
+        void SetSubmitTime(uint64_t submitTime);
+        void SetPresentTime(uint64_t presentTime);
+
+        void Render(const RenderSnapshot& snapshot) override;
+        void Present() override;
+
+        uint64_t GetFrameCount() const;
+        uint64_t GetDrawCount() const;
+        uint64_t GetLastFrameIndex() const;
+        uint64_t GetOutOfOrderCount() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
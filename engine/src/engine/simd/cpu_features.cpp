@@ -0,0 +1,138 @@
+#include "cpu_features.hpp"
+
+#if ENGINE_SIMD_X86
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace
+{
+#if ENGINE_SIMD_X86
+    void CpuId(int leaf, int subleaf, int registers[ 4 ])
+    {
+#if defined(_MSC_VER)
+        __cpuidex(registers, leaf, subleaf);
+#else
+        unsigned int a = 0;
+        unsigned int b = 0;
+        unsigned int c = 0;
+        unsigned int d = 0;
+        __cpuid_count(leaf, subleaf, a, b, c, d);
+
+        registers[ 0 ] = static_cast<int>(a);
+        registers[ 1 ] = static_cast<int>(b);
+        registers[ 2 ] = static_cast<int>(c);
+        registers[ 3 ] = static_cast<int>(d);
+#endif
+    }
+
+    // the os must save the ymm registers on context switches, or avx can not be used
+    bool IsAvxStateEnabled()
+    {
+#if defined(_MSC_VER)
+        unsigned long long mask = _xgetbv(0);
+#else
+        unsigned int low  = 0;
+        unsigned int high = 0;
+        __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+        unsigned long long mask = (static_cast<unsigned long long>(high) << 32) | low;
+#endif
+        return (mask & 0x6) == 0x6;
+    }
+#endif
+
+    engine::CpuFeatures DetectCpuFeatures()
+    {
+        engine::CpuFeatures features {};
+
+#if ENGINE_SIMD_X86
+        int registers[ 4 ] = {};
+
+        CpuId(0, 0, registers);
+        int maxLeaf = registers[ 0 ];
+
+        if (maxLeaf >= 1)
+        {
+            CpuId(1, 0, registers);
+
+            bool hasOsxsave = (registers[ 2 ] & (1 << 27)) != 0;
+            bool hasAvx     = (registers[ 2 ] & (1 << 28)) != 0;
+
+            features.m_hasSse2 = (registers[ 3 ] & (1 << 26)) != 0;
+            features.m_hasFma  = (registers[ 2 ] & (1 << 12)) != 0;
+            features.m_hasF16c = (registers[ 2 ] & (1 << 29)) != 0;
+            features.m_hasAvx  = hasOsxsave && hasAvx && IsAvxStateEnabled();
+        }
+
+        if (maxLeaf >= 7 && features.m_hasAvx)
+        {
+            CpuId(7, 0, registers);
+            features.m_hasAvx2 = (registers[ 1 ] & (1 << 5)) != 0;
+        }
+
+        features.m_hasFma  = features.m_hasFma && features.m_hasAvx;
+        features.m_hasF16c = features.m_hasF16c && features.m_hasAvx;
+#endif
+
+        return features;
+    }
+
+    engine::SimdLevel GetBestSimdLevel()
+    {
+        const engine::CpuFeatures& features = engine::GetCpuFeatures();
+
+        if (features.m_hasAvx2 && features.m_hasFma && features.m_hasF16c)
+        {
+            return engine::SimdLevel::Avx2;
+        }
+
+        if (features.m_hasSse2)
+        {
+            return engine::SimdLevel::Sse2;
+        }
+
+        return engine::SimdLevel::Scalar;
+    }
+
+    engine::SimdLevel& GetCurrentSimdLevel()
+    {
+        static engine::SimdLevel level = GetBestSimdLevel();
+        return level;
+    }
+} // namespace
+
+const engine::CpuFeatures& engine::GetCpuFeatures()
+{
+    static const CpuFeatures features = DetectCpuFeatures();
+    return features;
+}
+
+engine::SimdLevel engine::GetSimdLevel()
+{
+    return GetCurrentSimdLevel();
+}
+
+void engine::SetSimdLevel(engine::SimdLevel level)
+{
+    SimdLevel best = GetBestSimdLevel();
+    GetCurrentSimdLevel() = level < best ? level : best;
+}
+
+const char* engine::GetSimdLevelName(engine::SimdLevel level)
+{
+    switch (level)
+    {
+        case SimdLevel::Scalar:
+            return "scalar";
+        case SimdLevel::Sse2:
+            return "sse2";
+        case SimdLevel::Avx2:
+            return "avx2";
+    }
+
+    return "unknown";
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef CPU_FEATURES_HPP
+#define CPU_FEATURES_HPP
+
+#include <cstddef>
+
+// x86 builds compile every kernel, the one that runs is picked at runtime
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ENGINE_SIMD_X86 1
+#else
+#define ENGINE_SIMD_X86 0
+#endif
+
+// lets a single function use instructions above the baseline the file is compiled for.
+// msvc accepts any intrinsic without this
+#if ENGINE_SIMD_X86 && !defined(_MSC_VER)
+#define ENGINE_TARGET_SSE2 __attribute__((target("sse2")))
+#define ENGINE_TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+#else
+#define ENGINE_TARGET_SSE2
+#define ENGINE_TARGET_AVX2
+#endif
+
+namespace engine
+{
+    struct CpuFeatures
+    {
+        bool m_hasSse2;
+        bool m_hasAvx;
+        bool m_hasAvx2;
+        bool m_hasFma;
+        bool m_hasF16c;
+    };
+
+    // best instruction set used by the batch kernels, in increasing order
+    enum class SimdLevel : size_t
+    {
+        Scalar,
+        Sse2,
+        Avx2 // with fma and f16c
+    };
+
+    // detected once, on first use
+    const CpuFeatures& GetCpuFeatures();
+
+    SimdLevel GetSimdLevel();
+
+    // forces a lower level, mostly for testing and benchmarking. levels the cpu does not
+    // support are clamped to the best supported one
+    void SetSimdLevel(SimdLevel level);
+
+    const char* GetSimdLevelName(SimdLevel level);
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "bounds.hpp"
+
+#include <utility>
+
+engine::Aabb engine::Aabb::FromCenterExtents(glm::vec3 center, glm::vec3 extents)
+{
+    return Aabb { center - extents, center + extents };
+}
+
+glm::vec3 engine::Aabb::GetCenter() const
+{
+    return (m_min + m_max) * 0.5f;
+}
+
+glm::vec3 engine::Aabb::GetExtents() const
+{
+    return (m_max - m_min) * 0.5f;
+}
+
+float engine::Aabb::GetSurfaceArea() const
+{
+    glm::vec3 size = m_max - m_min;
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+engine::Aabb engine::Aabb::Union(const engine::Aabb& other) const
+{
+    return Aabb { glm::min(m_min, other.m_min), glm::max(m_max, other.m_max) };
+}
+
+engine::Aabb engine::Aabb::Expand(float margin) const
+{
+    return Aabb { m_min - margin, m_max + margin };
+}
+
+engine::Aabb engine::Aabb::Transform(const glm::mat4& matrix) const
+{
+    // the new extents along each axis are the absolute projections of the old ones
+    glm::vec3 center  = GetCenter();
+    glm::vec3 extents = GetExtents();
+
+    glm::vec3 newCenter { matrix[ 3 ][ 0 ], matrix[ 3 ][ 1 ], matrix[ 3 ][ 2 ] };
+    glm::vec3 newExtents { 0.0f };
+
+    for (int column = 0; column < 3; column++)
+    {
+        glm::vec3 axis { matrix[ column ][ 0 ], matrix[ column ][ 1 ], matrix[ column ][ 2 ] };
+
+        newCenter  += axis * center[ column ];
+        newExtents += glm::abs(axis) * extents[ column ];
+    }
+
+    return FromCenterExtents(newCenter, newExtents);
+}
+
+bool engine::Aabb::Contains(const engine::Aabb& other) const
+{
+    return m_min.x <= other.m_min.x && m_min.y <= other.m_min.y && m_min.z <= other.m_min.z
+        && other.m_max.x <= m_max.x && other.m_max.y <= m_max.y && other.m_max.z <= m_max.z;
+}
+
+bool engine::Aabb::Overlaps(const engine::Aabb& other) const
+{
+    return m_min.x <= other.m_max.x && other.m_min.x <= m_max.x
+        && m_min.y <= other.m_max.y && other.m_min.y <= m_max.y
+        && m_min.z <= other.m_max.z && other.m_min.z <= m_max.z;
+}
+
+float engine::Aabb::GetDistanceSquared(glm::vec3 point) const
+{
+    glm::vec3 closest = glm::clamp(point, m_min, m_max);
+    glm::vec3 offset  = point - closest;
+
+    return glm::dot(offset, offset);
+}
+
+bool engine::Sphere::Overlaps(const engine::Aabb& box) const
+{
+    return box.GetDistanceSquared(m_center) <= m_radius * m_radius;
+}
+
+glm::vec3 engine::Ray::GetInverseDirection() const
+{
+    // zero components become infinities, which the slab test handles
+    return 1.0f / m_direction;
+}
+
+bool engine::Ray::Intersects(const engine::Aabb& box, glm::vec3 inverseDirection, float maxDistance, float& entryDistance) const
+{
+    float entry = 0.0f;
+    float exit  = maxDistance;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float slabEntry = (box.m_min[ axis ] - m_origin[ axis ]) * inverseDirection[ axis ];
+        float slabExit  = (box.m_max[ axis ] - m_origin[ axis ]) * inverseDirection[ axis ];
+
+        if (slabEntry > slabExit)
+        {
+            std::swap(slabEntry, slabExit);
+        }
+
+        // a ray parallel to the slab and on its plane gives nan, which must not reject the box
+        entry = slabEntry > entry ? slabEntry : entry;
+        exit  = slabExit < exit ? slabExit : exit;
+
+        if (entry > exit)
+        {
+            return false;
+        }
+    }
+
+    entryDistance = entry;
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef BOUNDS_HPP
+#define BOUNDS_HPP
+
+#include <glm/glm.hpp>
+
+namespace engine
+{
+    // axis aligned bounding box. a box with m_min greater than m_max on any axis is empty
+    struct Aabb
+    {
+        glm::vec3 m_min;
+        glm::vec3 m_max;
+
+        static Aabb FromCenterExtents(glm::vec3 center, glm::vec3 extents);
+
+        glm::vec3 GetCenter() const;
+        glm::vec3 GetExtents() const; // half the size
+        float     GetSurfaceArea() const;
+
+        Aabb Union(const Aabb& other) const;
+        Aabb Expand(float margin) const;
+
+        // bounds of the box once transformed by matrix, which must be affine
+        Aabb Transform(const glm::mat4& matrix) const;
+
+        bool Contains(const Aabb& other) const;
+        bool Overlaps(const Aabb& other) const;
+
+        // squared distance from point to the closest point of the box, 0 inside it
+        float GetDistanceSquared(glm::vec3 point) const;
+    };
+
+    struct Sphere
+    {
+        glm::vec3 m_center;
+        float     m_radius;
+
+        bool Overlaps(const Aabb& box) const;
+    };
+
+    // points along the ray are m_origin + m_direction * distance, for distances in [0, m_maxDistance]
+    struct Ray
+    {
+        glm::vec3 m_origin;
+        glm::vec3 m_direction; // unit length, so that distances are in world units
+        float     m_maxDistance;
+
+        glm::vec3 GetInverseDirection() const;
+
+        // slab test. on a hit, entryDistance is where the ray enters the box, 0 when it starts inside.
+        // inverseDirection is the one of GetInverseDirection, computed once per ray
+        bool Intersects(const Aabb& box, glm::vec3 inverseDirection, float maxDistance, float& entryDistance) const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "bounds_component.hpp"
+
+#include "spatial_system.hpp"
+#include <system/system_scheduler.hpp>
+
+engine::BoundsComponent::BoundsComponent()
+    : m_localBounds { glm::vec3 { -0.5f }, glm::vec3 { 0.5f } }
+    , m_worldBounds { glm::vec3 { -0.5f }, glm::vec3 { 0.5f } }
+    , m_system { nullptr }
+    , m_registryIndex { 0 }
+    , m_proxy { DynamicAabbTree::Constants::NULL_NODE }
+    , m_lastTransformation { nullptr }
+    , m_lastWorldVersion { 0 }
+    , m_isDirty { false }
+{
+}
+
+void engine::BoundsComponent::AddToSystem()
+{
+    SystemScheduler::GetInstance().GetSystem<SpatialSystem>().AddComponent(this);
+}
+
+void engine::BoundsComponent::RemoveFromSystem()
+{
+    // the system might be gone already when the scheduler shuts down first
+    if (m_system != nullptr)
+    {
+        m_system->RemoveComponent(this);
+    }
+}
+
+const engine::Aabb& engine::BoundsComponent::GetLocalBounds() const
+{
+    return m_localBounds;
+}
+
+void engine::BoundsComponent::SetLocalBounds(const engine::Aabb& bounds)
+{
+    m_localBounds = bounds;
+    m_isDirty     = true;
+}
+
+const engine::Aabb& engine::BoundsComponent::GetWorldBounds() const
+{
+    return m_worldBounds;
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef BOUNDS_COMPONENT_HPP
+#define BOUNDS_COMPONENT_HPP
+
+#include <engine/game_object/component.hpp>
+#include "bounds.hpp"
+#include "dynamic_aabb_tree.hpp"
+
+namespace engine
+{
+    class SpatialSystem;
+    class TransformationComponent;
+
+    // box around a game object, in the space of its transformation component, or in world space
+    // when it has none. the spatial system keeps the world bounds in its tree for scene queries.
+    // world bounds reflect the state of the last spatial system update
+    class BoundsComponent : public Component
+    {
+        friend class SpatialSystem;
+
+        Aabb m_localBounds;
+        Aabb m_worldBounds;
+
+        // bookkeeping of the spatial system
+        SpatialSystem*                 m_system;        // null while not registered
+        size_t                         m_registryIndex; // position inside the registered components
+        DynamicAabbTree::ProxyId       m_proxy;
+        const TransformationComponent* m_lastTransformation; // only compared, to notice a new component
+        size_t                         m_lastWorldVersion;
+        bool                           m_isDirty; // local bounds changed since the last update
+
+      protected:
+        void AddToSystem() override;
+        void RemoveFromSystem() override;
+
+      public:
+        BoundsComponent();
+
+        const Aabb& GetLocalBounds() const;
+        void        SetLocalBounds(const Aabb& bounds);
+
+        const Aabb& GetWorldBounds() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
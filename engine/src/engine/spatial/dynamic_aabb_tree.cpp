@@ -0,0 +1,633 @@
+#include "dynamic_aabb_tree.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+engine::DynamicAabbTree::DynamicAabbTree(float margin)
+    : m_nodes {}
+    , m_leaves {}
+    , m_root { Constants::NULL_NODE }
+    , m_freeList { Constants::NULL_NODE }
+    , m_proxyCount { 0 }
+    , m_margin { margin }
+{
+}
+
+engine::DynamicAabbTree::ProxyId engine::DynamicAabbTree::AllocateNode()
+{
+    ProxyId node = m_freeList;
+    if (node != Constants::NULL_NODE)
+    {
+        m_freeList = m_nodes[ node ].m_parent;
+    }
+    else
+    {
+        node = static_cast<ProxyId>(m_nodes.size());
+        m_nodes.emplace_back();
+        m_leaves.emplace_back();
+    }
+
+    Node& allocated           = m_nodes[ node ];
+    allocated.m_parent        = Constants::NULL_NODE;
+    allocated.m_children[ 0 ] = Constants::NULL_NODE;
+    allocated.m_children[ 1 ] = Constants::NULL_NODE;
+    allocated.m_height        = 0;
+
+    return node;
+}
+
+void engine::DynamicAabbTree::FreeNode(engine::DynamicAabbTree::ProxyId node)
+{
+    m_nodes[ node ].m_parent = m_freeList;
+    m_nodes[ node ].m_height = -1;
+    m_freeList               = node;
+}
+
+bool engine::DynamicAabbTree::IsProxy(engine::DynamicAabbTree::ProxyId proxy) const
+{
+    return proxy >= 0 && static_cast<size_t>(proxy) < m_nodes.size() && m_nodes[ proxy ].m_height == 0;
+}
+
+engine::DynamicAabbTree::ProxyId engine::DynamicAabbTree::CreateProxy(const engine::Aabb& bounds, void* userData)
+{
+    ProxyId proxy = AllocateNode();
+
+    m_nodes[ proxy ].m_bounds = bounds.Expand(m_margin);
+    m_leaves[ proxy ]         = Leaf { bounds, userData };
+
+    InsertLeaf(proxy);
+    m_proxyCount++;
+
+    return proxy;
+}
+
+void engine::DynamicAabbTree::DestroyProxy(engine::DynamicAabbTree::ProxyId proxy)
+{
+    if (IsProxy(proxy) == false)
+    {
+        throw std::runtime_error("Tried to destroy a proxy that is not in the tree");
+    }
+
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    m_proxyCount--;
+}
+
+bool engine::DynamicAabbTree::MoveProxy(engine::DynamicAabbTree::ProxyId proxy, const engine::Aabb& bounds)
+{
+    if (IsProxy(proxy) == false)
+    {
+        throw std::runtime_error("Tried to move a proxy that is not in the tree");
+    }
+
+    m_leaves[ proxy ].m_bounds = bounds;
+
+    if (m_nodes[ proxy ].m_bounds.Contains(bounds))
+    {
+        return false;
+    }
+
+    Aabb    enlarged = bounds.Expand(m_margin);
+    ProxyId parent   = m_nodes[ proxy ].m_parent;
+
+    // still next to its sibling, the tree keeps its shape and only the ancestors change
+    if (parent != Constants::NULL_NODE && m_nodes[ parent ].m_bounds.Contains(enlarged))
+    {
+        m_nodes[ proxy ].m_bounds = enlarged;
+        RefitAncestors(parent);
+        return true;
+    }
+
+    RemoveLeaf(proxy);
+    m_nodes[ proxy ].m_bounds = enlarged;
+    InsertLeaf(proxy);
+
+    return true;
+}
+
+engine::DynamicAabbTree::ProxyId engine::DynamicAabbTree::FindBestSibling(const engine::Aabb& bounds) const
+{
+    // branch and bound over the surface area cost of making each node the sibling of the leaf: the
+    // area of the new parent, plus how much every ancestor grows. a subtree is skipped once even a
+    // perfect fit below it could not beat the best sibling so far
+    struct Candidate
+    {
+        ProxyId m_node;
+        float   m_inheritedCost; // growth of the ancestors of m_node
+    };
+
+    Candidate              localStack[ Constants::STACK_SIZE ];
+    std::vector<Candidate> heapStack;
+    Candidate*             stack = localStack;
+
+    size_t stackSize = static_cast<size_t>(m_nodes[ m_root ].m_height) + 1;
+    if (stackSize > Constants::STACK_SIZE)
+    {
+        heapStack.resize(stackSize);
+        stack = heapStack.data();
+    }
+
+    float   leafArea = bounds.GetSurfaceArea();
+    ProxyId best     = m_root;
+    float   bestCost = m_nodes[ m_root ].m_bounds.Union(bounds).GetSurfaceArea();
+
+    size_t count     = 0;
+    stack[ count++ ] = Candidate { m_root, 0.0f };
+
+    while (count > 0)
+    {
+        Candidate   candidate = stack[ --count ];
+        const Node& node      = m_nodes[ candidate.m_node ];
+
+        float directCost = node.m_bounds.Union(bounds).GetSurfaceArea();
+        float cost       = directCost + candidate.m_inheritedCost;
+
+        if (cost < bestCost)
+        {
+            best     = candidate.m_node;
+            bestCost = cost;
+        }
+
+        if (node.m_height == 0)
+        {
+            continue;
+        }
+
+        float inheritedCost = candidate.m_inheritedCost + directCost - node.m_bounds.GetSurfaceArea();
+        if (leafArea + inheritedCost >= bestCost)
+        {
+            continue;
+        }
+
+        // the child that grows the least is visited first, good candidates early prune more
+        const Node& first  = m_nodes[ node.m_children[ 0 ] ];
+        const Node& second = m_nodes[ node.m_children[ 1 ] ];
+
+        float firstGrowth  = first.m_bounds.Union(bounds).GetSurfaceArea() - first.m_bounds.GetSurfaceArea();
+        float secondGrowth = second.m_bounds.Union(bounds).GetSurfaceArea() - second.m_bounds.GetSurfaceArea();
+        int   closer       = secondGrowth < firstGrowth ? 1 : 0;
+
+        stack[ count++ ] = Candidate { node.m_children[ 1 - closer ], inheritedCost };
+        stack[ count++ ] = Candidate { node.m_children[ closer ], inheritedCost };
+    }
+
+    return best;
+}
+
+void engine::DynamicAabbTree::InsertLeaf(engine::DynamicAabbTree::ProxyId leaf)
+{
+    if (m_root == Constants::NULL_NODE)
+    {
+        m_root                   = leaf;
+        m_nodes[ leaf ].m_parent = Constants::NULL_NODE;
+        return;
+    }
+
+    ProxyId sibling   = FindBestSibling(m_nodes[ leaf ].m_bounds);
+    ProxyId oldParent = m_nodes[ sibling ].m_parent;
+    ProxyId newParent = AllocateNode();
+
+    Node& parent           = m_nodes[ newParent ];
+    parent.m_parent        = oldParent;
+    parent.m_bounds        = m_nodes[ sibling ].m_bounds.Union(m_nodes[ leaf ].m_bounds);
+    parent.m_height        = m_nodes[ sibling ].m_height + 1;
+    parent.m_children[ 0 ] = sibling;
+    parent.m_children[ 1 ] = leaf;
+
+    if (oldParent == Constants::NULL_NODE)
+    {
+        m_root = newParent;
+    }
+    else
+    {
+        ProxyId* children                            = m_nodes[ oldParent ].m_children;
+        children[ children[ 0 ] == sibling ? 0 : 1 ] = newParent;
+    }
+
+    m_nodes[ sibling ].m_parent = newParent;
+    m_nodes[ leaf ].m_parent    = newParent;
+
+    RebalanceAncestors(newParent);
+}
+
+void engine::DynamicAabbTree::RemoveLeaf(engine::DynamicAabbTree::ProxyId leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = Constants::NULL_NODE;
+        return;
+    }
+
+    ProxyId parent      = m_nodes[ leaf ].m_parent;
+    ProxyId grandParent = m_nodes[ parent ].m_parent;
+    ProxyId sibling     = m_nodes[ parent ].m_children[ m_nodes[ parent ].m_children[ 0 ] == leaf ? 1 : 0 ];
+
+    // the sibling takes the place of the parent
+    m_nodes[ sibling ].m_parent = grandParent;
+    m_nodes[ leaf ].m_parent    = Constants::NULL_NODE;
+    FreeNode(parent);
+
+    if (grandParent == Constants::NULL_NODE)
+    {
+        m_root = sibling;
+        return;
+    }
+
+    ProxyId* children                           = m_nodes[ grandParent ].m_children;
+    children[ children[ 0 ] == parent ? 0 : 1 ] = sibling;
+
+    RebalanceAncestors(grandParent);
+}
+
+engine::DynamicAabbTree::ProxyId engine::DynamicAabbTree::Balance(engine::DynamicAabbTree::ProxyId a)
+{
+    // a left or right rotation if one subtree of a is taller than the other by more than one level.
+    // the taller child takes the place of a, which adopts the shorter grandchild
+    if (m_nodes[ a ].m_height < 2)
+    {
+        return a;
+    }
+
+    ProxyId b       = m_nodes[ a ].m_children[ 0 ];
+    ProxyId c       = m_nodes[ a ].m_children[ 1 ];
+    int32_t balance = m_nodes[ c ].m_height - m_nodes[ b ].m_height;
+
+    if (balance >= -1 && balance <= 1)
+    {
+        return a;
+    }
+
+    int     tallSide   = balance > 1 ? 1 : 0;
+    ProxyId tall       = m_nodes[ a ].m_children[ tallSide ];
+    ProxyId shortChild = m_nodes[ a ].m_children[ 1 - tallSide ];
+    ProxyId f          = m_nodes[ tall ].m_children[ 0 ];
+    ProxyId g          = m_nodes[ tall ].m_children[ 1 ];
+
+    // the tall child goes up
+    m_nodes[ tall ].m_children[ 0 ] = a;
+    m_nodes[ tall ].m_parent        = m_nodes[ a ].m_parent;
+    m_nodes[ a ].m_parent           = tall;
+
+    ProxyId tallParent = m_nodes[ tall ].m_parent;
+    if (tallParent == Constants::NULL_NODE)
+    {
+        m_root = tall;
+    }
+    else
+    {
+        ProxyId* children                      = m_nodes[ tallParent ].m_children;
+        children[ children[ 0 ] == a ? 0 : 1 ] = tall;
+    }
+
+    // the taller grandchild stays with the tall child, the shorter one moves under a
+    ProxyId kept  = m_nodes[ f ].m_height > m_nodes[ g ].m_height ? f : g;
+    ProxyId moved = kept == f ? g : f;
+
+    m_nodes[ tall ].m_children[ 1 ]     = kept;
+    m_nodes[ a ].m_children[ tallSide ] = moved;
+    m_nodes[ moved ].m_parent           = a;
+
+    m_nodes[ a ].m_bounds    = m_nodes[ shortChild ].m_bounds.Union(m_nodes[ moved ].m_bounds);
+    m_nodes[ a ].m_height    = 1 + std::max(m_nodes[ shortChild ].m_height, m_nodes[ moved ].m_height);
+    m_nodes[ tall ].m_bounds = m_nodes[ a ].m_bounds.Union(m_nodes[ kept ].m_bounds);
+    m_nodes[ tall ].m_height = 1 + std::max(m_nodes[ a ].m_height, m_nodes[ kept ].m_height);
+
+    return tall;
+}
+
+void engine::DynamicAabbTree::RebalanceAncestors(engine::DynamicAabbTree::ProxyId node)
+{
+    while (node != Constants::NULL_NODE)
+    {
+        node = Balance(node);
+
+        Node&   current = m_nodes[ node ];
+        ProxyId first   = current.m_children[ 0 ];
+        ProxyId second  = current.m_children[ 1 ];
+
+        current.m_bounds = m_nodes[ first ].m_bounds.Union(m_nodes[ second ].m_bounds);
+        current.m_height = 1 + std::max(m_nodes[ first ].m_height, m_nodes[ second ].m_height);
+
+        node = current.m_parent;
+    }
+}
+
+void engine::DynamicAabbTree::RefitAncestors(engine::DynamicAabbTree::ProxyId node)
+{
+    while (node != Constants::NULL_NODE)
+    {
+        Node&       current = m_nodes[ node ];
+        const Node& first   = m_nodes[ current.m_children[ 0 ] ];
+        const Node& second  = m_nodes[ current.m_children[ 1 ] ];
+
+        Aabb bounds = first.m_bounds.Union(second.m_bounds);
+
+        // the ancestors above an unchanged node are unchanged as well
+        if (bounds.m_min == current.m_bounds.m_min && bounds.m_max == current.m_bounds.m_max)
+        {
+            return;
+        }
+
+        current.m_bounds = bounds;
+        node             = current.m_parent;
+    }
+}
+
+void engine::DynamicAabbTree::Rebuild()
+{
+    std::vector<ProxyId> leaves;
+    leaves.reserve(m_proxyCount);
+
+    // internal nodes are rebuilt from scratch
+    for (size_t i = 0; i < m_nodes.size(); i++)
+    {
+        if (m_nodes[ i ].m_height == 0)
+        {
+            leaves.push_back(static_cast<ProxyId>(i));
+        }
+        else if (m_nodes[ i ].m_height > 0)
+        {
+            FreeNode(static_cast<ProxyId>(i));
+        }
+    }
+
+    m_root = BuildBinned(leaves);
+}
+
+engine::DynamicAabbTree::ProxyId engine::DynamicAabbTree::BuildBinned(std::vector<engine::DynamicAabbTree::ProxyId>& leaves)
+{
+    if (leaves.empty())
+    {
+        return Constants::NULL_NODE;
+    }
+
+    // top down, one range of leaves per task. the children of a node are created after it, so
+    // heights can be computed afterwards by walking the created nodes backwards
+    struct Task
+    {
+        size_t  m_begin;
+        size_t  m_end;
+        ProxyId m_parent;
+        int     m_childIndex;
+    };
+
+    struct Bin
+    {
+        Aabb   m_bounds;
+        size_t m_count;
+    };
+
+    std::vector<Task>    tasks { Task { 0, leaves.size(), Constants::NULL_NODE, 0 } };
+    std::vector<ProxyId> created;
+    ProxyId              root = Constants::NULL_NODE;
+
+    while (tasks.empty() == false)
+    {
+        Task task = tasks.back();
+        tasks.pop_back();
+
+        ProxyId node;
+        if (task.m_end - task.m_begin == 1)
+        {
+            node = leaves[ task.m_begin ];
+        }
+        else
+        {
+            Aabb bounds         = m_nodes[ leaves[ task.m_begin ] ].m_bounds;
+            Aabb centroidBounds = Aabb { bounds.GetCenter(), bounds.GetCenter() };
+            for (size_t i = task.m_begin + 1; i < task.m_end; i++)
+            {
+                const Aabb& leafBounds = m_nodes[ leaves[ i ] ].m_bounds;
+                glm::vec3   center     = leafBounds.GetCenter();
+
+                bounds         = bounds.Union(leafBounds);
+                centroidBounds = centroidBounds.Union(Aabb { center, center });
+            }
+
+            glm::vec3 centroidSize = centroidBounds.m_max - centroidBounds.m_min;
+            int       axis         = 0;
+            if (centroidSize.y > centroidSize[ axis ])
+            {
+                axis = 1;
+            }
+            if (centroidSize.z > centroidSize[ axis ])
+            {
+                axis = 2;
+            }
+
+            size_t middle = task.m_begin + (task.m_end - task.m_begin) / 2;
+
+            // leaves on top of each other can not be told apart by any split
+            if (centroidSize[ axis ] > 0.0f)
+            {
+                float binScale = static_cast<float>(Constants::BIN_COUNT) / centroidSize[ axis ];
+                auto  binIndex = [ & ](ProxyId leaf)
+                {
+                    float  offset = m_nodes[ leaf ].m_bounds.GetCenter()[ axis ] - centroidBounds.m_min[ axis ];
+                    size_t index  = static_cast<size_t>(offset * binScale);
+                    return std::min(index, Constants::BIN_COUNT - 1);
+                };
+
+                Bin bins[ Constants::BIN_COUNT ] = {};
+                for (size_t i = task.m_begin; i < task.m_end; i++)
+                {
+                    Bin&        bin        = bins[ binIndex(leaves[ i ]) ];
+                    const Aabb& leafBounds = m_nodes[ leaves[ i ] ].m_bounds;
+
+                    bin.m_bounds = bin.m_count == 0 ? leafBounds : bin.m_bounds.Union(leafBounds);
+                    bin.m_count++;
+                }
+
+                // cost of splitting after each bin, from a sweep in both directions
+                float  leftCosts[ Constants::BIN_COUNT ] = {};
+                Aabb   sweptBounds {};
+                size_t sweptCount = 0;
+                for (size_t i = 0; i + 1 < Constants::BIN_COUNT; i++)
+                {
+                    if (bins[ i ].m_count > 0)
+                    {
+                        sweptBounds = sweptCount == 0 ? bins[ i ].m_bounds : sweptBounds.Union(bins[ i ].m_bounds);
+                        sweptCount += bins[ i ].m_count;
+                    }
+
+                    leftCosts[ i ] = sweptCount > 0 ? sweptBounds.GetSurfaceArea() * static_cast<float>(sweptCount) : 0.0f;
+                }
+
+                size_t bestSplit  = Constants::BIN_COUNT;
+                float  bestCost   = 0.0f;
+                size_t totalCount = task.m_end - task.m_begin;
+
+                sweptCount = 0;
+                for (size_t i = Constants::BIN_COUNT - 1; i > 0; i--)
+                {
+                    if (bins[ i ].m_count > 0)
+                    {
+                        sweptBounds = sweptCount == 0 ? bins[ i ].m_bounds : sweptBounds.Union(bins[ i ].m_bounds);
+                        sweptCount += bins[ i ].m_count;
+                    }
+
+                    // the first and last bins are never empty, so every split has leaves on both sides
+                    float cost = leftCosts[ i - 1 ] + (sweptCount > 0 ? sweptBounds.GetSurfaceArea() * static_cast<float>(sweptCount) : 0.0f);
+                    if (sweptCount > 0 && sweptCount < totalCount && (bestSplit == Constants::BIN_COUNT || cost < bestCost))
+                    {
+                        bestSplit = i;
+                        bestCost  = cost;
+                    }
+                }
+
+                if (bestSplit != Constants::BIN_COUNT)
+                {
+                    std::vector<ProxyId>::iterator partition = std::partition(leaves.begin() + task.m_begin, leaves.begin() + task.m_end,
+                        [ & ](ProxyId leaf)
+                        {
+                            return binIndex(leaf) < bestSplit;
+                        });
+
+                    middle = static_cast<size_t>(partition - leaves.begin());
+                }
+            }
+
+            node = AllocateNode();
+
+            m_nodes[ node ].m_bounds = bounds;
+            m_nodes[ node ].m_height = 1;
+            created.push_back(node);
+
+            tasks.push_back(Task { task.m_begin, middle, node, 0 });
+            tasks.push_back(Task { middle, task.m_end, node, 1 });
+        }
+
+        m_nodes[ node ].m_parent = task.m_parent;
+        if (task.m_parent == Constants::NULL_NODE)
+        {
+            root = node;
+        }
+        else
+        {
+            m_nodes[ task.m_parent ].m_children[ task.m_childIndex ] = node;
+        }
+    }
+
+    for (size_t i = created.size(); i > 0; i--)
+    {
+        Node& node    = m_nodes[ created[ i - 1 ] ];
+        node.m_height = 1 + std::max(m_nodes[ node.m_children[ 0 ] ].m_height, m_nodes[ node.m_children[ 1 ] ].m_height);
+    }
+
+    return root;
+}
+
+void engine::DynamicAabbTree::Clear()
+{
+    m_nodes.clear();
+    m_leaves.clear();
+    m_root       = Constants::NULL_NODE;
+    m_freeList   = Constants::NULL_NODE;
+    m_proxyCount = 0;
+}
+
+void* engine::DynamicAabbTree::GetUserData(engine::DynamicAabbTree::ProxyId proxy) const
+{
+    return m_leaves[ proxy ].m_userData;
+}
+
+const engine::Aabb& engine::DynamicAabbTree::GetBounds(engine::DynamicAabbTree::ProxyId proxy) const
+{
+    return m_leaves[ proxy ].m_bounds;
+}
+
+const engine::Aabb& engine::DynamicAabbTree::GetEnlargedBounds(engine::DynamicAabbTree::ProxyId proxy) const
+{
+    return m_nodes[ proxy ].m_bounds;
+}
+
+size_t engine::DynamicAabbTree::GetProxyCount() const
+{
+    return m_proxyCount;
+}
+
+int32_t engine::DynamicAabbTree::GetHeight() const
+{
+    return m_root == Constants::NULL_NODE ? 0 : m_nodes[ m_root ].m_height;
+}
+
+float engine::DynamicAabbTree::GetAreaRatio() const
+{
+    if (m_root == Constants::NULL_NODE)
+    {
+        return 0.0f;
+    }
+
+    float area = 0.0f;
+    for (const Node& node : m_nodes)
+    {
+        if (node.m_height > 0)
+        {
+            area += node.m_bounds.GetSurfaceArea();
+        }
+    }
+
+    float rootArea = m_nodes[ m_root ].m_bounds.GetSurfaceArea();
+    return rootArea > 0.0f ? area / rootArea : 0.0f;
+}
+
+void engine::DynamicAabbTree::FindNearest(glm::vec3 point, size_t count, std::vector<engine::DynamicAabbTree::ProxyId>& results, float maxDistance) const
+{
+    results.clear();
+
+    if (m_root == Constants::NULL_NODE || count == 0)
+    {
+        return;
+    }
+
+    // best first: internal nodes are queued by the distance to their bounds, which is never more
+    // than the distance to any leaf below them, and leaves by the distance to their exact bounds.
+    // a leaf at the front of the queue is then closer than everything left
+    struct Candidate
+    {
+        float   m_distanceSquared;
+        ProxyId m_node;
+    };
+
+    auto isFarther = [](const Candidate& a, const Candidate& b)
+    {
+        return a.m_distanceSquared > b.m_distanceSquared;
+    };
+
+    auto distanceTo = [ this, point ](ProxyId node)
+    {
+        return (m_nodes[ node ].m_height == 0 ? m_leaves[ node ].m_bounds : m_nodes[ node ].m_bounds).GetDistanceSquared(point);
+    };
+
+    float                  maxDistanceSquared = maxDistance * maxDistance;
+    std::vector<Candidate> queue { Candidate { distanceTo(m_root), m_root } };
+
+    while (queue.empty() == false && results.size() < count)
+    {
+        std::pop_heap(queue.begin(), queue.end(), isFarther);
+        Candidate candidate = queue.back();
+        queue.pop_back();
+
+        if (candidate.m_distanceSquared > maxDistanceSquared)
+        {
+            break;
+        }
+
+        const Node& node = m_nodes[ candidate.m_node ];
+        if (node.m_height == 0)
+        {
+            results.push_back(candidate.m_node);
+            continue;
+        }
+
+        for (ProxyId child : node.m_children)
+        {
+            float distanceSquared = distanceTo(child);
+            if (distanceSquared <= maxDistanceSquared)
+            {
+                queue.push_back(Candidate { distanceSquared, child });
+                std::push_heap(queue.begin(), queue.end(), isFarther);
+            }
+        }
+    }
+}
\ No newline at end of file
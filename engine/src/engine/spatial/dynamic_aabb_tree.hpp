@@ -0,0 +1,120 @@
+#ifndef DYNAMIC_AABB_TREE_HPP
+#define DYNAMIC_AABB_TREE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "bounds.hpp"
+
+namespace engine
+{
+    // bounding volume hierarchy over a changing set of boxes. leaves store the bounds they were
+    // given, enlarged by a margin, so that small movements do not touch the tree. inserts pick the
+    // sibling with the lowest surface area cost and keep the tree balanced with rotations.
+    // Rebuild builds the whole tree again with a binned surface area heuristic, which gives better
+    // queries for content that does not move. queries test the exact bounds at the leaves
+    class DynamicAabbTree
+    {
+      public:
+        using ProxyId = int32_t;
+
+        struct Constants
+        {
+            static constexpr ProxyId NULL_NODE      = -1;
+            static constexpr float   DEFAULT_MARGIN = 0.1f;
+            static constexpr size_t  BIN_COUNT      = 16; // per axis, for Rebuild
+            static constexpr size_t  STACK_SIZE     = 64; // query stacks deeper than this go to the heap
+        };
+
+      private:
+        // only what the traversals need, the rest of the leaf data is kept aside
+        struct Node
+        {
+            Aabb    m_bounds; // enlarged by the margin for leaves
+            ProxyId m_parent; // next free node while the node is unused
+            ProxyId m_children[ 2 ];
+            int32_t m_height; // 0 for leaves, -1 while the node is unused
+        };
+
+        struct Leaf
+        {
+            Aabb  m_bounds; // exact
+            void* m_userData;
+        };
+
+        std::vector<Node> m_nodes;
+        std::vector<Leaf> m_leaves; // indexed like m_nodes, only meaningful for leaves
+        ProxyId           m_root;
+        ProxyId           m_freeList;
+        size_t            m_proxyCount;
+        float             m_margin;
+
+        ProxyId AllocateNode();
+        void    FreeNode(ProxyId node);
+
+        void    InsertLeaf(ProxyId leaf);
+        void    RemoveLeaf(ProxyId leaf);
+        ProxyId FindBestSibling(const Aabb& bounds) const;
+        ProxyId Balance(ProxyId node);
+
+        // recomputes the bounds and heights from node up to the root, rotating unbalanced nodes
+        void RebalanceAncestors(ProxyId node);
+
+        // recomputes the bounds and heights from node upwards, until a node does not change
+        void RefitAncestors(ProxyId node);
+
+        ProxyId BuildBinned(std::vector<ProxyId>& leaves);
+
+        bool IsProxy(ProxyId proxy) const;
+
+        template <typename Func>
+        static bool VisitLeaf(Func& func, ProxyId proxy);
+
+      public:
+        explicit DynamicAabbTree(float margin = Constants::DEFAULT_MARGIN);
+
+        ProxyId CreateProxy(const Aabb& bounds, void* userData);
+        void    DestroyProxy(ProxyId proxy);
+
+        // returns true when the tree changed. bounds that stay inside the enlarged ones only update
+        // the leaf. bounds that stay inside the parent of the leaf refit the ancestors in place,
+        // larger movements remove the leaf and insert it again
+        bool MoveProxy(ProxyId proxy, const Aabb& bounds);
+
+        void Rebuild();
+        void Clear();
+
+        void*       GetUserData(ProxyId proxy) const;
+        const Aabb& GetBounds(ProxyId proxy) const;
+        const Aabb& GetEnlargedBounds(ProxyId proxy) const;
+        size_t      GetProxyCount() const;
+        int32_t     GetHeight() const;
+
+        // sum of the surface areas of the internal nodes relative to the root, lower is better
+        float GetAreaRatio() const;
+
+        // func(ProxyId) is called for every proxy whose bounds overlap the shape. it may return
+        // false to stop the query, which then returns false
+        template <typename Func>
+        bool QueryOverlap(const Aabb& bounds, Func&& func) const;
+
+        template <typename Func>
+        bool QueryOverlap(const Sphere& sphere, Func&& func) const;
+
+        // func(ProxyId, float entryDistance) is called for the proxies the ray enters, roughly front
+        // to back, and returns the new maximum distance of the ray: the hit distance to only keep
+        // closer hits, the current maximum to keep going, or 0 to stop
+        template <typename Func>
+        void RayCast(const Ray& ray, Func&& func) const;
+
+        // the count proxies closest to point, sorted by distance to their bounds
+        void FindNearest(glm::vec3 point, size_t count, std::vector<ProxyId>& results, float maxDistance = std::numeric_limits<float>::max()) const;
+    };
+} // namespace engine
+
+#include "dynamic_aabb_tree.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "dynamic_aabb_tree.hpp"
+
+#include <type_traits>
+
+template <typename Func>
+bool engine::DynamicAabbTree::VisitLeaf(Func& func, engine::DynamicAabbTree::ProxyId proxy)
+{
+    if constexpr (std::is_void_v<std::invoke_result_t<Func&, ProxyId>>)
+    {
+        func(proxy);
+        return true;
+    }
+    else
+    {
+        return static_cast<bool>(func(proxy));
+    }
+}
+
+template <typename Func>
+bool engine::DynamicAabbTree::QueryOverlap(const engine::Aabb& bounds, Func&& func) const
+{
+    if (m_root == Constants::NULL_NODE)
+    {
+        return true;
+    }
+
+    // a depth first walk never holds more than one node per level, plus the children of the last
+    ProxyId              localStack[ Constants::STACK_SIZE ];
+    std::vector<ProxyId> heapStack;
+    ProxyId*             stack = localStack;
+
+    size_t stackSize = static_cast<size_t>(m_nodes[ m_root ].m_height) + 1;
+    if (stackSize > Constants::STACK_SIZE)
+    {
+        heapStack.resize(stackSize);
+        stack = heapStack.data();
+    }
+
+    size_t count     = 0;
+    stack[ count++ ] = m_root;
+
+    while (count > 0)
+    {
+        ProxyId     index = stack[ --count ];
+        const Node& node  = m_nodes[ index ];
+
+        if (node.m_bounds.Overlaps(bounds) == false)
+        {
+            continue;
+        }
+
+        if (node.m_height == 0)
+        {
+            if (m_leaves[ index ].m_bounds.Overlaps(bounds) && VisitLeaf(func, index) == false)
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        stack[ count++ ] = node.m_children[ 0 ];
+        stack[ count++ ] = node.m_children[ 1 ];
+    }
+
+    return true;
+}
+
+template <typename Func>
+bool engine::DynamicAabbTree::QueryOverlap(const engine::Sphere& sphere, Func&& func) const
+{
+    // the box around the sphere rejects most nodes with cheaper tests
+    Aabb sphereBounds = Aabb::FromCenterExtents(sphere.m_center, glm::vec3 { sphere.m_radius });
+
+    return QueryOverlap(sphereBounds,
+        [ this, &sphere, &func ](ProxyId proxy)
+        {
+            if (sphere.Overlaps(m_leaves[ proxy ].m_bounds) == false)
+            {
+                return true;
+            }
+
+            return VisitLeaf(func, proxy);
+        });
+}
+
+template <typename Func>
+void engine::DynamicAabbTree::RayCast(const engine::Ray& ray, Func&& func) const
+{
+    if (m_root == Constants::NULL_NODE)
+    {
+        return;
+    }
+
+    // nodes are tested before being pushed, the distance is kept to skip them once closer hits shortened the ray
+    struct StackEntry
+    {
+        ProxyId m_node;
+        float   m_entryDistance;
+    };
+
+    StackEntry              localStack[ Constants::STACK_SIZE ];
+    std::vector<StackEntry> heapStack;
+    StackEntry*             stack = localStack;
+
+    size_t stackSize = static_cast<size_t>(m_nodes[ m_root ].m_height) + 1;
+    if (stackSize > Constants::STACK_SIZE)
+    {
+        heapStack.resize(stackSize);
+        stack = heapStack.data();
+    }
+
+    glm::vec3 inverseDirection = ray.GetInverseDirection();
+    float     maxDistance      = ray.m_maxDistance;
+    float     entryDistance    = 0.0f;
+
+    if (ray.Intersects(m_nodes[ m_root ].m_bounds, inverseDirection, maxDistance, entryDistance) == false)
+    {
+        return;
+    }
+
+    size_t count     = 0;
+    stack[ count++ ] = StackEntry { m_root, entryDistance };
+
+    while (count > 0)
+    {
+        StackEntry entry = stack[ --count ];
+        if (entry.m_entryDistance > maxDistance)
+        {
+            continue;
+        }
+
+        const Node& node = m_nodes[ entry.m_node ];
+
+        if (node.m_height == 0)
+        {
+            if (ray.Intersects(m_leaves[ entry.m_node ].m_bounds, inverseDirection, maxDistance, entryDistance))
+            {
+                float newMaxDistance = func(entry.m_node, entryDistance);
+                if (newMaxDistance <= 0.0f)
+                {
+                    return;
+                }
+
+                maxDistance = newMaxDistance < maxDistance ? newMaxDistance : maxDistance;
+            }
+
+            continue;
+        }
+
+        float entries[ 2 ] = {};
+        bool  hits[ 2 ];
+        for (int i = 0; i < 2; i++)
+        {
+            hits[ i ] = ray.Intersects(m_nodes[ node.m_children[ i ] ].m_bounds, inverseDirection, maxDistance, entries[ i ]);
+        }
+
+        // the closer child is pushed last, so that it is visited first
+        int first = entries[ 1 ] < entries[ 0 ] ? 1 : 0;
+        if (hits[ 1 - first ])
+        {
+            stack[ count++ ] = StackEntry { node.m_children[ 1 - first ], entries[ 1 - first ] };
+        }
+
+        if (hits[ first ])
+        {
+            stack[ count++ ] = StackEntry { node.m_children[ first ], entries[ first ] };
+        }
+    }
+}
\ No newline at end of file
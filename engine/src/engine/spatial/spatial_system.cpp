@@ -0,0 +1,151 @@
+#include "spatial_system.hpp"
+
+#include <stdexcept>
+
+#include "bounds_component.hpp"
+#include <game_object/game_object.hpp>
+#include <transformation/transformation_component.hpp>
+
+engine::SpatialSystem::SpatialSystem()
+    : System { "Spatial System", SystemPhase::PostUpdate, 1 } // after the transform system
+    , m_components {}
+    , m_tree {}
+    , m_lastMovedCount { 0 }
+{
+}
+
+engine::SpatialSystem::~SpatialSystem()
+{
+    // components that outlive the system must not point to it
+    for (BoundsComponent* component : m_components)
+    {
+        component->m_system = nullptr;
+        component->m_proxy  = DynamicAabbTree::Constants::NULL_NODE;
+    }
+}
+
+void engine::SpatialSystem::AddComponent(engine::BoundsComponent* component)
+{
+    if (component->m_system != nullptr)
+    {
+        throw std::runtime_error("Tried to add a bounds component to the spatial system twice");
+    }
+
+    component->m_system        = this;
+    component->m_registryIndex = m_components.size();
+    m_components.push_back(component);
+
+    RefreshWorldBounds(component);
+    component->m_proxy = m_tree.CreateProxy(component->m_worldBounds, component);
+}
+
+void engine::SpatialSystem::RemoveComponent(engine::BoundsComponent* component)
+{
+    if (component->m_system != this)
+    {
+        throw std::runtime_error("Tried to remove a bounds component from a system that does not own it");
+    }
+
+    // swap and pop
+    BoundsComponent* last                      = m_components.back();
+    m_components[ component->m_registryIndex ] = last;
+    last->m_registryIndex                      = component->m_registryIndex;
+    m_components.pop_back();
+
+    m_tree.DestroyProxy(component->m_proxy);
+
+    component->m_proxy  = DynamicAabbTree::Constants::NULL_NODE;
+    component->m_system = nullptr;
+}
+
+void engine::SpatialSystem::RefreshWorldBounds(engine::BoundsComponent* component)
+{
+    const TransformationComponent* transformation = component->GetOwner()->GetComponent<TransformationComponent>();
+
+    component->m_worldBounds        = transformation != nullptr ? component->m_localBounds.Transform(transformation->GetWorldMatrix()) : component->m_localBounds;
+    component->m_lastTransformation = transformation;
+    component->m_lastWorldVersion   = transformation != nullptr ? transformation->GetWorldVersion() : 0;
+    component->m_isDirty            = false;
+}
+
+void engine::SpatialSystem::Update()
+{
+    m_lastMovedCount = 0;
+
+    for (BoundsComponent* component : m_components)
+    {
+        const TransformationComponent* transformation = component->GetOwner()->GetComponent<TransformationComponent>();
+
+        bool hasMoved = transformation != component->m_lastTransformation
+            || (transformation != nullptr && transformation->GetWorldVersion() != component->m_lastWorldVersion);
+
+        if (hasMoved == false && component->m_isDirty == false)
+        {
+            continue;
+        }
+
+        RefreshWorldBounds(component);
+
+        if (m_tree.MoveProxy(component->m_proxy, component->m_worldBounds))
+        {
+            m_lastMovedCount++;
+        }
+    }
+}
+
+size_t engine::SpatialSystem::GetComponentCount() const
+{
+    return m_components.size();
+}
+
+void engine::SpatialSystem::Rebuild()
+{
+    m_tree.Rebuild();
+}
+
+const engine::DynamicAabbTree& engine::SpatialSystem::GetTree() const
+{
+    return m_tree;
+}
+
+size_t engine::SpatialSystem::GetLastMovedCount() const
+{
+    return m_lastMovedCount;
+}
+
+engine::BoundsComponent* engine::SpatialSystem::RayCastClosest(const engine::Ray& ray, float* hitDistance) const
+{
+    BoundsComponent* closest         = nullptr;
+    float            closestDistance = ray.m_maxDistance;
+
+    RayCast(ray,
+        [ & ](BoundsComponent* component, float entryDistance)
+        {
+            closest         = component;
+            closestDistance = entryDistance;
+
+            // only closer hits from now on
+            return entryDistance;
+        });
+
+    if (closest != nullptr && hitDistance != nullptr)
+    {
+        *hitDistance = closestDistance;
+    }
+
+    return closest;
+}
+
+void engine::SpatialSystem::FindNearest(glm::vec3 point, size_t count, std::vector<engine::BoundsComponent*>& results, float maxDistance) const
+{
+    std::vector<DynamicAabbTree::ProxyId> proxies;
+    m_tree.FindNearest(point, count, proxies, maxDistance);
+
+    results.clear();
+    results.reserve(proxies.size());
+
+    for (DynamicAabbTree::ProxyId proxy : proxies)
+    {
+        results.push_back(static_cast<BoundsComponent*>(m_tree.GetUserData(proxy)));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef SPATIAL_SYSTEM_HPP
+#define SPATIAL_SYSTEM_HPP
+
+#include <limits>
+#include <vector>
+
+#include "bounds.hpp"
+#include "dynamic_aabb_tree.hpp"
+#include <engine/system/system.hpp>
+
+namespace engine
+{
+    class BoundsComponent;
+
+    // keeps the world bounds of every bounds component in a dynamic aabb tree, for ray casts,
+    // overlap and nearest queries over the scene. runs after the transform system, and only
+    // recomputes the bounds of objects whose world transformation or local bounds changed
+    class SpatialSystem : public System
+    {
+        friend class BoundsComponent;
+
+        std::vector<BoundsComponent*> m_components; // registration order, unordered
+        DynamicAabbTree               m_tree;
+        size_t                        m_lastMovedCount;
+
+        void RefreshWorldBounds(BoundsComponent* component);
+
+        template <typename Func>
+        static bool Visit(Func& func, BoundsComponent* component);
+
+      public:
+        SpatialSystem();
+        ~SpatialSystem() override;
+
+        void AddComponent(BoundsComponent* component);
+        void RemoveComponent(BoundsComponent* component);
+
+        void   Update() override;
+        size_t GetComponentCount() const override;
+
+        // builds the tree again with the surface area heuristic. worth it after loading content
+        // that will mostly stay in place, incremental updates degrade the tree over time
+        void Rebuild();
+
+        const DynamicAabbTree& GetTree() const;
+
+        // bounds whose tree proxy changed in the last update
+        size_t GetLastMovedCount() const;
+
+        // same as the DynamicAabbTree queries, with the components instead of the proxies
+        template <typename Func>
+        bool QueryOverlap(const Aabb& bounds, Func&& func) const;
+
+        template <typename Func>
+        bool QueryOverlap(const Sphere& sphere, Func&& func) const;
+
+        template <typename Func>
+        void RayCast(const Ray& ray, Func&& func) const;
+
+        // closest hit along the ray, null when nothing was hit
+        BoundsComponent* RayCastClosest(const Ray& ray, float* hitDistance = nullptr) const;
+
+        void FindNearest(glm::vec3 point, size_t count, std::vector<BoundsComponent*>& results, float maxDistance = std::numeric_limits<float>::max()) const;
+    };
+} // namespace engine
+
+#include "spatial_system.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "spatial_system.hpp"
+
+#include <type_traits>
+
+template <typename Func>
+bool engine::SpatialSystem::Visit(Func& func, engine::BoundsComponent* component)
+{
+    if constexpr (std::is_void_v<std::invoke_result_t<Func&, BoundsComponent*>>)
+    {
+        func(component);
+        return true;
+    }
+    else
+    {
+        return static_cast<bool>(func(component));
+    }
+}
+
+template <typename Func>
+bool engine::SpatialSystem::QueryOverlap(const engine::Aabb& bounds, Func&& func) const
+{
+    return m_tree.QueryOverlap(bounds,
+        [ this, &func ](DynamicAabbTree::ProxyId proxy)
+        {
+            return Visit(func, static_cast<BoundsComponent*>(m_tree.GetUserData(proxy)));
+        });
+}
+
+template <typename Func>
+bool engine::SpatialSystem::QueryOverlap(const engine::Sphere& sphere, Func&& func) const
+{
+    return m_tree.QueryOverlap(sphere,
+        [ this, &func ](DynamicAabbTree::ProxyId proxy)
+        {
+            return Visit(func, static_cast<BoundsComponent*>(m_tree.GetUserData(proxy)));
+        });
+}
+
+template <typename Func>
+void engine::SpatialSystem::RayCast(const engine::Ray& ray, Func&& func) const
+{
+    m_tree.RayCast(ray,
+        [ this, &func ](DynamicAabbTree::ProxyId proxy, float entryDistance)
+        {
+            return func(static_cast<BoundsComponent*>(m_tree.GetUserData(proxy)), entryDistance);
+        });
+}
\ No newline at end of file
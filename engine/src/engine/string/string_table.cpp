@@ -0,0 +1,65 @@
+#include "string_table.hpp"
+
+#include <stdexcept>
+
+engine::StringTable::StringTable()
+    : m_strings {}
+    , m_ids {}
+{
+    // id 0 is always the empty string
+    Intern("");
+}
+
+engine::StringTable& engine::StringTable::GetInstance()
+{
+    static StringTable instance {};
+    return instance;
+}
+
+engine::NameId engine::StringTable::Intern(std::string_view string)
+{
+    std::unordered_map<std::string_view, NameId>::const_iterator it = m_ids.find(string);
+    if (it != m_ids.end())
+    {
+        return it->second;
+    }
+
+    if (m_strings.size() >= INVALID_NAME)
+    {
+        throw std::runtime_error("String table is full");
+    }
+
+    NameId id = static_cast<NameId>(m_strings.size());
+    m_strings.emplace_back(string);
+
+    // key the map with a view of the stored copy
+    m_ids.emplace(std::string_view { m_strings.back() }, id);
+
+    return id;
+}
+
+engine::NameId engine::StringTable::Find(std::string_view string) const
+{
+    std::unordered_map<std::string_view, NameId>::const_iterator it = m_ids.find(string);
+    if (it == m_ids.end())
+    {
+        return INVALID_NAME;
+    }
+
+    return it->second;
+}
+
+std::string_view engine::StringTable::GetString(engine::NameId id) const
+{
+    if (id >= m_strings.size())
+    {
+        throw std::out_of_range("Invalid name id");
+    }
+
+    return m_strings[ id ];
+}
+
+size_t engine::StringTable::GetCount() const
+{
+    return m_strings.size();
+}
\ No newline at end of file
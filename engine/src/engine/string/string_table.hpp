@@ -0,0 +1,47 @@
+#ifndef STRING_TABLE_HPP
+#define STRING_TABLE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace engine
+{
+    using NameId = uint32_t;
+
+    // global table of interned strings. every distinct string is stored once and identified
+    // by a 32 bit id, so names can be compared and hashed as integers.
+    // views returned by the table stay valid (and null terminated) for the lifetime of the program
+    // note: not thread safe
+    class StringTable
+    {
+      public:
+        static constexpr NameId EMPTY_NAME   = 0;
+        static constexpr NameId INVALID_NAME = UINT32_MAX;
+
+      private:
+        std::deque<std::string>                      m_strings; // deque never moves its elements
+        std::unordered_map<std::string_view, NameId> m_ids;
+
+        StringTable();
+        ~StringTable()                             = default;
+        StringTable(const StringTable&)            = delete;
+        StringTable& operator=(const StringTable&) = delete;
+
+      public:
+        static StringTable& GetInstance();
+
+        // returns the id of the string, adding it to the table if needed
+        NameId Intern(std::string_view string);
+
+        // returns INVALID_NAME if the string was never interned
+        NameId Find(std::string_view string) const;
+
+        std::string_view GetString(NameId id) const;
+        size_t           GetCount() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
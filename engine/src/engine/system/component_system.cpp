@@ -0,0 +1,121 @@
+#include "component_system.hpp"
+
+#include <stdexcept>
+
+#include <game_object/component.hpp>
+
+engine::ComponentSystem::ComponentSystem(std::string_view name, engine::ComponentTypeId typeId, engine::SystemPhase phase, int order)
+    : System { name, phase, order }
+    , m_typeId { typeId }
+    , m_components {}
+    , m_activeCount { 0 }
+    , m_isUpdating { false }
+    , m_hasHoles { false }
+{
+}
+
+engine::ComponentSystem::~ComponentSystem()
+{
+    // components that outlive the system must not point to it
+    for (Component* component : m_components)
+    {
+        if (component != nullptr)
+        {
+            component->m_system = nullptr;
+        }
+    }
+}
+
+void engine::ComponentSystem::AddComponent(engine::Component* component)
+{
+    if (component->m_typeId != m_typeId)
+    {
+        throw std::runtime_error("Tried to add a component to the system of another component type");
+    }
+
+    if (component->m_system != nullptr)
+    {
+        throw std::runtime_error("Tried to add a component to a system twice");
+    }
+
+    component->m_system      = this;
+    component->m_systemIndex = m_components.size();
+    m_components.push_back(component);
+    m_activeCount++;
+}
+
+void engine::ComponentSystem::RemoveComponent(engine::Component* component)
+{
+    if (component->m_system != this)
+    {
+        throw std::runtime_error("Tried to remove a component from a system that does not own it");
+    }
+
+    size_t index = component->m_systemIndex;
+
+    component->m_system      = nullptr;
+    component->m_systemIndex = 0;
+    m_activeCount--;
+
+    // the update loop is walking the array, leave a hole and compact afterwards
+    if (m_isUpdating)
+    {
+        m_components[ index ] = nullptr;
+        m_hasHoles            = true;
+        return;
+    }
+
+    // swap and pop
+    Component* last       = m_components.back();
+    m_components[ index ] = last;
+    last->m_systemIndex   = index;
+    m_components.pop_back();
+}
+
+void engine::ComponentSystem::Compact()
+{
+    size_t count = 0;
+    for (Component* component : m_components)
+    {
+        if (component != nullptr)
+        {
+            component->m_systemIndex = count;
+            m_components[ count++ ]  = component;
+        }
+    }
+
+    m_components.resize(count);
+    m_hasHoles = false;
+}
+
+void engine::ComponentSystem::Update()
+{
+    m_isUpdating = true;
+
+    // components added during the update wait for the next frame
+    size_t count = m_components.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (Component* component = m_components[ i ])
+        {
+            component->Update();
+        }
+    }
+
+    m_isUpdating = false;
+
+    if (m_hasHoles)
+    {
+        Compact();
+    }
+}
+
+size_t engine::ComponentSystem::GetComponentCount() const
+{
+    return m_activeCount;
+}
+
+engine::ComponentTypeId engine::ComponentSystem::GetTypeId() const
+{
+    return m_typeId;
+}
\ No newline at end of file
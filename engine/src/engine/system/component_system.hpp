@@ -0,0 +1,42 @@
+#ifndef COMPONENT_SYSTEM_HPP
+#define COMPONENT_SYSTEM_HPP
+
+#include <vector>
+
+#include "system.hpp"
+#include <engine/game_object/component_type.hpp>
+
+namespace engine
+{
+    class Component;
+
+    // updates every registered component of one exact type, back to back. all the calls
+    // resolve to the same Update override, which keeps the branch predictor and the
+    // instruction cache warm compared to visiting each object in turn
+    class ComponentSystem : public System
+    {
+        ComponentTypeId         m_typeId;
+        std::vector<Component*> m_components;
+        size_t                  m_activeCount; // non null entries
+        bool                    m_isUpdating;
+        bool                    m_hasHoles;
+
+        void Compact();
+
+      public:
+        ComponentSystem(std::string_view name, ComponentTypeId typeId, SystemPhase phase = SystemPhase::Update, int order = 0);
+        ~ComponentSystem() override;
+
+        // components added while the system is updating are first updated on the next frame.
+        // components removed while it is updating are skipped
+        void AddComponent(Component* component);
+        void RemoveComponent(Component* component);
+
+        void   Update() override;
+        size_t GetComponentCount() const override;
+
+        ComponentTypeId GetTypeId() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "system.hpp"
+
+engine::System::System(std::string_view name, engine::SystemPhase phase, int order)
+    : m_name { name }
+    , m_phase { phase }
+    , m_order { order }
+    , m_updateCount { 0 }
+    , m_lastMicroseconds { 0.0 }
+    , m_totalMicroseconds { 0.0 }
+    , m_peakMicroseconds { 0.0 }
+{
+}
+
+void engine::System::RecordUpdate(double microseconds)
+{
+    m_updateCount++;
+    m_lastMicroseconds = microseconds;
+    m_totalMicroseconds += microseconds;
+
+    if (microseconds > m_peakMicroseconds)
+    {
+        m_peakMicroseconds = microseconds;
+    }
+}
+
+size_t engine::System::GetComponentCount() const
+{
+    return 0;
+}
+
+const std::string& engine::System::GetName() const
+{
+    return m_name;
+}
+
+engine::SystemPhase engine::System::GetPhase() const
+{
+    return m_phase;
+}
+
+int engine::System::GetOrder() const
+{
+    return m_order;
+}
+
+engine::SystemStats engine::System::GetStats() const
+{
+    SystemStats stats {};
+    stats.m_name                = m_name.c_str();
+    stats.m_phase               = m_phase;
+    stats.m_order               = m_order;
+    stats.m_componentCount      = GetComponentCount();
+    stats.m_updateCount         = m_updateCount;
+    stats.m_lastMicroseconds    = m_lastMicroseconds;
+    stats.m_averageMicroseconds = m_updateCount > 0 ? m_totalMicroseconds / static_cast<double>(m_updateCount) : 0.0;
+    stats.m_peakMicroseconds    = m_peakMicroseconds;
+
+    return stats;
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef SYSTEM_HPP
+#define SYSTEM_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace engine
+{
+    // systems run phase by phase, in this order
+    enum class SystemPhase : size_t
+    {
+        PreUpdate,
+        Update,
+        PostUpdate,
+
+        Count
+    };
+
+    struct SystemStats
+    {
+        const char* m_name;
+        SystemPhase m_phase;
+        int         m_order;
+        size_t      m_componentCount;
+        size_t      m_updateCount;
+
+        // wall time spent inside Update, in microseconds
+        double m_lastMicroseconds;
+        double m_averageMicroseconds;
+        double m_peakMicroseconds;
+    };
+
+    // a unit of per-frame work run by the system scheduler. inside a phase, systems run
+    // by ascending order, and by registration order when their order is the same
+    class System
+    {
+        friend class SystemScheduler;
+
+        std::string m_name;
+        SystemPhase m_phase;
+        int         m_order;
+
+        size_t m_updateCount;
+        double m_lastMicroseconds;
+        double m_totalMicroseconds;
+        double m_peakMicroseconds;
+
+        void RecordUpdate(double microseconds);
+
+      protected:
+        System(std::string_view name, SystemPhase phase = SystemPhase::Update, int order = 0);
+        System(const System&)            = delete;
+        System& operator=(const System&) = delete;
+
+      public:
+        virtual ~System() = default;
+
+        virtual void   Update() = 0;
+        virtual size_t GetComponentCount() const;
+
+        const std::string& GetName() const;
+        SystemPhase        GetPhase() const;
+        int                GetOrder() const;
+        SystemStats        GetStats() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
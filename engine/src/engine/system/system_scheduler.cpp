@@ -0,0 +1,132 @@
+#include "system_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include <game_object/component.hpp>
+
+engine::SystemScheduler::SystemScheduler()
+    : m_systems {}
+    , m_schedule {}
+    , m_componentSystems {}
+    , m_isScheduleDirty { false }
+    , m_systemsByType {}
+{
+}
+
+engine::SystemScheduler& engine::SystemScheduler::GetInstance()
+{
+    static SystemScheduler instance {};
+    return instance;
+}
+
+void engine::SystemScheduler::RebuildSchedule()
+{
+    m_schedule.clear();
+    m_schedule.reserve(m_systems.size());
+
+    for (const std::unique_ptr<System>& system : m_systems)
+    {
+        m_schedule.push_back(system.get());
+    }
+
+    // stable, so systems with the same phase and order keep their registration order
+    std::stable_sort(m_schedule.begin(), m_schedule.end(),
+        [](const System* a, const System* b)
+        {
+            if (a->m_phase != b->m_phase)
+            {
+                return a->m_phase < b->m_phase;
+            }
+
+            return a->m_order < b->m_order;
+        });
+
+    m_isScheduleDirty = false;
+}
+
+void engine::SystemScheduler::Update()
+{
+    if (m_isScheduleDirty)
+    {
+        RebuildSchedule();
+    }
+
+    // systems added while updating are scheduled on the next frame
+    for (size_t i = 0; i < m_schedule.size(); i++)
+    {
+        System* system = m_schedule[ i ];
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        system->Update();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        system->RecordUpdate(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+}
+
+void engine::SystemScheduler::Shutdown()
+{
+    m_schedule.clear();
+    m_componentSystems.clear();
+    m_systemsByType.clear();
+    m_systems.clear();
+    m_isScheduleDirty = false;
+}
+
+void engine::SystemScheduler::AddComponent(engine::Component* component)
+{
+    if (component == nullptr)
+    {
+        throw std::runtime_error("Tried to add a null component to a system");
+    }
+
+    GetComponentSystem(component->GetTypeId()).AddComponent(component);
+}
+
+void engine::SystemScheduler::RemoveComponent(engine::Component* component)
+{
+    if (component == nullptr)
+    {
+        throw std::runtime_error("Tried to remove a null component from a system");
+    }
+
+    // the component might not be registered, or the scheduler might already be shut down
+    if (component->m_system == nullptr)
+    {
+        return;
+    }
+
+    component->m_system->RemoveComponent(component);
+}
+
+engine::ComponentSystem& engine::SystemScheduler::GetComponentSystem(engine::ComponentTypeId typeId)
+{
+    if (typeId >= m_componentSystems.size())
+    {
+        m_componentSystems.resize(typeId + 1, nullptr);
+    }
+
+    if (m_componentSystems[ typeId ] == nullptr)
+    {
+        m_componentSystems[ typeId ] = &AddSystem<ComponentSystem>(GetComponentTypeName(typeId), typeId);
+    }
+
+    return *m_componentSystems[ typeId ];
+}
+
+void engine::SystemScheduler::SetSchedule(engine::System& system, engine::SystemPhase phase, int order)
+{
+    system.m_phase    = phase;
+    system.m_order    = order;
+    m_isScheduleDirty = true;
+}
+
+void engine::SystemScheduler::ForEachSystem(const std::function<void(const System&)>& func) const
+{
+    for (const std::unique_ptr<System>& system : m_systems)
+    {
+        func(*system);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef SYSTEM_SCHEDULER_HPP
+#define SYSTEM_SCHEDULER_HPP
+
+#include <functional>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "component_system.hpp"
+#include "system.hpp"
+
+namespace engine
+{
+    // runs every system once per frame, phase by phase. components opt in from their
+    // AddToSystem / RemoveFromSystem overrides, and get one system per component type
+    class SystemScheduler
+    {
+        std::vector<std::unique_ptr<System>> m_systems;          // registration order
+        std::vector<System*>                 m_schedule;         // execution order
+        std::vector<ComponentSystem*>        m_componentSystems; // indexed by component type id, null if none
+        bool                                 m_isScheduleDirty;
+
+        // systems created through GetSystem, one per type
+        std::unordered_map<std::type_index, System*> m_systemsByType;
+
+        SystemScheduler();
+        ~SystemScheduler()                                 = default;
+        SystemScheduler(const SystemScheduler&)            = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+        void RebuildSchedule();
+
+      public:
+        static SystemScheduler& GetInstance();
+
+        void Update();
+        void Shutdown();
+
+        // registers a component into the system of its exact type, creating the system if needed
+        void AddComponent(Component* component);
+        void RemoveComponent(Component* component);
+
+        template <typename T, typename... Args>
+        T& AddSystem(Args&&... args);
+
+        // the single instance of a system type, created on first use
+        template <typename T>
+        T& GetSystem();
+
+        // null if GetSystem<T> was never called
+        template <typename T>
+        T* FindSystem() const;
+
+        // the system that updates components of type T, created on first use
+        template <typename T>
+        ComponentSystem& GetComponentSystem();
+
+        ComponentSystem& GetComponentSystem(ComponentTypeId typeId);
+
+        // moves a system to another phase and order, applied on the next update
+        void SetSchedule(System& system, SystemPhase phase, int order = 0);
+
+        void ForEachSystem(const std::function<void(const System&)>& func) const;
+    };
+} // namespace engine
+
+#include "system_scheduler.inl"
+
+#endif
\ No newline at end of file
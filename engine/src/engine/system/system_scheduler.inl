@@ -0,0 +1,50 @@
+#include "system_scheduler.hpp"
+
+#include <typeinfo>
+#include <utility>
+
+#include <engine/game_object/component_type.hpp>
+
+template <typename T, typename... Args>
+T& engine::SystemScheduler::AddSystem(Args&&... args)
+{
+    std::unique_ptr<T> system = std::make_unique<T>(std::forward<Args>(args)...);
+    T&                 result = *system;
+
+    m_systems.push_back(std::move(system));
+    m_isScheduleDirty = true;
+
+    return result;
+}
+
+template <typename T>
+T& engine::SystemScheduler::GetSystem()
+{
+    if (T* system = FindSystem<T>())
+    {
+        return *system;
+    }
+
+    T& system = AddSystem<T>();
+    m_systemsByType.emplace(std::type_index { typeid(T) }, &system);
+
+    return system;
+}
+
+template <typename T>
+T* engine::SystemScheduler::FindSystem() const
+{
+    std::unordered_map<std::type_index, System*>::const_iterator it = m_systemsByType.find(std::type_index { typeid(T) });
+    if (it == m_systemsByType.end())
+    {
+        return nullptr;
+    }
+
+    return static_cast<T*>(it->second);
+}
+
+template <typename T>
+engine::ComponentSystem& engine::SystemScheduler::GetComponentSystem()
+{
+    return GetComponentSystem(GetComponentTypeId<T>());
+}
\ No newline at end of file
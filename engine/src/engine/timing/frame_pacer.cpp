@@ -0,0 +1,87 @@
+#include "frame_pacer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <simd/cpu_features.hpp>
+
+#if ENGINE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    // tells the cpu this is a spin loop, which saves power and frees the core for its sibling
+    // hyperthread
+    void SpinPause()
+    {
+#if ENGINE_SIMD_X86
+        _mm_pause();
+#endif
+    }
+} // namespace
+
+uint64_t engine::GetClockTime()
+{
+    std::chrono::steady_clock::duration time = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+}
+
+engine::FramePacer::FramePacer()
+    : m_sleepError { Constants::INITIAL_SLEEP_ERROR }
+    , m_lastSleepTime { 0 }
+    , m_lastSpinTime { 0 }
+{
+}
+
+void engine::FramePacer::WaitUntil(uint64_t deadline)
+{
+    uint64_t start = GetClockTime();
+    uint64_t now   = start;
+
+    m_lastSleepTime = 0;
+    m_lastSpinTime  = 0;
+
+    // one sleep per iteration, in case the os wakes the thread early
+    while (now < deadline && deadline - now > m_sleepError + Constants::MIN_SPIN_TIME)
+    {
+        uint64_t request = deadline - now - m_sleepError - Constants::MIN_SPIN_TIME;
+        std::this_thread::sleep_for(std::chrono::nanoseconds { request });
+
+        uint64_t woken = GetClockTime();
+        uint64_t slept = woken - now;
+        uint64_t error = slept > request ? slept - request : 0;
+
+        // rises at once on a late wake up, and decays slowly so that one lucky sleep does not
+        // cause a missed deadline on the next frame
+        m_sleepError = std::max(error, m_sleepError - (m_sleepError >> Constants::ERROR_DECAY_SHIFT));
+
+        m_lastSleepTime += slept;
+        now              = woken;
+    }
+
+    uint64_t spinStart = now;
+    while (now < deadline)
+    {
+        SpinPause();
+        now = GetClockTime();
+    }
+
+    m_lastSpinTime = now - spinStart;
+}
+
+uint64_t engine::FramePacer::GetSleepError() const
+{
+    return m_sleepError;
+}
+
+uint64_t engine::FramePacer::GetLastSleepTime() const
+{
+    return m_lastSleepTime;
+}
+
+uint64_t engine::FramePacer::GetLastSpinTime() const
+{
+    return m_lastSpinTime;
+}
\ No newline at end of file
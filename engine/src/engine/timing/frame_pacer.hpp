@@ -0,0 +1,42 @@
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include <cstdint>
+
+namespace engine
+{
+    // nanoseconds on a monotonic high resolution clock, with an arbitrary origin
+    uint64_t GetClockTime();
+
+    // waits until a deadline with little jitter. the os sleep wakes up late by up to its timer
+    // resolution (about 1 ms on linux, up to 15.6 ms on windows without a raised timer
+    // resolution), so the pacer sleeps until that error before the deadline and spins the rest.
+    // the error is measured on every sleep, so the spin stays short on systems with precise timers
+    class FramePacer
+    {
+      public:
+        struct Constants
+        {
+            static constexpr uint64_t INITIAL_SLEEP_ERROR = 2000000; // nanoseconds, until measured
+            static constexpr uint64_t MIN_SPIN_TIME       = 200000;  // nanoseconds, always spun
+            static constexpr uint64_t ERROR_DECAY_SHIFT   = 4;       // the estimate decays by 1/16 per sleep
+        };
+
+      private:
+        uint64_t m_sleepError; // estimate of how late a sleep wakes up
+        uint64_t m_lastSleepTime;
+        uint64_t m_lastSpinTime;
+
+      public:
+        FramePacer();
+
+        // returns immediately if the deadline already passed
+        void WaitUntil(uint64_t deadline);
+
+        uint64_t GetSleepError() const;
+        uint64_t GetLastSleepTime() const; // of the last WaitUntil
+        uint64_t GetLastSpinTime() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
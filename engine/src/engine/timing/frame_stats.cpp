@@ -0,0 +1,176 @@
+#include "frame_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+engine::FrameStats::FrameStats()
+    : m_history {}
+    , m_historyCount { 0 }
+    , m_next { 0 }
+    , m_frameCount { 0 }
+    , m_stepCount { 0 }
+    , m_droppedTime { 0 }
+    , m_clampedCount { 0 }
+{
+}
+
+void engine::FrameStats::Record(const engine::FrameTiming& timing)
+{
+    m_history[ m_next ] = timing;
+    m_next              = (m_next + 1) % Constants::HISTORY_SIZE;
+    m_historyCount      = std::min(m_historyCount + 1, Constants::HISTORY_SIZE);
+
+    ++m_frameCount;
+    m_stepCount += timing.m_stepCount;
+}
+
+void engine::FrameStats::AddDroppedTime(uint64_t droppedTime)
+{
+    m_droppedTime += droppedTime;
+    ++m_clampedCount;
+}
+
+void engine::FrameStats::Reset()
+{
+    m_historyCount = 0;
+    m_next         = 0;
+    m_frameCount   = 0;
+    m_stepCount    = 0;
+    m_droppedTime  = 0;
+    m_clampedCount = 0;
+}
+
+size_t engine::FrameStats::GetHistoryCount() const
+{
+    return m_historyCount;
+}
+
+const engine::FrameTiming& engine::FrameStats::GetHistory(size_t age) const
+{
+    if (age >= m_historyCount)
+    {
+        throw std::runtime_error("Tried to get a frame timing older than the history");
+    }
+
+    return m_history[ (m_next + Constants::HISTORY_SIZE - 1 - age) % Constants::HISTORY_SIZE ];
+}
+
+uint64_t engine::FrameStats::GetFrameCount() const
+{
+    return m_frameCount;
+}
+
+uint64_t engine::FrameStats::GetStepCount() const
+{
+    return m_stepCount;
+}
+
+uint64_t engine::FrameStats::GetDroppedTime() const
+{
+    return m_droppedTime;
+}
+
+uint64_t engine::FrameStats::GetClampedCount() const
+{
+    return m_clampedCount;
+}
+
+uint64_t engine::FrameStats::GetAverageFrameTime() const
+{
+    if (m_historyCount == 0)
+    {
+        return 0;
+    }
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < m_historyCount; ++i)
+    {
+        total += m_history[ i ].m_frameTime;
+    }
+
+    return total / m_historyCount;
+}
+
+uint64_t engine::FrameStats::GetMinFrameTime() const
+{
+    if (m_historyCount == 0)
+    {
+        return 0;
+    }
+
+    uint64_t result = m_history[ 0 ].m_frameTime;
+    for (size_t i = 1; i < m_historyCount; ++i)
+    {
+        result = std::min(result, m_history[ i ].m_frameTime);
+    }
+
+    return result;
+}
+
+uint64_t engine::FrameStats::GetMaxFrameTime() const
+{
+    uint64_t result = 0;
+    for (size_t i = 0; i < m_historyCount; ++i)
+    {
+        result = std::max(result, m_history[ i ].m_frameTime);
+    }
+
+    return result;
+}
+
+uint64_t engine::FrameStats::GetPercentileFrameTime(float percentile) const
+{
+    if (m_historyCount == 0)
+    {
+        return 0;
+    }
+
+    uint64_t frameTimes[ Constants::HISTORY_SIZE ];
+    for (size_t i = 0; i < m_historyCount; ++i)
+    {
+        frameTimes[ i ] = m_history[ i ].m_frameTime;
+    }
+
+    // nearest rank
+    float  clamped = std::clamp(percentile, 0.0f, 1.0f);
+    size_t rank    = static_cast<size_t>(std::ceil(clamped * m_historyCount));
+    size_t index   = rank > 0 ? rank - 1 : 0;
+
+    std::nth_element(frameTimes, frameTimes + index, frameTimes + m_historyCount);
+    return frameTimes[ index ];
+}
+
+uint64_t engine::FrameStats::GetAverageWorkTime() const
+{
+    if (m_historyCount == 0)
+    {
+        return 0;
+    }
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < m_historyCount; ++i)
+    {
+        total += m_history[ i ].m_workTime;
+    }
+
+    return total / m_historyCount;
+}
+
+uint64_t engine::FrameStats::GetJitter() const
+{
+    if (m_historyCount == 0)
+    {
+        return 0;
+    }
+
+    double average  = static_cast<double>(GetAverageFrameTime());
+    double variance = 0.0;
+    for (size_t i = 0; i < m_historyCount; ++i)
+    {
+        double difference  = static_cast<double>(m_history[ i ].m_frameTime) - average;
+        variance          += difference * difference;
+    }
+
+    return static_cast<uint64_t>(std::sqrt(variance / m_historyCount));
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef FRAME_STATS_HPP
+#define FRAME_STATS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace engine
+{
+    // times in nanoseconds
+    struct FrameTiming
+    {
+        uint64_t m_frameTime; // from the start of the previous frame to the start of this one
+        uint64_t m_workTime;  // input, simulation and render, before pacing
+        uint64_t m_waitTime;  // spent in the frame pacer
+        uint32_t m_stepCount; // fixed simulation steps run this frame
+        float    m_alpha;     // interpolation factor the frame was rendered with
+    };
+
+    // timings of the last frames, plus totals since the last reset
+    class FrameStats
+    {
+      public:
+        struct Constants
+        {
+            static constexpr size_t HISTORY_SIZE = 256;
+        };
+
+      private:
+        FrameTiming m_history[ Constants::HISTORY_SIZE ]; // ring buffer
+        size_t      m_historyCount;
+        size_t      m_next;
+
+        uint64_t m_frameCount;
+        uint64_t m_stepCount;
+        uint64_t m_droppedTime;  // simulation time thrown away by the catch up clamp
+        uint64_t m_clampedCount; // frames that hit the clamp
+
+      public:
+        FrameStats();
+
+        void Record(const FrameTiming& timing);
+        void AddDroppedTime(uint64_t droppedTime);
+        void Reset();
+
+        // age 0 is the last recorded frame, up to GetHistoryCount() - 1
+        size_t             GetHistoryCount() const;
+        const FrameTiming& GetHistory(size_t age) const;
+
+        uint64_t GetFrameCount() const;
+        uint64_t GetStepCount() const;
+        uint64_t GetDroppedTime() const;
+        uint64_t GetClampedCount() const;
+
+        // over the history, 0 if it is empty
+        uint64_t GetAverageFrameTime() const;
+        uint64_t GetMinFrameTime() const;
+        uint64_t GetMaxFrameTime() const;
+        uint64_t GetPercentileFrameTime(float percentile) const; // percentile in [0, 1]
+        uint64_t GetAverageWorkTime() const;
+        uint64_t GetJitter() const; // standard deviation of the frame time
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,700 @@
+#include "quantized_transformation.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include <simd/cpu_features.hpp>
+
+#if ENGINE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    constexpr float COMPONENT_RANGE      = 0.70710678f; // 1/sqrt(2), the largest a non largest component can be
+    constexpr float POSITION_LEVELS      = 65534.0f; // even, so that the center of the bounds is exact
+    constexpr float SCALE_RELATIVE_ERROR = 4.9e-4f; // 2^-11, half of a half float mantissa step
+
+    // float <-> half float conversions, rounding to nearest even like the f16c instructions
+
+    uint16_t FloatToHalf(float value)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        uint16_t half = 0;
+        if (bits >= (127u + 16u) << 23) // too large, infinity or nan
+        {
+            half = bits > 0x7F800000u ? 0x7E00 : 0x7C00;
+        }
+        else if (bits < 113u << 23) // subnormal or zero, let the fpu do the rounding
+        {
+            constexpr uint32_t MAGIC_BITS = 126u << 23;
+
+            float magic = 0.0f;
+            std::memcpy(&magic, &MAGIC_BITS, sizeof(magic));
+
+            float shifted = 0.0f;
+            std::memcpy(&shifted, &bits, sizeof(shifted));
+            shifted += magic;
+
+            std::memcpy(&bits, &shifted, sizeof(bits));
+            half = static_cast<uint16_t>(bits - MAGIC_BITS);
+        }
+        else
+        {
+            uint32_t isMantissaOdd = (bits >> 13) & 1u;
+            bits += 0xC8000FFFu + isMantissaOdd; // rebias the exponent and round
+            half = static_cast<uint16_t>(bits >> 13);
+        }
+
+        return static_cast<uint16_t>(half | (sign >> 16));
+    }
+
+    float HalfToFloat(uint16_t half)
+    {
+        constexpr uint32_t SHIFTED_EXPONENT = 0x7C00u << 13;
+        constexpr uint32_t MAGIC_BITS       = 113u << 23;
+
+        uint32_t bits     = (half & 0x7FFFu) << 13;
+        uint32_t exponent = bits & SHIFTED_EXPONENT;
+        bits += (127u - 15u) << 23;
+
+        if (exponent == SHIFTED_EXPONENT) // infinity or nan
+        {
+            bits += (128u - 16u) << 23;
+        }
+        else if (exponent == 0) // subnormal or zero
+        {
+            float magic = 0.0f;
+            std::memcpy(&magic, &MAGIC_BITS, sizeof(magic));
+
+            bits += 1u << 23;
+
+            float value = 0.0f;
+            std::memcpy(&value, &bits, sizeof(value));
+            value -= magic;
+            std::memcpy(&bits, &value, sizeof(bits));
+        }
+
+        bits |= static_cast<uint32_t>(half & 0x8000u) << 16;
+
+        float value = 0.0f;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    uint32_t Quantize(float value, float offset, float scale, float levels)
+    {
+        float quantized = (value + offset) * scale + 0.5f;
+        quantized       = quantized < 0.0f ? 0.0f : quantized;
+        quantized       = quantized > levels ? levels : quantized;
+
+        return static_cast<uint32_t>(quantized);
+    }
+
+    // one code is left unused so that the count is even and zero is exact
+    float GetComponentLevels(uint32_t bits)
+    {
+        return static_cast<float>((1u << bits) - 2u);
+    }
+
+    // finds the dropped component and quantizes the other three
+    void EncodeSmallestThree(const engine::Rotation& rotation, uint32_t bits, uint32_t& index, uint32_t components[ 3 ])
+    {
+        glm::quat quaternion  = rotation.GetQuaternion();
+        float     values[ 4 ] = { quaternion.x, quaternion.y, quaternion.z, quaternion.w };
+
+        index = 0;
+        for (uint32_t i = 1; i < 4; ++i)
+        {
+            if (std::fabs(values[ i ]) > std::fabs(values[ index ]))
+            {
+                index = i;
+            }
+        }
+
+        float levels = GetComponentLevels(bits);
+        float scale  = levels / (2.0f * COMPONENT_RANGE);
+        float sign   = values[ index ] < 0.0f ? -1.0f : 1.0f;
+
+        uint32_t next = 0;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i != index)
+            {
+                components[ next++ ] = Quantize(values[ i ] * sign, COMPONENT_RANGE, scale, levels);
+            }
+        }
+    }
+
+    engine::Rotation DecodeSmallestThree(uint32_t index, const uint32_t components[ 3 ], uint32_t bits)
+    {
+        float step = 2.0f * COMPONENT_RANGE / GetComponentLevels(bits);
+
+        float a = static_cast<float>(components[ 0 ]) * step - COMPONENT_RANGE;
+        float b = static_cast<float>(components[ 1 ]) * step - COMPONENT_RANGE;
+        float c = static_cast<float>(components[ 2 ]) * step - COMPONENT_RANGE;
+
+        // the three smallest components of a unit quaternion never sum above 3/4, so this stays positive
+        float squaredSum = a * a + b * b + c * c;
+        float d          = std::sqrt(squaredSum < 1.0f ? 1.0f - squaredSum : 0.0f);
+
+        float    kept[ 3 ]   = { a, b, c };
+        float    values[ 4 ] = {};
+        uint32_t next        = 0;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            values[ i ] = i == index ? d : kept[ next++ ];
+        }
+
+        // unit length by construction, up to the rounding of the sqrt
+        return engine::Rotation { glm::quat { values[ 3 ], values[ 0 ], values[ 1 ], values[ 2 ] }, engine::Rotation::ASSUME_NORMALIZED };
+    }
+
+    float GetPositionScale(float min, float max)
+    {
+        return max > min ? POSITION_LEVELS / (max - min) : 0.0f;
+    }
+
+    float GetPositionStep(float min, float max)
+    {
+        return max > min ? (max - min) / POSITION_LEVELS : 0.0f;
+    }
+
+    // half a step, plus the float rounding of values as large as the bounds
+    float GetPositionError(float min, float max)
+    {
+        return GetPositionStep(min, max) * 0.5f + std::fmax(std::fabs(min), std::fabs(max)) * 4.0f * FLT_EPSILON;
+    }
+
+#if ENGINE_SIMD_X86
+    // narrows 8 values that fit in 16 bits and stores them
+    ENGINE_TARGET_AVX2 void StoreWords(uint16_t* destination, __m256i values)
+    {
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(values, values), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm256_castsi256_si128(packed));
+    }
+
+    ENGINE_TARGET_AVX2 __m256i LoadWords(const uint16_t* source)
+    {
+        return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+    }
+
+    ENGINE_TARGET_AVX2 __m256i QuantizeAvx2(__m256 value, __m256 offset, __m256 scale, __m256 levels)
+    {
+        __m256 quantized = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(value, offset), scale), _mm256_set1_ps(0.5f));
+        quantized        = _mm256_min_ps(_mm256_max_ps(quantized, _mm256_setzero_ps()), levels);
+
+        return _mm256_cvttps_epi32(quantized);
+    }
+
+    ENGINE_TARGET_AVX2 void EncodePositionsAvx2(const float* positions, uint16_t* destination, float min, float max, size_t end)
+    {
+        __m256 offset = _mm256_set1_ps(-min);
+        __m256 scale  = _mm256_set1_ps(GetPositionScale(min, max));
+        __m256 levels = _mm256_set1_ps(POSITION_LEVELS);
+
+        for (size_t i = 0; i + 8 <= end; i += 8)
+        {
+            StoreWords(destination + i, QuantizeAvx2(_mm256_loadu_ps(positions + i), offset, scale, levels));
+        }
+    }
+
+    ENGINE_TARGET_AVX2 void DecodePositionsAvx2(const uint16_t* source, float* positions, float min, float max, size_t end)
+    {
+        __m256 offset = _mm256_set1_ps(min);
+        __m256 step   = _mm256_set1_ps(GetPositionStep(min, max));
+
+        for (size_t i = 0; i + 8 <= end; i += 8)
+        {
+            __m256 quantized = _mm256_cvtepi32_ps(LoadWords(source + i));
+            _mm256_storeu_ps(positions + i, _mm256_add_ps(_mm256_mul_ps(quantized, step), offset));
+        }
+    }
+
+    ENGINE_TARGET_AVX2 void EncodeHalvesAvx2(const float* values, uint16_t* destination, size_t end)
+    {
+        for (size_t i = 0; i + 8 <= end; i += 8)
+        {
+            __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), halves);
+        }
+    }
+
+    ENGINE_TARGET_AVX2 void DecodeHalvesAvx2(const uint16_t* source, float* values, size_t end)
+    {
+        for (size_t i = 0; i + 8 <= end; i += 8)
+        {
+            __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            _mm256_storeu_ps(values + i, _mm256_cvtph_ps(halves));
+        }
+    }
+
+    // smallest three for 8 rotations at once, see EncodeSmallestThree
+    ENGINE_TARGET_AVX2 void EncodeSmallestThreeAvx2(const engine::TransformationArrays& transformations, uint32_t bits, size_t begin, __m256i& index, __m256i& a, __m256i& b, __m256i& c)
+    {
+        __m256 x = _mm256_loadu_ps(transformations.m_rotationX + begin);
+        __m256 y = _mm256_loadu_ps(transformations.m_rotationY + begin);
+        __m256 z = _mm256_loadu_ps(transformations.m_rotationZ + begin);
+        __m256 w = _mm256_loadu_ps(transformations.m_rotationW + begin);
+
+        __m256 signMask = _mm256_set1_ps(-0.0f);
+
+        // largest magnitude, the first one wins ties like the scalar version
+        __m256 largest  = _mm256_andnot_ps(signMask, x);
+        __m256 dropped  = x;
+        __m256 position = _mm256_setzero_ps();
+
+        __m256 isLarger = _mm256_cmp_ps(_mm256_andnot_ps(signMask, y), largest, _CMP_GT_OQ);
+        largest         = _mm256_blendv_ps(largest, _mm256_andnot_ps(signMask, y), isLarger);
+        dropped         = _mm256_blendv_ps(dropped, y, isLarger);
+        position        = _mm256_blendv_ps(position, _mm256_set1_ps(1.0f), isLarger);
+
+        isLarger = _mm256_cmp_ps(_mm256_andnot_ps(signMask, z), largest, _CMP_GT_OQ);
+        largest  = _mm256_blendv_ps(largest, _mm256_andnot_ps(signMask, z), isLarger);
+        dropped  = _mm256_blendv_ps(dropped, z, isLarger);
+        position = _mm256_blendv_ps(position, _mm256_set1_ps(2.0f), isLarger);
+
+        isLarger = _mm256_cmp_ps(_mm256_andnot_ps(signMask, w), largest, _CMP_GT_OQ);
+        dropped  = _mm256_blendv_ps(dropped, w, isLarger);
+        position = _mm256_blendv_ps(position, _mm256_set1_ps(3.0f), isLarger);
+
+        __m256 isFirst         = _mm256_cmp_ps(position, _mm256_set1_ps(0.5f), _CMP_LT_OQ);
+        __m256 isFirstOrSecond = _mm256_cmp_ps(position, _mm256_set1_ps(1.5f), _CMP_LT_OQ);
+        __m256 isBeforeLast    = _mm256_cmp_ps(position, _mm256_set1_ps(2.5f), _CMP_LT_OQ);
+
+        // the components that are kept, in order, negated when the dropped one is negative
+        __m256 sign  = _mm256_and_ps(dropped, signMask);
+        __m256 keptA = _mm256_xor_ps(_mm256_blendv_ps(x, y, isFirst), sign);
+        __m256 keptB = _mm256_xor_ps(_mm256_blendv_ps(y, z, isFirstOrSecond), sign);
+        __m256 keptC = _mm256_xor_ps(_mm256_blendv_ps(z, w, isBeforeLast), sign);
+
+        float  levelCount = GetComponentLevels(bits);
+        __m256 offset     = _mm256_set1_ps(COMPONENT_RANGE);
+        __m256 scale      = _mm256_set1_ps(levelCount / (2.0f * COMPONENT_RANGE));
+        __m256 levels     = _mm256_set1_ps(levelCount);
+
+        index = _mm256_cvttps_epi32(position);
+        a     = QuantizeAvx2(keptA, offset, scale, levels);
+        b     = QuantizeAvx2(keptB, offset, scale, levels);
+        c     = QuantizeAvx2(keptC, offset, scale, levels);
+    }
+
+    ENGINE_TARGET_AVX2 void DecodeSmallestThreeAvx2(const engine::TransformationArrays& transformations, uint32_t bits, size_t begin, __m256i index, __m256i a, __m256i b, __m256i c)
+    {
+        __m256 offset = _mm256_set1_ps(COMPONENT_RANGE);
+        __m256 step   = _mm256_set1_ps(2.0f * COMPONENT_RANGE / GetComponentLevels(bits));
+
+        __m256 keptA = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(a), step), offset);
+        __m256 keptB = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(b), step), offset);
+        __m256 keptC = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(c), step), offset);
+
+        __m256 squaredSum = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(keptA, keptA), _mm256_mul_ps(keptB, keptB)), _mm256_mul_ps(keptC, keptC));
+        __m256 dropped    = _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), squaredSum), _mm256_setzero_ps()));
+
+        __m256 isFirst         = _mm256_castsi256_ps(_mm256_cmpeq_epi32(index, _mm256_setzero_si256()));
+        __m256 isSecond        = _mm256_castsi256_ps(_mm256_cmpeq_epi32(index, _mm256_set1_epi32(1)));
+        __m256 isThird         = _mm256_castsi256_ps(_mm256_cmpeq_epi32(index, _mm256_set1_epi32(2)));
+        __m256 isFirstOrSecond = _mm256_or_ps(isFirst, isSecond);
+        __m256 isBeforeLast    = _mm256_or_ps(isFirstOrSecond, isThird);
+
+        __m256 x = _mm256_blendv_ps(keptA, dropped, isFirst);
+        __m256 y = _mm256_blendv_ps(_mm256_blendv_ps(keptB, dropped, isSecond), keptA, isFirst);
+        __m256 z = _mm256_blendv_ps(_mm256_blendv_ps(keptC, dropped, isThird), keptB, isFirstOrSecond);
+        __m256 w = _mm256_blendv_ps(dropped, keptC, isBeforeLast);
+
+        _mm256_storeu_ps(transformations.m_rotationX + begin, x);
+        _mm256_storeu_ps(transformations.m_rotationY + begin, y);
+        _mm256_storeu_ps(transformations.m_rotationZ + begin, z);
+        _mm256_storeu_ps(transformations.m_rotationW + begin, w);
+    }
+    ENGINE_TARGET_AVX2 void EncodeRotations32Avx2(const engine::TransformationArrays& transformations, uint32_t* destination, size_t end)
+    {
+        for (size_t i = 0; i + 8 <= end; i += 8)
+        {
+            __m256i index;
+            __m256i a;
+            __m256i b;
+            __m256i c;
+            EncodeSmallestThreeAvx2(transformations, engine::QuantizedRotation32::Constants::COMPONENT_BITS, i, index, a, b, c);
+
+            __m256i bits = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(index, 30), _mm256_slli_epi32(a, 20)), _mm256_or_si256(_mm256_slli_epi32(b, 10), c));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), bits);
+        }
+    }
+
+    ENGINE_TARGET_AVX2 void EncodeRotations48Avx2(const engine::TransformationArrays& transformations, uint16_t* wordsA, uint16_t* wordsB, uint16_t* wordsC, size_t end)
+    {
+        __m256i one = _mm256_set1_epi32(1);
+
+        for (size_t i = 0; i + 8 <= end; i += 8)
+        {
+            __m256i index;
+            __m256i a;
+            __m256i b;
+            __m256i c;
+            EncodeSmallestThreeAvx2(transformations, engine::QuantizedRotation48::Constants::COMPONENT_BITS, i, index, a, b, c);
+
+            StoreWords(wordsA + i, _mm256_or_si256(a, _mm256_slli_epi32(_mm256_and_si256(index, one), 15)));
+            StoreWords(wordsB + i, _mm256_or_si256(b, _mm256_slli_epi32(_mm256_srli_epi32(index, 1), 15)));
+            StoreWords(wordsC + i, c);
+        }
+    }
+
+    ENGINE_TARGET_AVX2 void DecodeRotations32Avx2(const uint32_t* source, const engine::TransformationArrays& transformations, size_t end)
+    {
+        __m256i mask = _mm256_set1_epi32((1 << engine::QuantizedRotation32::Constants::COMPONENT_BITS) - 1);
+
+        for (size_t i = 0; i + 8 <= end; i += 8)
+        {
+            __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+
+            __m256i index = _mm256_srli_epi32(bits, 30);
+            __m256i a     = _mm256_and_si256(_mm256_srli_epi32(bits, 20), mask);
+            __m256i b     = _mm256_and_si256(_mm256_srli_epi32(bits, 10), mask);
+            __m256i c     = _mm256_and_si256(bits, mask);
+
+            DecodeSmallestThreeAvx2(transformations, engine::QuantizedRotation32::Constants::COMPONENT_BITS, i, index, a, b, c);
+        }
+    }
+
+    ENGINE_TARGET_AVX2 void DecodeRotations48Avx2(const uint16_t* wordsA, const uint16_t* wordsB, const uint16_t* wordsC, const engine::TransformationArrays& transformations, size_t end)
+    {
+        __m256i mask = _mm256_set1_epi32(0x7FFF);
+
+        for (size_t i = 0; i + 8 <= end; i += 8)
+        {
+            __m256i wordA = LoadWords(wordsA + i);
+            __m256i wordB = LoadWords(wordsB + i);
+
+            __m256i index = _mm256_or_si256(_mm256_srli_epi32(wordA, 15), _mm256_slli_epi32(_mm256_srli_epi32(wordB, 15), 1));
+            __m256i a     = _mm256_and_si256(wordA, mask);
+            __m256i b     = _mm256_and_si256(wordB, mask);
+            __m256i c     = _mm256_and_si256(LoadWords(wordsC + i), mask);
+
+            DecodeSmallestThreeAvx2(transformations, engine::QuantizedRotation48::Constants::COMPONENT_BITS, i, index, a, b, c);
+        }
+    }
+#endif
+} // namespace
+
+engine::QuantizedRotation32 engine::QuantizedRotation32::Encode(const engine::Rotation& rotation)
+{
+    uint32_t index           = 0;
+    uint32_t components[ 3 ] = {};
+    EncodeSmallestThree(rotation, Constants::COMPONENT_BITS, index, components);
+
+    uint32_t bits = index << 30;
+    bits |= components[ 0 ] << 20;
+    bits |= components[ 1 ] << 10;
+    bits |= components[ 2 ];
+
+    return QuantizedRotation32 { bits };
+}
+
+engine::Rotation engine::QuantizedRotation32::Decode() const
+{
+    uint32_t mask            = (1u << Constants::COMPONENT_BITS) - 1u;
+    uint32_t components[ 3 ] = { (m_bits >> 20) & mask, (m_bits >> 10) & mask, m_bits & mask };
+
+    return DecodeSmallestThree(m_bits >> 30, components, Constants::COMPONENT_BITS);
+}
+
+engine::QuantizedRotation48 engine::QuantizedRotation48::Encode(const engine::Rotation& rotation)
+{
+    uint32_t index           = 0;
+    uint32_t components[ 3 ] = {};
+    EncodeSmallestThree(rotation, Constants::COMPONENT_BITS, index, components);
+
+    QuantizedRotation48 quantized {};
+    quantized.m_words[ 0 ] = static_cast<uint16_t>(components[ 0 ] | ((index & 1u) << 15));
+    quantized.m_words[ 1 ] = static_cast<uint16_t>(components[ 1 ] | ((index >> 1) << 15));
+    quantized.m_words[ 2 ] = static_cast<uint16_t>(components[ 2 ]);
+
+    return quantized;
+}
+
+engine::Rotation engine::QuantizedRotation48::Decode() const
+{
+    uint32_t index           = static_cast<uint32_t>((m_words[ 0 ] >> 15) | ((m_words[ 1 ] >> 15) << 1));
+    uint32_t components[ 3 ] = {
+        m_words[ 0 ] & 0x7FFFu,
+        m_words[ 1 ] & 0x7FFFu,
+        m_words[ 2 ] & 0x7FFFu
+    };
+
+    return DecodeSmallestThree(index, components, Constants::COMPONENT_BITS);
+}
+
+engine::QuantizedTransformationBuffer::QuantizedTransformationBuffer(const engine::QuantizationSettings& settings)
+    : m_settings { settings }
+    , m_count { 0 }
+{
+}
+
+const engine::QuantizationSettings& engine::QuantizedTransformationBuffer::GetSettings() const
+{
+    return m_settings;
+}
+
+size_t engine::QuantizedTransformationBuffer::GetCount() const
+{
+    return m_count;
+}
+
+size_t engine::QuantizedTransformationBuffer::GetSizeInBytes() const
+{
+    size_t size = 0;
+    size += (m_positionX.size() + m_positionY.size() + m_positionZ.size()) * sizeof(uint16_t);
+    size += m_rotations32.size() * sizeof(uint32_t);
+    size += (m_rotationA.size() + m_rotationB.size() + m_rotationC.size()) * sizeof(uint16_t);
+    size += (m_scaleX.size() + m_scaleY.size() + m_scaleZ.size()) * sizeof(uint16_t);
+
+    return size;
+}
+
+void engine::QuantizedTransformationBuffer::Resize(size_t count)
+{
+    size_t previous = m_count;
+
+    ResizeStorage(count);
+
+    for (size_t i = previous; i < count; ++i)
+    {
+        Set(i, Transformation {});
+    }
+}
+
+void engine::QuantizedTransformationBuffer::ResizeStorage(size_t count)
+{
+    m_count = count;
+    m_positionX.resize(count);
+    m_positionY.resize(count);
+    m_positionZ.resize(count);
+
+    if (m_settings.m_rotationPrecision == RotationPrecision::Bits32)
+    {
+        m_rotations32.resize(count);
+    }
+    else
+    {
+        m_rotationA.resize(count);
+        m_rotationB.resize(count);
+        m_rotationC.resize(count);
+    }
+
+    m_scaleX.resize(count);
+    if (!m_settings.m_isUniformScale)
+    {
+        m_scaleY.resize(count);
+        m_scaleZ.resize(count);
+    }
+}
+
+void engine::QuantizedTransformationBuffer::Set(size_t index, const engine::Transformation& transformation)
+{
+    const QuantizationBounds& bounds = m_settings.m_bounds;
+
+    m_positionX[ index ] = static_cast<uint16_t>(Quantize(transformation.m_position.x, -bounds.m_min.x, GetPositionScale(bounds.m_min.x, bounds.m_max.x), POSITION_LEVELS));
+    m_positionY[ index ] = static_cast<uint16_t>(Quantize(transformation.m_position.y, -bounds.m_min.y, GetPositionScale(bounds.m_min.y, bounds.m_max.y), POSITION_LEVELS));
+    m_positionZ[ index ] = static_cast<uint16_t>(Quantize(transformation.m_position.z, -bounds.m_min.z, GetPositionScale(bounds.m_min.z, bounds.m_max.z), POSITION_LEVELS));
+
+    if (m_settings.m_rotationPrecision == RotationPrecision::Bits32)
+    {
+        m_rotations32[ index ] = QuantizedRotation32::Encode(transformation.m_rotation).m_bits;
+    }
+    else
+    {
+        QuantizedRotation48 rotation = QuantizedRotation48::Encode(transformation.m_rotation);
+        m_rotationA[ index ]         = rotation.m_words[ 0 ];
+        m_rotationB[ index ]         = rotation.m_words[ 1 ];
+        m_rotationC[ index ]         = rotation.m_words[ 2 ];
+    }
+
+    m_scaleX[ index ] = FloatToHalf(transformation.m_scale.x);
+    if (!m_settings.m_isUniformScale)
+    {
+        m_scaleY[ index ] = FloatToHalf(transformation.m_scale.y);
+        m_scaleZ[ index ] = FloatToHalf(transformation.m_scale.z);
+    }
+}
+
+engine::Transformation engine::QuantizedTransformationBuffer::Get(size_t index) const
+{
+    const QuantizationBounds& bounds = m_settings.m_bounds;
+
+    glm::vec3 position {
+        bounds.m_min.x + static_cast<float>(m_positionX[ index ]) * GetPositionStep(bounds.m_min.x, bounds.m_max.x),
+        bounds.m_min.y + static_cast<float>(m_positionY[ index ]) * GetPositionStep(bounds.m_min.y, bounds.m_max.y),
+        bounds.m_min.z + static_cast<float>(m_positionZ[ index ]) * GetPositionStep(bounds.m_min.z, bounds.m_max.z)
+    };
+
+    Rotation rotation {};
+    if (m_settings.m_rotationPrecision == RotationPrecision::Bits32)
+    {
+        rotation = QuantizedRotation32 { m_rotations32[ index ] }.Decode();
+    }
+    else
+    {
+        rotation = QuantizedRotation48 { { m_rotationA[ index ], m_rotationB[ index ], m_rotationC[ index ] } }.Decode();
+    }
+
+    float     scaleX = HalfToFloat(m_scaleX[ index ]);
+    glm::vec3 scale { scaleX };
+    if (!m_settings.m_isUniformScale)
+    {
+        scale.y = HalfToFloat(m_scaleY[ index ]);
+        scale.z = HalfToFloat(m_scaleZ[ index ]);
+    }
+
+    return Transformation { position, rotation, scale };
+}
+
+void engine::QuantizedTransformationBuffer::EncodeRange(const engine::TransformationArrays& transformations, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        glm::vec3 position { transformations.m_positionX[ i ], transformations.m_positionY[ i ], transformations.m_positionZ[ i ] };
+        glm::quat rotation { transformations.m_rotationW[ i ], transformations.m_rotationX[ i ], transformations.m_rotationY[ i ], transformations.m_rotationZ[ i ] };
+        glm::vec3 scale { transformations.m_scaleX[ i ], transformations.m_scaleY[ i ], transformations.m_scaleZ[ i ] };
+
+        Set(i, Transformation { position, Rotation { rotation, Rotation::ASSUME_NORMALIZED }, scale });
+    }
+}
+
+void engine::QuantizedTransformationBuffer::DecodeRange(const engine::TransformationArrays& transformations, size_t begin, size_t end) const
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        Transformation transformation = Get(i);
+        glm::quat      rotation       = transformation.m_rotation.GetQuaternion();
+
+        transformations.m_positionX[ i ] = transformation.m_position.x;
+        transformations.m_positionY[ i ] = transformation.m_position.y;
+        transformations.m_positionZ[ i ] = transformation.m_position.z;
+        transformations.m_rotationX[ i ] = rotation.x;
+        transformations.m_rotationY[ i ] = rotation.y;
+        transformations.m_rotationZ[ i ] = rotation.z;
+        transformations.m_rotationW[ i ] = rotation.w;
+        transformations.m_scaleX[ i ]    = transformation.m_scale.x;
+        transformations.m_scaleY[ i ]    = transformation.m_scale.y;
+        transformations.m_scaleZ[ i ]    = transformation.m_scale.z;
+    }
+}
+
+void engine::QuantizedTransformationBuffer::Encode(const engine::TransformationArrays& transformations)
+{
+    ResizeStorage(transformations.m_count);
+
+    size_t done = 0;
+
+#if ENGINE_SIMD_X86
+    if (GetSimdLevel() == SimdLevel::Avx2)
+    {
+        const QuantizationBounds& bounds = m_settings.m_bounds;
+
+        done = m_count & ~static_cast<size_t>(7);
+
+        EncodePositionsAvx2(transformations.m_positionX, m_positionX.data(), bounds.m_min.x, bounds.m_max.x, done);
+        EncodePositionsAvx2(transformations.m_positionY, m_positionY.data(), bounds.m_min.y, bounds.m_max.y, done);
+        EncodePositionsAvx2(transformations.m_positionZ, m_positionZ.data(), bounds.m_min.z, bounds.m_max.z, done);
+
+        if (m_settings.m_rotationPrecision == RotationPrecision::Bits32)
+        {
+            EncodeRotations32Avx2(transformations, m_rotations32.data(), done);
+        }
+        else
+        {
+            EncodeRotations48Avx2(transformations, m_rotationA.data(), m_rotationB.data(), m_rotationC.data(), done);
+        }
+
+        EncodeHalvesAvx2(transformations.m_scaleX, m_scaleX.data(), done);
+        if (!m_settings.m_isUniformScale)
+        {
+            EncodeHalvesAvx2(transformations.m_scaleY, m_scaleY.data(), done);
+            EncodeHalvesAvx2(transformations.m_scaleZ, m_scaleZ.data(), done);
+        }
+    }
+#endif
+
+    EncodeRange(transformations, done, m_count);
+}
+
+void engine::QuantizedTransformationBuffer::Decode(const engine::TransformationArrays& transformations) const
+{
+    if (transformations.m_count != m_count)
+    {
+        throw std::runtime_error("Tried to decode quantized transformations into arrays of a different size");
+    }
+
+    size_t done = 0;
+
+#if ENGINE_SIMD_X86
+    if (GetSimdLevel() == SimdLevel::Avx2)
+    {
+        const QuantizationBounds& bounds = m_settings.m_bounds;
+
+        done = m_count & ~static_cast<size_t>(7);
+
+        DecodePositionsAvx2(m_positionX.data(), transformations.m_positionX, bounds.m_min.x, bounds.m_max.x, done);
+        DecodePositionsAvx2(m_positionY.data(), transformations.m_positionY, bounds.m_min.y, bounds.m_max.y, done);
+        DecodePositionsAvx2(m_positionZ.data(), transformations.m_positionZ, bounds.m_min.z, bounds.m_max.z, done);
+
+        if (m_settings.m_rotationPrecision == RotationPrecision::Bits32)
+        {
+            DecodeRotations32Avx2(m_rotations32.data(), transformations, done);
+        }
+        else
+        {
+            DecodeRotations48Avx2(m_rotationA.data(), m_rotationB.data(), m_rotationC.data(), transformations, done);
+        }
+
+        DecodeHalvesAvx2(m_scaleX.data(), transformations.m_scaleX, done);
+        if (m_settings.m_isUniformScale)
+        {
+            std::copy(transformations.m_scaleX, transformations.m_scaleX + done, transformations.m_scaleY);
+            std::copy(transformations.m_scaleX, transformations.m_scaleX + done, transformations.m_scaleZ);
+        }
+        else
+        {
+            DecodeHalvesAvx2(m_scaleY.data(), transformations.m_scaleY, done);
+            DecodeHalvesAvx2(m_scaleZ.data(), transformations.m_scaleZ, done);
+        }
+    }
+#endif
+
+    DecodeRange(transformations, done, m_count);
+}
+
+glm::vec3 engine::QuantizedTransformationBuffer::GetMaxPositionError() const
+{
+    const QuantizationBounds& bounds = m_settings.m_bounds;
+
+    return glm::vec3 {
+        GetPositionError(bounds.m_min.x, bounds.m_max.x),
+        GetPositionError(bounds.m_min.y, bounds.m_max.y),
+        GetPositionError(bounds.m_min.z, bounds.m_max.z)
+    };
+}
+
+float engine::QuantizedTransformationBuffer::GetMaxRotationComponentError() const
+{
+    if (m_settings.m_rotationPrecision == RotationPrecision::Bits32)
+    {
+        return QuantizedRotation32::Constants::MAX_COMPONENT_ERROR;
+    }
+
+    return QuantizedRotation48::Constants::MAX_COMPONENT_ERROR;
+}
+
+float engine::QuantizedTransformationBuffer::GetMaxScaleRelativeError() const
+{
+    return SCALE_RELATIVE_ERROR;
+}
\ No newline at end of file
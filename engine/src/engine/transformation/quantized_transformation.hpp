@@ -0,0 +1,115 @@
+#ifndef QUANTIZED_TRANSFORMATION_HPP
+#define QUANTIZED_TRANSFORMATION_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "rotation.hpp"
+#include "transformation.hpp"
+#include "transformation_batch.hpp"
+
+namespace engine
+{
+    // smallest three encoding: the largest component is dropped, since it can be recomputed from
+    // the other three, and the quaternion is negated if needed so that it is positive. the other
+    // three lie in [-1/sqrt(2), 1/sqrt(2)] and are stored as fixed point, plus 2 bits for the index
+    // of the dropped component. decoded quaternions may be the negation of the encoded one, which
+    // is the same rotation
+    struct QuantizedRotation32
+    {
+        struct Constants
+        {
+            static constexpr uint32_t COMPONENT_BITS      = 10;
+            static constexpr float    MAX_COMPONENT_ERROR = 2.1e-3f;
+        };
+
+        uint32_t m_bits; // index in the top 2 bits, then the three components
+
+        static QuantizedRotation32 Encode(const Rotation& rotation);
+        Rotation                   Decode() const;
+    };
+
+    struct QuantizedRotation48
+    {
+        struct Constants
+        {
+            static constexpr uint32_t COMPONENT_BITS      = 15;
+            static constexpr float    MAX_COMPONENT_ERROR = 7e-5f;
+        };
+
+        uint16_t m_words[ 3 ]; // one component per word, bit 15 of the first two words holds the index
+
+        static QuantizedRotation48 Encode(const Rotation& rotation);
+        Rotation                   Decode() const;
+    };
+
+    // positions are stored as 16 bit fixed point inside this box. positions outside are clamped to it
+    struct QuantizationBounds
+    {
+        glm::vec3 m_min;
+        glm::vec3 m_max;
+    };
+
+    enum class RotationPrecision
+    {
+        Bits32,
+        Bits48
+    };
+
+    struct QuantizationSettings
+    {
+        QuantizationBounds m_bounds;
+        RotationPrecision  m_rotationPrecision;
+        bool               m_isUniformScale; // only the x scale is stored, and decoded on all axes
+    };
+
+    // compressed structure of arrays storage for a batch of transformations, between 12 and 18 bytes
+    // per element instead of 40. scales are stored as half floats
+    class QuantizedTransformationBuffer
+    {
+        QuantizationSettings m_settings;
+        size_t               m_count;
+
+        std::vector<uint16_t> m_positionX;
+        std::vector<uint16_t> m_positionY;
+        std::vector<uint16_t> m_positionZ;
+        std::vector<uint32_t> m_rotations32; // only with RotationPrecision::Bits32
+        std::vector<uint16_t> m_rotationA;   // the three words of a QuantizedRotation48
+        std::vector<uint16_t> m_rotationB;
+        std::vector<uint16_t> m_rotationC;
+        std::vector<uint16_t> m_scaleX;
+        std::vector<uint16_t> m_scaleY; // empty with uniform scale
+        std::vector<uint16_t> m_scaleZ;
+
+        void ResizeStorage(size_t count); // without initializing the new elements
+        void EncodeRange(const TransformationArrays& transformations, size_t begin, size_t end);
+        void DecodeRange(const TransformationArrays& transformations, size_t begin, size_t end) const;
+
+      public:
+        explicit QuantizedTransformationBuffer(const QuantizationSettings& settings);
+
+        const QuantizationSettings& GetSettings() const;
+        size_t                      GetCount() const;
+        size_t                      GetSizeInBytes() const; // of the encoded data
+
+        // new elements are identity transformations, if the bounds contain the origin
+        void Resize(size_t count);
+
+        void           Set(size_t index, const Transformation& transformation);
+        Transformation Get(size_t index) const;
+
+        // the batch functions pick the widest kernel the cpu supports (see GetSimdLevel).
+        // Encode replaces the content of the buffer, Decode expects arrays of the same size
+        void Encode(const TransformationArrays& transformations);
+        void Decode(const TransformationArrays& transformations) const;
+
+        // largest difference between a decoded value and the original, for positions inside the bounds
+        glm::vec3 GetMaxPositionError() const;
+        float     GetMaxRotationComponentError() const;
+        float     GetMaxScaleRelativeError() const;
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -1,8 +1,37 @@
 #include "rotation.hpp"
 
+#include <atomic>
+
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp> // glm::toMat4
 
+namespace
+{
+    // read by rotations on the job workers and the render thread, relaxed is enough since
+    // nothing else is published with it
+    std::atomic<engine::Rotation::NormalizationMode>& GetCurrentNormalizationMode()
+    {
+        static std::atomic<engine::Rotation::NormalizationMode> mode { engine::Rotation::NormalizationMode::Always };
+        return mode;
+    }
+
+    // renormalizes the product of two unit quaternions according to the normalization mode
+    glm::quat Renormalize(const glm::quat& product)
+    {
+        if (GetCurrentNormalizationMode().load(std::memory_order_relaxed) == engine::Rotation::NormalizationMode::OnDrift)
+        {
+            // the squared length costs no sqrt or divide, unit quaternions only drift by rounding
+            float drift = glm::dot(product, product) - 1.0f;
+            if (drift < engine::Rotation::Constants::DRIFT_TOLERANCE && drift > -engine::Rotation::Constants::DRIFT_TOLERANCE)
+            {
+                return product;
+            }
+        }
+
+        return glm::normalize(product);
+    }
+} // namespace
+
 engine::Rotation::Rotation()
     : m_rotation { glm::quat { 1.0f, 0.0f, 0.0f, 0.0f } }
 {
@@ -19,6 +48,11 @@ engine::Rotation& engine::Rotation::operator=(const glm::quat& quaternion)
     return *this;
 }
 
+engine::Rotation::Rotation(const glm::quat& quaternion, engine::Rotation::AssumeNormalizedTag)
+    : m_rotation { quaternion }
+{
+}
+
 engine::Rotation::Rotation(glm::vec3 forward, glm::vec3 up)
 {
     // normalize
@@ -85,19 +119,19 @@ glm::quat engine::Rotation::GetQuaternion() const
 engine::Rotation engine::Rotation::GetInverse() const
 {
     // since we keep our quaternion normalized, conjugate is a faster inverse method
-    // conjugate would not work if the quaternion was not normalized
-    return Rotation { glm::conjugate(m_rotation) };
+    // conjugate would not work if the quaternion was not normalized.
+    // the conjugate of a unit quaternion is exactly unit length, no need to normalize again
+    return Rotation { glm::conjugate(m_rotation), ASSUME_NORMALIZED };
 }
 
 engine::Rotation engine::Rotation::operator*(const engine::Rotation& other) const
 {
-    // constructor normalized input quaternion
-    return Rotation { m_rotation * other.m_rotation };
+    return Rotation { Renormalize(m_rotation * other.m_rotation), ASSUME_NORMALIZED };
 }
 
 engine::Rotation& engine::Rotation::operator*=(const engine::Rotation& other)
 {
-    m_rotation = glm::normalize(m_rotation * other.m_rotation);
+    m_rotation = Renormalize(m_rotation * other.m_rotation);
     return *this;
 }
 
@@ -114,7 +148,7 @@ bool engine::Rotation::operator!=(const engine::Rotation& other) const
 void engine::Rotation::RotateAroundAxis(float angle_radians, glm::vec3 axis)
 {
     glm::quat q = glm::angleAxis(angle_radians, glm::normalize(axis));
-    m_rotation  = glm::normalize(q * m_rotation);
+    m_rotation  = Renormalize(q * m_rotation);
 }
 
 glm::mat4 engine::Rotation::GetMatrix() const
@@ -124,5 +158,15 @@ glm::mat4 engine::Rotation::GetMatrix() const
 
 engine::Rotation engine::Rotation::Slerp(const engine::Rotation& start, const engine::Rotation& end, float t)
 {
-    return Rotation { glm::slerp(start.m_rotation, end.m_rotation, t) };
+    return Rotation { Renormalize(glm::slerp(start.m_rotation, end.m_rotation, t)), ASSUME_NORMALIZED };
+}
+
+void engine::Rotation::SetNormalizationMode(engine::Rotation::NormalizationMode mode)
+{
+    GetCurrentNormalizationMode().store(mode, std::memory_order_relaxed);
+}
+
+engine::Rotation::NormalizationMode engine::Rotation::GetNormalizationMode()
+{
+    return GetCurrentNormalizationMode().load(std::memory_order_relaxed);
 }
\ No newline at end of file
@@ -7,6 +7,25 @@ namespace engine
 {
     class Rotation
     {
+      public:
+        // how the results of composing rotations are kept at unit length
+        enum class NormalizationMode
+        {
+            Always,  // every result is normalized, the default
+            OnDrift, // results are only normalized once their length drifts past DRIFT_TOLERANCE
+        };
+
+        // selects the constructors that trust the quaternion to be unit length already
+        struct AssumeNormalizedTag
+        {
+        };
+
+        struct Constants
+        {
+            static constexpr float DRIFT_TOLERANCE = 1e-5f; // on the squared length
+        };
+
+      private:
         glm::quat m_rotation;
 
       public:
@@ -14,10 +33,15 @@ namespace engine
         static constexpr glm::vec3 GLOBAL_FORWARD_VECTOR = glm::vec3 { 0.0f, 0.0f, -1.0f };
         static constexpr glm::vec3 GLOBAL_RIGHT_VECTOR   = glm::vec3 { 1.0f, 0.0f, 0.0f };
 
+        static constexpr AssumeNormalizedTag ASSUME_NORMALIZED {};
+
         Rotation();
         Rotation(const glm::quat& quaternion);
         Rotation& operator=(const glm::quat& quaternion);
 
+        // no normalization, the caller guarantees a unit quaternion
+        Rotation(const glm::quat& quaternion, AssumeNormalizedTag);
+
         Rotation(glm::vec3 forward, glm::vec3 up = GLOBAL_UP_VECTOR);
         Rotation(glm::vec3 forward, glm::vec3 up, glm::vec3 right);
 
@@ -45,6 +69,11 @@ namespace engine
         glm::mat4 GetMatrix() const;
 
         static Rotation Slerp(const Rotation& start, const Rotation& end, float t);
+
+        // applies to operator*, operator*=, RotateAroundAxis and Slerp. safe to change from any thread, rotations
+        // already running on other threads may still finish with the previous mode
+        static void              SetNormalizationMode(NormalizationMode mode);
+        static NormalizationMode GetNormalizationMode();
     };
 } // namespace engine
 
@@ -0,0 +1,295 @@
+#include "transform_system.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "transformation_component.hpp"
+#include <game_object/game_object.hpp>
+#include <game_object/game_object_manager.hpp>
+
+engine::TransformSystem::TransformSystem()
+    : System { "Transform System", SystemPhase::PostUpdate }
+    , m_components {}
+    , m_hierarchy {}
+    , m_dirtyRoots {}
+    , m_isHierarchyDirty { false }
+    , m_lastUpdatedCount { 0 }
+    , m_isInterpolating { false }
+    , m_interpolationAlpha { 1.0f }
+    , m_moving {}
+    , m_previous {}
+    , m_current {}
+    , m_presentation {}
+{
+}
+
+engine::TransformSystem::~TransformSystem()
+{
+    // components that outlive the system must not point to it
+    for (TransformationComponent* component : m_components)
+    {
+        component->m_transformSystem = nullptr;
+    }
+}
+
+void engine::TransformSystem::AddComponent(engine::TransformationComponent* component)
+{
+    if (component->m_transformSystem != nullptr)
+    {
+        throw std::runtime_error("Tried to add a transformation component to the transform system twice");
+    }
+
+    component->m_transformSystem = this;
+    component->m_registryIndex   = m_components.size();
+    m_components.push_back(component);
+
+    // a new transformation always needs its world computed
+    component->m_isDirty = false;
+    component->MarkDirty();
+
+    InvalidateHierarchy();
+}
+
+void engine::TransformSystem::RemoveComponent(engine::TransformationComponent* component)
+{
+    if (component->m_transformSystem != this)
+    {
+        throw std::runtime_error("Tried to remove a transformation component from a system that does not own it");
+    }
+
+    // swap and pop
+    TransformationComponent* last              = m_components.back();
+    m_components[ component->m_registryIndex ] = last;
+    last->m_registryIndex                      = component->m_registryIndex;
+    m_components.pop_back();
+
+    if (component->m_isDirty)
+    {
+        m_dirtyRoots.erase(std::find(m_dirtyRoots.begin(), m_dirtyRoots.end(), component));
+        component->m_isDirty = false;
+    }
+
+    if (IsMoving(component))
+    {
+        RemoveMoving(component);
+    }
+
+    component->m_transformSystem = nullptr;
+
+    // its children now hang from another ancestor
+    InvalidateHierarchy();
+}
+
+void engine::TransformSystem::InvalidateHierarchy()
+{
+    m_isHierarchyDirty = true;
+}
+
+void engine::TransformSystem::RebuildHierarchy()
+{
+    m_hierarchy.clear();
+    m_hierarchy.reserve(m_components.size());
+
+    // the scene traversal already visits objects in pre-order
+    GameObjectManager::GetInstance().TraverseGameObjectsPreOrder(
+        [ this ](GameObject* object)
+        {
+            TransformationComponent* component = object->GetComponent<TransformationComponent>();
+            if (component == nullptr || component->m_transformSystem != this)
+            {
+                return;
+            }
+
+            // the parent transformation is the one of the closest ancestor that has any
+            TransformationComponent* parent = nullptr;
+            for (GameObject* ancestor = object->GetParent(); ancestor != nullptr && parent == nullptr; ancestor = ancestor->GetParent())
+            {
+                parent = ancestor->GetComponent<TransformationComponent>();
+            }
+
+            // a new parent means a new world transformation
+            if (parent != component->m_parent)
+            {
+                component->m_parent = parent;
+                component->MarkDirty();
+            }
+
+            component->m_hierarchyIndex = m_hierarchy.size();
+            component->m_subtreeSize    = 1;
+            m_hierarchy.push_back(component);
+        });
+
+    // children come after their parents, so walking backwards accumulates subtree sizes bottom up
+    for (size_t i = m_hierarchy.size(); i > 0; i--)
+    {
+        TransformationComponent* component = m_hierarchy[ i - 1 ];
+        if (component->m_parent != nullptr)
+        {
+            component->m_parent->m_subtreeSize += component->m_subtreeSize;
+        }
+    }
+
+    m_isHierarchyDirty = false;
+}
+
+void engine::TransformSystem::Update()
+{
+    if (m_isHierarchyDirty)
+    {
+        RebuildHierarchy();
+    }
+
+    m_lastUpdatedCount   = 0;
+    m_interpolationAlpha = 1.0f;
+
+    // whatever moved in the previous update is at rest now, unless it moves again below
+    m_moving.clear();
+
+    if (m_dirtyRoots.empty())
+    {
+        return;
+    }
+
+    // grows only, a single update never recomputes more than the whole hierarchy
+    if (m_isInterpolating && m_current.GetCount() < m_hierarchy.size())
+    {
+        m_previous.Resize(m_hierarchy.size());
+        m_current.Resize(m_hierarchy.size());
+        m_presentation.Resize(m_hierarchy.size());
+    }
+
+    // in hierarchy order, so a dirty root inside an already updated range can be skipped
+    std::sort(m_dirtyRoots.begin(), m_dirtyRoots.end(),
+        [](const TransformationComponent* a, const TransformationComponent* b)
+        {
+            return a->m_hierarchyIndex < b->m_hierarchyIndex;
+        });
+
+    size_t updatedEnd = 0;
+    for (TransformationComponent* root : m_dirtyRoots)
+    {
+        size_t begin = root->m_hierarchyIndex;
+        if (begin < updatedEnd)
+        {
+            continue;
+        }
+
+        // only the first transformation of an object is part of the hierarchy
+        if (begin >= m_hierarchy.size() || m_hierarchy[ begin ] != root)
+        {
+            root->m_isDirty = false;
+            continue;
+        }
+
+        size_t end = begin + root->m_subtreeSize;
+        for (size_t i = begin; i < end; i++)
+        {
+            TransformationComponent* component = m_hierarchy[ i ];
+            Transformation           world     = component->m_parent != nullptr ? component->m_parent->m_world * component->m_local : component->m_local;
+
+            if (m_isInterpolating)
+            {
+                size_t index = m_moving.size();
+
+                // a transformation computed for the first time has no earlier state to come from
+                m_previous.Set(index, component->m_worldVersion != 0 ? component->m_world : world);
+                m_current.Set(index, world);
+                m_presentation.Set(index, world);
+
+                component->m_movingIndex = index;
+                m_moving.push_back(component);
+            }
+
+            component->m_world       = world;
+            component->m_worldMatrix = world.GetMatrix();
+            component->m_isDirty     = false;
+            component->m_worldVersion++;
+        }
+
+        m_lastUpdatedCount += end - begin;
+        updatedEnd = end;
+    }
+
+    m_dirtyRoots.clear();
+}
+
+size_t engine::TransformSystem::GetComponentCount() const
+{
+    return m_components.size();
+}
+
+size_t engine::TransformSystem::GetLastUpdatedCount() const
+{
+    return m_lastUpdatedCount;
+}
+
+bool engine::TransformSystem::IsMoving(const engine::TransformationComponent* component) const
+{
+    return component->m_movingIndex < m_moving.size() && m_moving[ component->m_movingIndex ] == component;
+}
+
+void engine::TransformSystem::RemoveMoving(engine::TransformationComponent* component)
+{
+    // swap and pop, through all three buffers
+    size_t                   index = component->m_movingIndex;
+    size_t                   last  = m_moving.size() - 1;
+    TransformationComponent* moved = m_moving[ last ];
+
+    m_previous.Set(index, m_previous.Get(last));
+    m_current.Set(index, m_current.Get(last));
+    m_presentation.Set(index, m_presentation.Get(last));
+
+    m_moving[ index ]    = moved;
+    moved->m_movingIndex = index;
+    m_moving.pop_back();
+}
+
+engine::TransformationArrays engine::TransformSystem::GetMovingArrays(engine::TransformationBuffer& buffer)
+{
+    // the buffers are sized for the whole hierarchy, only the front is in use
+    TransformationArrays arrays = buffer.GetArrays();
+    arrays.m_count              = m_moving.size();
+    return arrays;
+}
+
+void engine::TransformSystem::SetInterpolationEnabled(bool isEnabled)
+{
+    m_isInterpolating = isEnabled;
+
+    if (!isEnabled)
+    {
+        m_moving.clear();
+    }
+}
+
+bool engine::TransformSystem::IsInterpolationEnabled() const
+{
+    return m_isInterpolating;
+}
+
+void engine::TransformSystem::Interpolate(float alpha)
+{
+    m_interpolationAlpha = alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
+
+    if (m_moving.empty())
+    {
+        return;
+    }
+
+    InterpolateTransformations(GetMovingArrays(m_previous), GetMovingArrays(m_current), m_interpolationAlpha, GetMovingArrays(m_presentation));
+}
+
+float engine::TransformSystem::GetInterpolationAlpha() const
+{
+    return m_interpolationAlpha;
+}
+
+const std::vector<engine::TransformationComponent*>& engine::TransformSystem::GetMovingComponents() const
+{
+    return m_moving;
+}
+
+engine::TransformationArrays engine::TransformSystem::GetPresentationArrays()
+{
+    return GetMovingArrays(m_presentation);
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef TRANSFORM_SYSTEM_HPP
+#define TRANSFORM_SYSTEM_HPP
+
+#include <vector>
+
+#include <engine/system/system.hpp>
+#include "transformation_batch.hpp"
+
+namespace engine
+{
+    class TransformationComponent;
+
+    // keeps the world transformation of every transformation component up to date.
+    // transformations are stored flattened in pre-order, so parents come before their children
+    // and each subtree is a contiguous range. an update only walks the ranges of the subtrees
+    // whose root changed since the previous update.
+    //
+    // with interpolation enabled, the system also keeps the previous and current world
+    // transformation of everything the last update moved, packed in structure of arrays buffers.
+    // Interpolate blends them in one batch for presentation between fixed simulation steps, and
+    // transformations that did not move are not touched at all
+    class TransformSystem : public System
+    {
+        friend class TransformationComponent;
+
+        std::vector<TransformationComponent*> m_components; // registration order, unordered
+        std::vector<TransformationComponent*> m_hierarchy;  // flattened, parents before children
+        std::vector<TransformationComponent*> m_dirtyRoots; // local changed since the last update
+        bool                                  m_isHierarchyDirty;
+        size_t                                m_lastUpdatedCount;
+
+        // interpolation state, indexed like m_moving
+        bool                                  m_isInterpolating;
+        float                                 m_interpolationAlpha;
+        std::vector<TransformationComponent*> m_moving; // recomputed by the last update
+        TransformationBuffer                  m_previous;
+        TransformationBuffer                  m_current;
+        TransformationBuffer                  m_presentation;
+
+        void                 RebuildHierarchy();
+        bool                 IsMoving(const TransformationComponent* component) const;
+        void                 RemoveMoving(TransformationComponent* component);
+        TransformationArrays GetMovingArrays(TransformationBuffer& buffer);
+
+      public:
+        TransformSystem();
+        ~TransformSystem() override;
+
+        void AddComponent(TransformationComponent* component);
+        void RemoveComponent(TransformationComponent* component);
+
+        // the flattened hierarchy is rebuilt on the next update, needed after any reparenting
+        void InvalidateHierarchy();
+
+        void   Update() override;
+        size_t GetComponentCount() const override;
+
+        // world transformations recomputed by the last update
+        size_t GetLastUpdatedCount() const;
+
+        // disabled by default. disabling forgets the moving transformations
+        void SetInterpolationEnabled(bool isEnabled);
+        bool IsInterpolationEnabled() const;
+
+        // blends the moving transformations, alpha 0 is the state before the last update and 1
+        // the state after it. an update leaves the presentation at alpha 1
+        void  Interpolate(float alpha);
+        float GetInterpolationAlpha() const;
+
+        // parallel to the presentation arrays, for renderers that consume the batch directly
+        const std::vector<TransformationComponent*>& GetMovingComponents() const;
+        TransformationArrays                         GetPresentationArrays();
+    };
+} // namespace engine
+
+#endif
\ No newline at end of file
@@ -2,8 +2,6 @@
 
 #include <stdexcept>
 
-#include <glm/gtc/matrix_transform.hpp>
-
 engine::Transformation::Transformation(glm::vec3 position, Rotation rotation, glm::vec3 scale)
     : m_position { position }
     , m_rotation { rotation }
@@ -13,11 +11,15 @@ engine::Transformation::Transformation(glm::vec3 position, Rotation rotation, gl
 
 glm::mat4 engine::Transformation::GetMatrix() const
 {
-    glm::mat4 translation_matrix = glm::translate(glm::mat4 { 1.0f }, m_position);
-    glm::mat4 rotation_matrix    = m_rotation.GetMatrix();
-    glm::mat4 scale_matrix       = glm::scale(glm::mat4 { 1.0f }, m_scale);
+    // translation * rotation * scale, without multiplying the three matrices
+    glm::mat4 matrix = m_rotation.GetMatrix();
+
+    matrix[ 0 ] = matrix[ 0 ] * m_scale.x;
+    matrix[ 1 ] = matrix[ 1 ] * m_scale.y;
+    matrix[ 2 ] = matrix[ 2 ] * m_scale.z;
+    matrix[ 3 ] = glm::vec4 { m_position, 1.0f };
 
-    return translation_matrix * rotation_matrix * scale_matrix;
+    return matrix;
 }
 
 engine::Transformation engine::Transformation::GetInverse() const
@@ -85,7 +87,7 @@ void engine::Transformation::LookAt(glm::vec3 target)
 void engine::Transformation::RotateAroundAxis(float angle_radians, glm::vec3 axis)
 {
     glm::quat q = glm::angleAxis(angle_radians, glm::normalize(axis));
-    m_rotation  = Rotation { q * m_rotation.GetQuaternion() };
+    m_rotation  = Rotation { q, Rotation::ASSUME_NORMALIZED } * m_rotation;
     m_position  = q * m_position;
 }
 
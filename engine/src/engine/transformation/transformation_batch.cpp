@@ -0,0 +1,721 @@
+#include "transformation_batch.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <simd/cpu_features.hpp>
+
+#if ENGINE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    // every kernel processes [begin, end) and the simd ones return where they stopped, the
+    // scalar kernel finishes the remainder
+
+    void ConcatenateScalar(const engine::TransformationArrays& parents, const engine::TransformationArrays& locals, const engine::TransformationArrays& results, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            float qx = parents.m_rotationX[ i ];
+            float qy = parents.m_rotationY[ i ];
+            float qz = parents.m_rotationZ[ i ];
+            float qw = parents.m_rotationW[ i ];
+            float cx = locals.m_rotationX[ i ];
+            float cy = locals.m_rotationY[ i ];
+            float cz = locals.m_rotationZ[ i ];
+            float cw = locals.m_rotationW[ i ];
+
+            // scale the child position according to parent scale
+            float vx = parents.m_scaleX[ i ] * locals.m_positionX[ i ];
+            float vy = parents.m_scaleY[ i ] * locals.m_positionY[ i ];
+            float vz = parents.m_scaleZ[ i ] * locals.m_positionZ[ i ];
+
+            // rotate it, v + 2 * (w * (q x v) + q x (q x v))
+            float uvx  = qy * vz - qz * vy;
+            float uvy  = qz * vx - qx * vz;
+            float uvz  = qx * vy - qy * vx;
+            float uuvx = qy * uvz - qz * uvy;
+            float uuvy = qz * uvx - qx * uvz;
+            float uuvz = qx * uvy - qy * uvx;
+
+            float px = parents.m_positionX[ i ] + vx + (uvx * qw + uuvx) * 2.0f;
+            float py = parents.m_positionY[ i ] + vy + (uvy * qw + uuvy) * 2.0f;
+            float pz = parents.m_positionZ[ i ] + vz + (uvz * qw + uuvz) * 2.0f;
+
+            float rw = qw * cw - qx * cx - qy * cy - qz * cz;
+            float rx = qw * cx + qx * cw + qy * cz - qz * cy;
+            float ry = qw * cy + qy * cw + qz * cx - qx * cz;
+            float rz = qw * cz + qz * cw + qx * cy - qy * cx;
+
+            float length = std::sqrt(rx * rx + ry * ry + rz * rz + rw * rw);
+            if (length > 0.0f)
+            {
+                float inverse = 1.0f / length;
+                rx *= inverse;
+                ry *= inverse;
+                rz *= inverse;
+                rw *= inverse;
+            }
+            else
+            {
+                rx = 0.0f;
+                ry = 0.0f;
+                rz = 0.0f;
+                rw = 1.0f;
+            }
+
+            float sx = parents.m_scaleX[ i ] * locals.m_scaleX[ i ];
+            float sy = parents.m_scaleY[ i ] * locals.m_scaleY[ i ];
+            float sz = parents.m_scaleZ[ i ] * locals.m_scaleZ[ i ];
+
+            results.m_positionX[ i ] = px;
+            results.m_positionY[ i ] = py;
+            results.m_positionZ[ i ] = pz;
+            results.m_rotationX[ i ] = rx;
+            results.m_rotationY[ i ] = ry;
+            results.m_rotationZ[ i ] = rz;
+            results.m_rotationW[ i ] = rw;
+            results.m_scaleX[ i ]    = sx;
+            results.m_scaleY[ i ]    = sy;
+            results.m_scaleZ[ i ]    = sz;
+        }
+    }
+
+    // translation * rotation * scale, written directly instead of multiplying three matrices
+    void ComputeMatricesScalar(const engine::TransformationArrays& transformations, glm::mat4* matrices, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            float x = transformations.m_rotationX[ i ];
+            float y = transformations.m_rotationY[ i ];
+            float z = transformations.m_rotationZ[ i ];
+            float w = transformations.m_rotationW[ i ];
+
+            float sx = transformations.m_scaleX[ i ];
+            float sy = transformations.m_scaleY[ i ];
+            float sz = transformations.m_scaleZ[ i ];
+
+            float xx = x * x;
+            float yy = y * y;
+            float zz = z * z;
+            float xy = x * y;
+            float xz = x * z;
+            float yz = y * z;
+            float wx = w * x;
+            float wy = w * y;
+            float wz = w * z;
+
+            float* m = &matrices[ i ][ 0 ][ 0 ];
+
+            m[ 0 ]  = (1.0f - 2.0f * (yy + zz)) * sx;
+            m[ 1 ]  = 2.0f * (xy + wz) * sx;
+            m[ 2 ]  = 2.0f * (xz - wy) * sx;
+            m[ 3 ]  = 0.0f;
+            m[ 4 ]  = 2.0f * (xy - wz) * sy;
+            m[ 5 ]  = (1.0f - 2.0f * (xx + zz)) * sy;
+            m[ 6 ]  = 2.0f * (yz + wx) * sy;
+            m[ 7 ]  = 0.0f;
+            m[ 8 ]  = 2.0f * (xz + wy) * sz;
+            m[ 9 ]  = 2.0f * (yz - wx) * sz;
+            m[ 10 ] = (1.0f - 2.0f * (xx + yy)) * sz;
+            m[ 11 ] = 0.0f;
+            m[ 12 ] = transformations.m_positionX[ i ];
+            m[ 13 ] = transformations.m_positionY[ i ];
+            m[ 14 ] = transformations.m_positionZ[ i ];
+            m[ 15 ] = 1.0f;
+        }
+    }
+
+    // lerps positions and scales and nlerps rotations, along the shortest arc
+    void InterpolateScalar(const engine::TransformationArrays& previous, const engine::TransformationArrays& current, float t, const engine::TransformationArrays& results, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            float ax = previous.m_rotationX[ i ];
+            float ay = previous.m_rotationY[ i ];
+            float az = previous.m_rotationZ[ i ];
+            float aw = previous.m_rotationW[ i ];
+            float bx = current.m_rotationX[ i ];
+            float by = current.m_rotationY[ i ];
+            float bz = current.m_rotationZ[ i ];
+            float bw = current.m_rotationW[ i ];
+
+            float sign = ax * bx + ay * by + az * bz + aw * bw < 0.0f ? -1.0f : 1.0f;
+
+            float rx = ax + (bx * sign - ax) * t;
+            float ry = ay + (by * sign - ay) * t;
+            float rz = az + (bz * sign - az) * t;
+            float rw = aw + (bw * sign - aw) * t;
+
+            // both ends are in the same hemisphere, so the length never drops below sqrt(0.5)
+            float inverse = 1.0f / std::sqrt(rx * rx + ry * ry + rz * rz + rw * rw);
+
+            results.m_positionX[ i ] = previous.m_positionX[ i ] + (current.m_positionX[ i ] - previous.m_positionX[ i ]) * t;
+            results.m_positionY[ i ] = previous.m_positionY[ i ] + (current.m_positionY[ i ] - previous.m_positionY[ i ]) * t;
+            results.m_positionZ[ i ] = previous.m_positionZ[ i ] + (current.m_positionZ[ i ] - previous.m_positionZ[ i ]) * t;
+            results.m_rotationX[ i ] = rx * inverse;
+            results.m_rotationY[ i ] = ry * inverse;
+            results.m_rotationZ[ i ] = rz * inverse;
+            results.m_rotationW[ i ] = rw * inverse;
+            results.m_scaleX[ i ]    = previous.m_scaleX[ i ] + (current.m_scaleX[ i ] - previous.m_scaleX[ i ]) * t;
+            results.m_scaleY[ i ]    = previous.m_scaleY[ i ] + (current.m_scaleY[ i ] - previous.m_scaleY[ i ]) * t;
+            results.m_scaleZ[ i ]    = previous.m_scaleZ[ i ] + (current.m_scaleZ[ i ] - previous.m_scaleZ[ i ]) * t;
+        }
+    }
+
+#if ENGINE_SIMD_X86
+    ENGINE_TARGET_SSE2 size_t ConcatenateSse2(const engine::TransformationArrays& parents, const engine::TransformationArrays& locals, const engine::TransformationArrays& results, size_t end)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one  = _mm_set1_ps(1.0f);
+        const __m128 two  = _mm_set1_ps(2.0f);
+
+        size_t i = 0;
+        for (; i + 4 <= end; i += 4)
+        {
+            __m128 qx = _mm_loadu_ps(parents.m_rotationX + i);
+            __m128 qy = _mm_loadu_ps(parents.m_rotationY + i);
+            __m128 qz = _mm_loadu_ps(parents.m_rotationZ + i);
+            __m128 qw = _mm_loadu_ps(parents.m_rotationW + i);
+            __m128 cx = _mm_loadu_ps(locals.m_rotationX + i);
+            __m128 cy = _mm_loadu_ps(locals.m_rotationY + i);
+            __m128 cz = _mm_loadu_ps(locals.m_rotationZ + i);
+            __m128 cw = _mm_loadu_ps(locals.m_rotationW + i);
+
+            __m128 psx = _mm_loadu_ps(parents.m_scaleX + i);
+            __m128 psy = _mm_loadu_ps(parents.m_scaleY + i);
+            __m128 psz = _mm_loadu_ps(parents.m_scaleZ + i);
+
+            __m128 vx = _mm_mul_ps(psx, _mm_loadu_ps(locals.m_positionX + i));
+            __m128 vy = _mm_mul_ps(psy, _mm_loadu_ps(locals.m_positionY + i));
+            __m128 vz = _mm_mul_ps(psz, _mm_loadu_ps(locals.m_positionZ + i));
+
+            __m128 uvx  = _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy));
+            __m128 uvy  = _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz));
+            __m128 uvz  = _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx));
+            __m128 uuvx = _mm_sub_ps(_mm_mul_ps(qy, uvz), _mm_mul_ps(qz, uvy));
+            __m128 uuvy = _mm_sub_ps(_mm_mul_ps(qz, uvx), _mm_mul_ps(qx, uvz));
+            __m128 uuvz = _mm_sub_ps(_mm_mul_ps(qx, uvy), _mm_mul_ps(qy, uvx));
+
+            __m128 px = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(parents.m_positionX + i), vx), _mm_mul_ps(_mm_add_ps(_mm_mul_ps(uvx, qw), uuvx), two));
+            __m128 py = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(parents.m_positionY + i), vy), _mm_mul_ps(_mm_add_ps(_mm_mul_ps(uvy, qw), uuvy), two));
+            __m128 pz = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(parents.m_positionZ + i), vz), _mm_mul_ps(_mm_add_ps(_mm_mul_ps(uvz, qw), uuvz), two));
+
+            __m128 rw = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(qw, cw), _mm_mul_ps(qx, cx)), _mm_add_ps(_mm_mul_ps(qy, cy), _mm_mul_ps(qz, cz)));
+            __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qw, cx), _mm_mul_ps(qx, cw)), _mm_sub_ps(_mm_mul_ps(qy, cz), _mm_mul_ps(qz, cy)));
+            __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qw, cy), _mm_mul_ps(qy, cw)), _mm_sub_ps(_mm_mul_ps(qz, cx), _mm_mul_ps(qx, cz)));
+            __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qw, cz), _mm_mul_ps(qz, cw)), _mm_sub_ps(_mm_mul_ps(qx, cy), _mm_mul_ps(qy, cx)));
+
+            // degenerate products become the identity, like glm::normalize
+            __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rw, rw)));
+            __m128 valid         = _mm_cmpgt_ps(lengthSquared, zero);
+            __m128 inverse       = _mm_and_ps(valid, _mm_div_ps(one, _mm_sqrt_ps(lengthSquared)));
+
+            rx = _mm_mul_ps(rx, inverse);
+            ry = _mm_mul_ps(ry, inverse);
+            rz = _mm_mul_ps(rz, inverse);
+            rw = _mm_or_ps(_mm_mul_ps(rw, inverse), _mm_andnot_ps(valid, one));
+
+            __m128 sx = _mm_mul_ps(psx, _mm_loadu_ps(locals.m_scaleX + i));
+            __m128 sy = _mm_mul_ps(psy, _mm_loadu_ps(locals.m_scaleY + i));
+            __m128 sz = _mm_mul_ps(psz, _mm_loadu_ps(locals.m_scaleZ + i));
+
+            _mm_storeu_ps(results.m_positionX + i, px);
+            _mm_storeu_ps(results.m_positionY + i, py);
+            _mm_storeu_ps(results.m_positionZ + i, pz);
+            _mm_storeu_ps(results.m_rotationX + i, rx);
+            _mm_storeu_ps(results.m_rotationY + i, ry);
+            _mm_storeu_ps(results.m_rotationZ + i, rz);
+            _mm_storeu_ps(results.m_rotationW + i, rw);
+            _mm_storeu_ps(results.m_scaleX + i, sx);
+            _mm_storeu_ps(results.m_scaleY + i, sy);
+            _mm_storeu_ps(results.m_scaleZ + i, sz);
+        }
+
+        return i;
+    }
+
+    ENGINE_TARGET_SSE2 size_t ComputeMatricesSse2(const engine::TransformationArrays& transformations, glm::mat4* matrices, size_t end)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+
+        size_t i = 0;
+        for (; i + 4 <= end; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(transformations.m_rotationX + i);
+            __m128 y = _mm_loadu_ps(transformations.m_rotationY + i);
+            __m128 z = _mm_loadu_ps(transformations.m_rotationZ + i);
+            __m128 w = _mm_loadu_ps(transformations.m_rotationW + i);
+
+            __m128 sx = _mm_loadu_ps(transformations.m_scaleX + i);
+            __m128 sy = _mm_loadu_ps(transformations.m_scaleY + i);
+            __m128 sz = _mm_loadu_ps(transformations.m_scaleZ + i);
+
+            __m128 xx = _mm_mul_ps(x, x);
+            __m128 yy = _mm_mul_ps(y, y);
+            __m128 zz = _mm_mul_ps(z, z);
+            __m128 xy = _mm_mul_ps(x, y);
+            __m128 xz = _mm_mul_ps(x, z);
+            __m128 yz = _mm_mul_ps(y, z);
+            __m128 wx = _mm_mul_ps(w, x);
+            __m128 wy = _mm_mul_ps(w, y);
+            __m128 wz = _mm_mul_ps(w, z);
+
+            // one register per matrix element, lane n belongs to matrix i + n
+            __m128 m0  = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+            __m128 m1  = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+            __m128 m2  = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+            __m128 m3  = _mm_setzero_ps();
+            __m128 m4  = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+            __m128 m5  = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+            __m128 m6  = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+            __m128 m7  = _mm_setzero_ps();
+            __m128 m8  = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+            __m128 m9  = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+            __m128 m10 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+            __m128 m11 = _mm_setzero_ps();
+            __m128 m12 = _mm_loadu_ps(transformations.m_positionX + i);
+            __m128 m13 = _mm_loadu_ps(transformations.m_positionY + i);
+            __m128 m14 = _mm_loadu_ps(transformations.m_positionZ + i);
+            __m128 m15 = one;
+
+            // after the transposes each register is one column of one matrix
+            _MM_TRANSPOSE4_PS(m0, m1, m2, m3);
+            _MM_TRANSPOSE4_PS(m4, m5, m6, m7);
+            _MM_TRANSPOSE4_PS(m8, m9, m10, m11);
+            _MM_TRANSPOSE4_PS(m12, m13, m14, m15);
+
+            float* a = &matrices[ i ][ 0 ][ 0 ];
+            float* b = &matrices[ i + 1 ][ 0 ][ 0 ];
+            float* c = &matrices[ i + 2 ][ 0 ][ 0 ];
+            float* d = &matrices[ i + 3 ][ 0 ][ 0 ];
+
+            _mm_storeu_ps(a, m0);
+            _mm_storeu_ps(a + 4, m4);
+            _mm_storeu_ps(a + 8, m8);
+            _mm_storeu_ps(a + 12, m12);
+            _mm_storeu_ps(b, m1);
+            _mm_storeu_ps(b + 4, m5);
+            _mm_storeu_ps(b + 8, m9);
+            _mm_storeu_ps(b + 12, m13);
+            _mm_storeu_ps(c, m2);
+            _mm_storeu_ps(c + 4, m6);
+            _mm_storeu_ps(c + 8, m10);
+            _mm_storeu_ps(c + 12, m14);
+            _mm_storeu_ps(d, m3);
+            _mm_storeu_ps(d + 4, m7);
+            _mm_storeu_ps(d + 8, m11);
+            _mm_storeu_ps(d + 12, m15);
+        }
+
+        return i;
+    }
+
+    ENGINE_TARGET_SSE2 __m128 LerpSse2(const float* a, const float* b, __m128 t)
+    {
+        __m128 start = _mm_loadu_ps(a);
+        return _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b), start), t));
+    }
+
+    ENGINE_TARGET_SSE2 size_t InterpolateSse2(const engine::TransformationArrays& previous, const engine::TransformationArrays& current, float alpha, const engine::TransformationArrays& results, size_t end)
+    {
+        const __m128 t        = _mm_set1_ps(alpha);
+        const __m128 one      = _mm_set1_ps(1.0f);
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+
+        size_t i = 0;
+        for (; i + 4 <= end; i += 4)
+        {
+            __m128 ax = _mm_loadu_ps(previous.m_rotationX + i);
+            __m128 ay = _mm_loadu_ps(previous.m_rotationY + i);
+            __m128 az = _mm_loadu_ps(previous.m_rotationZ + i);
+            __m128 aw = _mm_loadu_ps(previous.m_rotationW + i);
+            __m128 bx = _mm_loadu_ps(current.m_rotationX + i);
+            __m128 by = _mm_loadu_ps(current.m_rotationY + i);
+            __m128 bz = _mm_loadu_ps(current.m_rotationZ + i);
+            __m128 bw = _mm_loadu_ps(current.m_rotationW + i);
+
+            // flips the end quaternion where the dot product is negative
+            __m128 dot  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+            __m128 sign = _mm_and_ps(dot, signMask);
+
+            __m128 rx = _mm_add_ps(ax, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bx, sign), ax), t));
+            __m128 ry = _mm_add_ps(ay, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(by, sign), ay), t));
+            __m128 rz = _mm_add_ps(az, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bz, sign), az), t));
+            __m128 rw = _mm_add_ps(aw, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bw, sign), aw), t));
+
+            __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rw, rw)));
+            __m128 inverse       = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+
+            _mm_storeu_ps(results.m_positionX + i, LerpSse2(previous.m_positionX + i, current.m_positionX + i, t));
+            _mm_storeu_ps(results.m_positionY + i, LerpSse2(previous.m_positionY + i, current.m_positionY + i, t));
+            _mm_storeu_ps(results.m_positionZ + i, LerpSse2(previous.m_positionZ + i, current.m_positionZ + i, t));
+            _mm_storeu_ps(results.m_rotationX + i, _mm_mul_ps(rx, inverse));
+            _mm_storeu_ps(results.m_rotationY + i, _mm_mul_ps(ry, inverse));
+            _mm_storeu_ps(results.m_rotationZ + i, _mm_mul_ps(rz, inverse));
+            _mm_storeu_ps(results.m_rotationW + i, _mm_mul_ps(rw, inverse));
+            _mm_storeu_ps(results.m_scaleX + i, LerpSse2(previous.m_scaleX + i, current.m_scaleX + i, t));
+            _mm_storeu_ps(results.m_scaleY + i, LerpSse2(previous.m_scaleY + i, current.m_scaleY + i, t));
+            _mm_storeu_ps(results.m_scaleZ + i, LerpSse2(previous.m_scaleZ + i, current.m_scaleZ + i, t));
+        }
+
+        return i;
+    }
+
+    ENGINE_TARGET_AVX2 size_t ConcatenateAvx2(const engine::TransformationArrays& parents, const engine::TransformationArrays& locals, const engine::TransformationArrays& results, size_t end)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one  = _mm256_set1_ps(1.0f);
+        const __m256 two  = _mm256_set1_ps(2.0f);
+
+        size_t i = 0;
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256 qx = _mm256_loadu_ps(parents.m_rotationX + i);
+            __m256 qy = _mm256_loadu_ps(parents.m_rotationY + i);
+            __m256 qz = _mm256_loadu_ps(parents.m_rotationZ + i);
+            __m256 qw = _mm256_loadu_ps(parents.m_rotationW + i);
+            __m256 cx = _mm256_loadu_ps(locals.m_rotationX + i);
+            __m256 cy = _mm256_loadu_ps(locals.m_rotationY + i);
+            __m256 cz = _mm256_loadu_ps(locals.m_rotationZ + i);
+            __m256 cw = _mm256_loadu_ps(locals.m_rotationW + i);
+
+            __m256 psx = _mm256_loadu_ps(parents.m_scaleX + i);
+            __m256 psy = _mm256_loadu_ps(parents.m_scaleY + i);
+            __m256 psz = _mm256_loadu_ps(parents.m_scaleZ + i);
+
+            __m256 vx = _mm256_mul_ps(psx, _mm256_loadu_ps(locals.m_positionX + i));
+            __m256 vy = _mm256_mul_ps(psy, _mm256_loadu_ps(locals.m_positionY + i));
+            __m256 vz = _mm256_mul_ps(psz, _mm256_loadu_ps(locals.m_positionZ + i));
+
+            __m256 uvx  = _mm256_fmsub_ps(qy, vz, _mm256_mul_ps(qz, vy));
+            __m256 uvy  = _mm256_fmsub_ps(qz, vx, _mm256_mul_ps(qx, vz));
+            __m256 uvz  = _mm256_fmsub_ps(qx, vy, _mm256_mul_ps(qy, vx));
+            __m256 uuvx = _mm256_fmsub_ps(qy, uvz, _mm256_mul_ps(qz, uvy));
+            __m256 uuvy = _mm256_fmsub_ps(qz, uvx, _mm256_mul_ps(qx, uvz));
+            __m256 uuvz = _mm256_fmsub_ps(qx, uvy, _mm256_mul_ps(qy, uvx));
+
+            __m256 px = _mm256_fmadd_ps(_mm256_fmadd_ps(uvx, qw, uuvx), two, _mm256_add_ps(_mm256_loadu_ps(parents.m_positionX + i), vx));
+            __m256 py = _mm256_fmadd_ps(_mm256_fmadd_ps(uvy, qw, uuvy), two, _mm256_add_ps(_mm256_loadu_ps(parents.m_positionY + i), vy));
+            __m256 pz = _mm256_fmadd_ps(_mm256_fmadd_ps(uvz, qw, uuvz), two, _mm256_add_ps(_mm256_loadu_ps(parents.m_positionZ + i), vz));
+
+            __m256 rw = _mm256_sub_ps(_mm256_fmsub_ps(qw, cw, _mm256_mul_ps(qx, cx)), _mm256_fmadd_ps(qy, cy, _mm256_mul_ps(qz, cz)));
+            __m256 rx = _mm256_add_ps(_mm256_fmadd_ps(qw, cx, _mm256_mul_ps(qx, cw)), _mm256_fmsub_ps(qy, cz, _mm256_mul_ps(qz, cy)));
+            __m256 ry = _mm256_add_ps(_mm256_fmadd_ps(qw, cy, _mm256_mul_ps(qy, cw)), _mm256_fmsub_ps(qz, cx, _mm256_mul_ps(qx, cz)));
+            __m256 rz = _mm256_add_ps(_mm256_fmadd_ps(qw, cz, _mm256_mul_ps(qz, cw)), _mm256_fmsub_ps(qx, cy, _mm256_mul_ps(qy, cx)));
+
+            // degenerate products become the identity, like glm::normalize
+            __m256 lengthSquared = _mm256_fmadd_ps(rx, rx, _mm256_fmadd_ps(ry, ry, _mm256_fmadd_ps(rz, rz, _mm256_mul_ps(rw, rw))));
+            __m256 valid         = _mm256_cmp_ps(lengthSquared, zero, _CMP_GT_OQ);
+            __m256 inverse       = _mm256_and_ps(valid, _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared)));
+
+            rx = _mm256_mul_ps(rx, inverse);
+            ry = _mm256_mul_ps(ry, inverse);
+            rz = _mm256_mul_ps(rz, inverse);
+            rw = _mm256_blendv_ps(one, _mm256_mul_ps(rw, inverse), valid);
+
+            __m256 sx = _mm256_mul_ps(psx, _mm256_loadu_ps(locals.m_scaleX + i));
+            __m256 sy = _mm256_mul_ps(psy, _mm256_loadu_ps(locals.m_scaleY + i));
+            __m256 sz = _mm256_mul_ps(psz, _mm256_loadu_ps(locals.m_scaleZ + i));
+
+            _mm256_storeu_ps(results.m_positionX + i, px);
+            _mm256_storeu_ps(results.m_positionY + i, py);
+            _mm256_storeu_ps(results.m_positionZ + i, pz);
+            _mm256_storeu_ps(results.m_rotationX + i, rx);
+            _mm256_storeu_ps(results.m_rotationY + i, ry);
+            _mm256_storeu_ps(results.m_rotationZ + i, rz);
+            _mm256_storeu_ps(results.m_rotationW + i, rw);
+            _mm256_storeu_ps(results.m_scaleX + i, sx);
+            _mm256_storeu_ps(results.m_scaleY + i, sy);
+            _mm256_storeu_ps(results.m_scaleZ + i, sz);
+        }
+
+        return i;
+    }
+
+    // transposes the 4x4 blocks held in each 128 bit half. a b c d hold one matrix element each
+    // for 8 matrices, the results hold that column of matrices n and n + 4 in r<n>
+    ENGINE_TARGET_AVX2 void Transpose4x4Halves(__m256 a, __m256 b, __m256 c, __m256 d, __m256& r0, __m256& r1, __m256& r2, __m256& r3)
+    {
+        __m256 t0 = _mm256_unpacklo_ps(a, b);
+        __m256 t1 = _mm256_unpackhi_ps(a, b);
+        __m256 t2 = _mm256_unpacklo_ps(c, d);
+        __m256 t3 = _mm256_unpackhi_ps(c, d);
+
+        r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    // stores two columns of matrices n and n + 4, given as returned by Transpose4x4Halves
+    ENGINE_TARGET_AVX2 void StoreColumnPairs(float* low, float* high, __m256 first, __m256 second)
+    {
+        _mm256_storeu_ps(low, _mm256_permute2f128_ps(first, second, 0x20));
+        _mm256_storeu_ps(high, _mm256_permute2f128_ps(first, second, 0x31));
+    }
+
+    ENGINE_TARGET_AVX2 size_t ComputeMatricesAvx2(const engine::TransformationArrays& transformations, glm::mat4* matrices, size_t end)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one  = _mm256_set1_ps(1.0f);
+
+        size_t i = 0;
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256 x = _mm256_loadu_ps(transformations.m_rotationX + i);
+            __m256 y = _mm256_loadu_ps(transformations.m_rotationY + i);
+            __m256 z = _mm256_loadu_ps(transformations.m_rotationZ + i);
+            __m256 w = _mm256_loadu_ps(transformations.m_rotationW + i);
+
+            __m256 sx = _mm256_loadu_ps(transformations.m_scaleX + i);
+            __m256 sy = _mm256_loadu_ps(transformations.m_scaleY + i);
+            __m256 sz = _mm256_loadu_ps(transformations.m_scaleZ + i);
+
+            // doubled up front, which saves a multiply per element
+            __m256 x2 = _mm256_add_ps(x, x);
+            __m256 y2 = _mm256_add_ps(y, y);
+            __m256 z2 = _mm256_add_ps(z, z);
+
+            __m256 xx = _mm256_mul_ps(x, x2);
+            __m256 yy = _mm256_mul_ps(y, y2);
+            __m256 zz = _mm256_mul_ps(z, z2);
+            __m256 xy = _mm256_mul_ps(x, y2);
+            __m256 xz = _mm256_mul_ps(x, z2);
+            __m256 yz = _mm256_mul_ps(y, z2);
+            __m256 wx = _mm256_mul_ps(w, x2);
+            __m256 wy = _mm256_mul_ps(w, y2);
+            __m256 wz = _mm256_mul_ps(w, z2);
+
+            __m256 m0  = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_add_ps(yy, zz)), sx);
+            __m256 m1  = _mm256_mul_ps(_mm256_add_ps(xy, wz), sx);
+            __m256 m2  = _mm256_mul_ps(_mm256_sub_ps(xz, wy), sx);
+            __m256 m4  = _mm256_mul_ps(_mm256_sub_ps(xy, wz), sy);
+            __m256 m5  = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_add_ps(xx, zz)), sy);
+            __m256 m6  = _mm256_mul_ps(_mm256_add_ps(yz, wx), sy);
+            __m256 m8  = _mm256_mul_ps(_mm256_add_ps(xz, wy), sz);
+            __m256 m9  = _mm256_mul_ps(_mm256_sub_ps(yz, wx), sz);
+            __m256 m10 = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_add_ps(xx, yy)), sz);
+            __m256 m12 = _mm256_loadu_ps(transformations.m_positionX + i);
+            __m256 m13 = _mm256_loadu_ps(transformations.m_positionY + i);
+            __m256 m14 = _mm256_loadu_ps(transformations.m_positionZ + i);
+
+            __m256 c0[ 4 ];
+            __m256 c1[ 4 ];
+            __m256 c2[ 4 ];
+            __m256 c3[ 4 ];
+            Transpose4x4Halves(m0, m1, m2, zero, c0[ 0 ], c0[ 1 ], c0[ 2 ], c0[ 3 ]);
+            Transpose4x4Halves(m4, m5, m6, zero, c1[ 0 ], c1[ 1 ], c1[ 2 ], c1[ 3 ]);
+            Transpose4x4Halves(m8, m9, m10, zero, c2[ 0 ], c2[ 1 ], c2[ 2 ], c2[ 3 ]);
+            Transpose4x4Halves(m12, m13, m14, one, c3[ 0 ], c3[ 1 ], c3[ 2 ], c3[ 3 ]);
+
+            for (size_t n = 0; n < 4; ++n)
+            {
+                float* low  = &matrices[ i + n ][ 0 ][ 0 ];
+                float* high = &matrices[ i + n + 4 ][ 0 ][ 0 ];
+
+                StoreColumnPairs(low, high, c0[ n ], c1[ n ]);
+                StoreColumnPairs(low + 8, high + 8, c2[ n ], c3[ n ]);
+            }
+        }
+
+        return i;
+    }
+
+    ENGINE_TARGET_AVX2 __m256 LerpAvx2(const float* a, const float* b, __m256 t)
+    {
+        __m256 start = _mm256_loadu_ps(a);
+        return _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(b), start), t, start);
+    }
+
+    ENGINE_TARGET_AVX2 size_t InterpolateAvx2(const engine::TransformationArrays& previous, const engine::TransformationArrays& current, float alpha, const engine::TransformationArrays& results, size_t end)
+    {
+        const __m256 t        = _mm256_set1_ps(alpha);
+        const __m256 one      = _mm256_set1_ps(1.0f);
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+        size_t i = 0;
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256 ax = _mm256_loadu_ps(previous.m_rotationX + i);
+            __m256 ay = _mm256_loadu_ps(previous.m_rotationY + i);
+            __m256 az = _mm256_loadu_ps(previous.m_rotationZ + i);
+            __m256 aw = _mm256_loadu_ps(previous.m_rotationW + i);
+            __m256 bx = _mm256_loadu_ps(current.m_rotationX + i);
+            __m256 by = _mm256_loadu_ps(current.m_rotationY + i);
+            __m256 bz = _mm256_loadu_ps(current.m_rotationZ + i);
+            __m256 bw = _mm256_loadu_ps(current.m_rotationW + i);
+
+            // flips the end quaternion where the dot product is negative
+            __m256 dot  = _mm256_fmadd_ps(ax, bx, _mm256_fmadd_ps(ay, by, _mm256_fmadd_ps(az, bz, _mm256_mul_ps(aw, bw))));
+            __m256 sign = _mm256_and_ps(dot, signMask);
+
+            __m256 rx = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_xor_ps(bx, sign), ax), t, ax);
+            __m256 ry = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_xor_ps(by, sign), ay), t, ay);
+            __m256 rz = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_xor_ps(bz, sign), az), t, az);
+            __m256 rw = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_xor_ps(bw, sign), aw), t, aw);
+
+            __m256 lengthSquared = _mm256_fmadd_ps(rx, rx, _mm256_fmadd_ps(ry, ry, _mm256_fmadd_ps(rz, rz, _mm256_mul_ps(rw, rw))));
+            __m256 inverse       = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared));
+
+            _mm256_storeu_ps(results.m_positionX + i, LerpAvx2(previous.m_positionX + i, current.m_positionX + i, t));
+            _mm256_storeu_ps(results.m_positionY + i, LerpAvx2(previous.m_positionY + i, current.m_positionY + i, t));
+            _mm256_storeu_ps(results.m_positionZ + i, LerpAvx2(previous.m_positionZ + i, current.m_positionZ + i, t));
+            _mm256_storeu_ps(results.m_rotationX + i, _mm256_mul_ps(rx, inverse));
+            _mm256_storeu_ps(results.m_rotationY + i, _mm256_mul_ps(ry, inverse));
+            _mm256_storeu_ps(results.m_rotationZ + i, _mm256_mul_ps(rz, inverse));
+            _mm256_storeu_ps(results.m_rotationW + i, _mm256_mul_ps(rw, inverse));
+            _mm256_storeu_ps(results.m_scaleX + i, LerpAvx2(previous.m_scaleX + i, current.m_scaleX + i, t));
+            _mm256_storeu_ps(results.m_scaleY + i, LerpAvx2(previous.m_scaleY + i, current.m_scaleY + i, t));
+            _mm256_storeu_ps(results.m_scaleZ + i, LerpAvx2(previous.m_scaleZ + i, current.m_scaleZ + i, t));
+        }
+
+        return i;
+    }
+
+#endif
+
+    void CheckCounts(const engine::TransformationArrays& first, const engine::TransformationArrays& second)
+    {
+        if (first.m_count != second.m_count)
+        {
+            throw std::runtime_error("Tried to combine transformation batches of different sizes");
+        }
+    }
+} // namespace
+
+void engine::TransformationBuffer::Resize(size_t count)
+{
+    m_positionX.resize(count, 0.0f);
+    m_positionY.resize(count, 0.0f);
+    m_positionZ.resize(count, 0.0f);
+    m_rotationX.resize(count, 0.0f);
+    m_rotationY.resize(count, 0.0f);
+    m_rotationZ.resize(count, 0.0f);
+    m_rotationW.resize(count, 1.0f);
+    m_scaleX.resize(count, 1.0f);
+    m_scaleY.resize(count, 1.0f);
+    m_scaleZ.resize(count, 1.0f);
+}
+
+size_t engine::TransformationBuffer::GetCount() const
+{
+    return m_positionX.size();
+}
+
+void engine::TransformationBuffer::Set(size_t index, const engine::Transformation& transformation)
+{
+    glm::quat rotation = transformation.m_rotation.GetQuaternion();
+
+    m_positionX[ index ] = transformation.m_position.x;
+    m_positionY[ index ] = transformation.m_position.y;
+    m_positionZ[ index ] = transformation.m_position.z;
+    m_rotationX[ index ] = rotation.x;
+    m_rotationY[ index ] = rotation.y;
+    m_rotationZ[ index ] = rotation.z;
+    m_rotationW[ index ] = rotation.w;
+    m_scaleX[ index ]    = transformation.m_scale.x;
+    m_scaleY[ index ]    = transformation.m_scale.y;
+    m_scaleZ[ index ]    = transformation.m_scale.z;
+}
+
+engine::Transformation engine::TransformationBuffer::Get(size_t index) const
+{
+    glm::vec3 position { m_positionX[ index ], m_positionY[ index ], m_positionZ[ index ] };
+    glm::quat rotation { m_rotationW[ index ], m_rotationX[ index ], m_rotationY[ index ], m_rotationZ[ index ] };
+    glm::vec3 scale { m_scaleX[ index ], m_scaleY[ index ], m_scaleZ[ index ] };
+
+    return Transformation { position, Rotation { rotation, Rotation::ASSUME_NORMALIZED }, scale };
+}
+
+engine::TransformationArrays engine::TransformationBuffer::GetArrays()
+{
+    return TransformationArrays {
+        m_positionX.data(),
+        m_positionY.data(),
+        m_positionZ.data(),
+        m_rotationX.data(),
+        m_rotationY.data(),
+        m_rotationZ.data(),
+        m_rotationW.data(),
+        m_scaleX.data(),
+        m_scaleY.data(),
+        m_scaleZ.data(),
+        m_positionX.size()
+    };
+}
+
+void engine::ConcatenateTransformations(const engine::TransformationArrays& parents, const engine::TransformationArrays& locals, const engine::TransformationArrays& results)
+{
+    CheckCounts(parents, locals);
+    CheckCounts(parents, results);
+
+    size_t count = parents.m_count;
+    size_t done  = 0;
+
+#if ENGINE_SIMD_X86
+    switch (GetSimdLevel())
+    {
+        case SimdLevel::Avx2:
+            done = ConcatenateAvx2(parents, locals, results, count);
+            break;
+        case SimdLevel::Sse2:
+            done = ConcatenateSse2(parents, locals, results, count);
+            break;
+        case SimdLevel::Scalar:
+            break;
+    }
+#endif
+
+    ConcatenateScalar(parents, locals, results, done, count);
+}
+
+void engine::ComputeTransformationMatrices(const engine::TransformationArrays& transformations, glm::mat4* matrices)
+{
+    size_t count = transformations.m_count;
+    size_t done  = 0;
+
+#if ENGINE_SIMD_X86
+    switch (GetSimdLevel())
+    {
+        case SimdLevel::Avx2:
+            done = ComputeMatricesAvx2(transformations, matrices, count);
+            break;
+        case SimdLevel::Sse2:
+            done = ComputeMatricesSse2(transformations, matrices, count);
+            break;
+        case SimdLevel::Scalar:
+            break;
+    }
+#endif
+
+    ComputeMatricesScalar(transformations, matrices, done, count);
+}
+
+void engine::InterpolateTransformations(const engine::TransformationArrays& previous, const engine::TransformationArrays& current, float alpha, const engine::TransformationArrays& results)
+{
+    CheckCounts(previous, current);
+    CheckCounts(previous, results);
+
+    size_t count = previous.m_count;
+    size_t done  = 0;
+
+#if ENGINE_SIMD_X86
+    switch (GetSimdLevel())
+    {
+        case SimdLevel::Avx2:
+            done = InterpolateAvx2(previous, current, alpha, results, count);
+            break;
+        case SimdLevel::Sse2:
+            done = InterpolateSse2(previous, current, alpha, results, count);
+            break;
+        case SimdLevel::Scalar:
+            break;
+    }
+#endif
+
+    InterpolateScalar(previous, current, alpha, results, done, count);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef TRANSFORMATION_BATCH_HPP
+#define TRANSFORMATION_BATCH_HPP
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "transformation.hpp"
+
+namespace engine
+{
+    // structure of arrays view over a batch of transformations, every array holds m_count
+    // elements. rotations must be unit quaternions
+    struct TransformationArrays
+    {
+        float* m_positionX;
+        float* m_positionY;
+        float* m_positionZ;
+        float* m_rotationX;
+        float* m_rotationY;
+        float* m_rotationZ;
+        float* m_rotationW;
+        float* m_scaleX;
+        float* m_scaleY;
+        float* m_scaleZ;
+        size_t m_count;
+    };
+
+    // owns the arrays behind a TransformationArrays view
+    class TransformationBuffer
+    {
+        std::vector<float> m_positionX;
+        std::vector<float> m_positionY;
+        std::vector<float> m_positionZ;
+        std::vector<float> m_rotationX;
+        std::vector<float> m_rotationY;
+        std::vector<float> m_rotationZ;
+        std::vector<float> m_rotationW;
+        std::vector<float> m_scaleX;
+        std::vector<float> m_scaleY;
+        std::vector<float> m_scaleZ;
+
+      public:
+        // new elements are identity transformations
+        void   Resize(size_t count);
+        size_t GetCount() const;
+
+        void           Set(size_t index, const Transformation& transformation);
+        Transformation Get(size_t index) const;
+
+        // invalidated by Resize
+        TransformationArrays GetArrays();
+    };
+
+    // the batch functions pick the widest kernel the cpu supports (see GetSimdLevel) and match
+    // the scalar Transformation functions within float rounding
+
+    // results[i] = parents[i] * locals[i]. results may be the same arrays as parents or locals
+    void ConcatenateTransformations(const TransformationArrays& parents, const TransformationArrays& locals, const TransformationArrays& results);
+
+    // matrices[i] = transformations[i].GetMatrix()
+    void ComputeTransformationMatrices(const TransformationArrays& transformations, glm::mat4* matrices);
+
+    // lerps positions and scales and nlerps rotations along the shortest arc, alpha 0 gives previous.
+    // nlerp is not constant speed like Rotation::Slerp, which is invisible over a single frame.
+    // results may be the same arrays as previous or current
+    void InterpolateTransformations(const TransformationArrays& previous, const TransformationArrays& current, float alpha, const TransformationArrays& results);
+} // namespace engine
+
+#endif
\ No newline at end of file
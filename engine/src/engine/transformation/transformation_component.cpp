@@ -1 +1,143 @@
-#include "transformation_component.hpp"
\ No newline at end of file
+#include "transformation_component.hpp"
+
+#include "transform_system.hpp"
+#include <system/system_scheduler.hpp>
+
+engine::TransformationComponent::TransformationComponent()
+    : m_local {}
+    , m_world {}
+    , m_worldMatrix { 1.0f }
+    , m_worldVersion { 0 }
+    , m_parent { nullptr }
+    , m_transformSystem { nullptr }
+    , m_registryIndex { 0 }
+    , m_hierarchyIndex { 0 }
+    , m_subtreeSize { 1 }
+    , m_movingIndex { 0 }
+    , m_isDirty { false }
+{
+}
+
+void engine::TransformationComponent::AddToSystem()
+{
+    SystemScheduler::GetInstance().GetSystem<TransformSystem>().AddComponent(this);
+}
+
+void engine::TransformationComponent::RemoveFromSystem()
+{
+    // the system might be gone already when the scheduler shuts down first
+    if (m_transformSystem != nullptr)
+    {
+        m_transformSystem->RemoveComponent(this);
+    }
+}
+
+void engine::TransformationComponent::MarkDirty()
+{
+    if (m_isDirty)
+    {
+        return;
+    }
+
+    m_isDirty = true;
+
+    if (m_transformSystem != nullptr)
+    {
+        m_transformSystem->m_dirtyRoots.push_back(this);
+    }
+}
+
+void engine::TransformationComponent::SetParent(engine::TransformationComponent* parent)
+{
+    m_parent = parent;
+    MarkDirty();
+
+    if (m_transformSystem != nullptr)
+    {
+        m_transformSystem->InvalidateHierarchy();
+    }
+}
+
+engine::TransformationComponent* engine::TransformationComponent::GetParent() const
+{
+    return m_parent;
+}
+
+const engine::Transformation& engine::TransformationComponent::GetLocal() const
+{
+    return m_local;
+}
+
+void engine::TransformationComponent::SetLocal(const engine::Transformation& local)
+{
+    m_local = local;
+    MarkDirty();
+}
+
+void engine::TransformationComponent::SetPosition(glm::vec3 position)
+{
+    m_local.m_position = position;
+    MarkDirty();
+}
+
+void engine::TransformationComponent::SetRotation(const engine::Rotation& rotation)
+{
+    m_local.m_rotation = rotation;
+    MarkDirty();
+}
+
+void engine::TransformationComponent::SetScale(glm::vec3 scale)
+{
+    m_local.m_scale = scale;
+    MarkDirty();
+}
+
+void engine::TransformationComponent::SetWorld(const engine::Transformation& world)
+{
+    SetLocal(m_parent != nullptr ? m_parent->m_world.InverseConcatenate(world) : world);
+}
+
+const engine::Transformation& engine::TransformationComponent::GetWorld() const
+{
+    return m_world;
+}
+
+const glm::mat4& engine::TransformationComponent::GetWorldMatrix() const
+{
+    return m_worldMatrix;
+}
+
+glm::vec3 engine::TransformationComponent::GetWorldPosition() const
+{
+    return m_world.m_position;
+}
+
+size_t engine::TransformationComponent::GetWorldVersion() const
+{
+    return m_worldVersion;
+}
+
+engine::Transformation engine::TransformationComponent::GetPresentation() const
+{
+    if (m_transformSystem != nullptr && m_transformSystem->IsMoving(this))
+    {
+        return m_transformSystem->m_presentation.Get(m_movingIndex);
+    }
+
+    return m_world;
+}
+
+glm::mat4 engine::TransformationComponent::GetPresentationMatrix() const
+{
+    if (m_transformSystem != nullptr && m_transformSystem->IsMoving(this))
+    {
+        return m_transformSystem->m_presentation.Get(m_movingIndex).GetMatrix();
+    }
+
+    return m_worldMatrix;
+}
+
+bool engine::TransformationComponent::IsDirty() const
+{
+    return m_isDirty;
+}
\ No newline at end of file
@@ -1,17 +1,71 @@
 #ifndef TRANSFORMATION_COMPONENT_HPP
-#define TRASFORMATION_COMPONENT_HPP
+#define TRANSFORMATION_COMPONENT_HPP
 
-#include <game_object/component.hpp>
+#include <glm/glm.hpp>
+
+#include <engine/game_object/component.hpp>
 #include "transformation.hpp"
 
 namespace engine
 {
+    class TransformSystem;
+
+    // local transformation of a game object, relative to the closest ancestor with a transformation.
+    // world values are cached, and refreshed by the transform system for every subtree that changed.
+    // they reflect the state of the last transform system update
     class TransformationComponent : public Component
     {
-        Transformation m_transformation;
+        friend class TransformSystem;
+
+        Transformation           m_local;
+        Transformation           m_world;
+        glm::mat4                m_worldMatrix;
+        size_t                   m_worldVersion; // bumped every time the world transformation is recomputed
+        TransformationComponent* m_parent;
+
+        // bookkeeping of the transform system
+        TransformSystem* m_transformSystem; // null while not registered
+        size_t           m_registryIndex;   // position inside the registered components
+        size_t           m_hierarchyIndex;  // position inside the flattened hierarchy
+        size_t           m_subtreeSize;     // this transformation plus all its descendants
+        size_t           m_movingIndex;     // position inside the moving transformations, if moving
+        bool             m_isDirty;         // local changed since the last update
+
+        void MarkDirty();
+
+      protected:
+        void AddToSystem() override;
+        void RemoveFromSystem() override;
 
       public:
-        void SetParent(TransformationComponent*) { };
+        TransformationComponent();
+
+        void                     SetParent(TransformationComponent* parent);
+        TransformationComponent* GetParent() const;
+
+        const Transformation& GetLocal() const;
+        void                  SetLocal(const Transformation& local);
+        void                  SetPosition(glm::vec3 position);
+        void                  SetRotation(const Rotation& rotation);
+        void                  SetScale(glm::vec3 scale);
+
+        // sets the local transformation that results in the given world transformation,
+        // using the world transformation of the parent as of the last update
+        void SetWorld(const Transformation& world);
+
+        const Transformation& GetWorld() const;
+        const glm::mat4&      GetWorldMatrix() const;
+        glm::vec3             GetWorldPosition() const;
+
+        // changes whenever the world transformation is recomputed, to detect movement without comparing
+        size_t GetWorldVersion() const;
+
+        // the world transformation interpolated between the last two updates, see
+        // TransformSystem::Interpolate. the world transformation for anything that did not move
+        Transformation GetPresentation() const;
+        glm::mat4      GetPresentationMatrix() const;
+
+        bool IsDirty() const;
     };
 } // namespace engine
 
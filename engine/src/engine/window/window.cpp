@@ -1,6 +1,7 @@
 #include "window.hpp"
 
 #include <stdexcept>
+#include <utility> // move
 
 #include <SDL3/SDL.h>
 #include <glbinding/gl/gl.h>
@@ -66,6 +67,13 @@ engine::Window::Window()
     : m_window { nullptr }
     , m_context { nullptr }
     , m_isFullScreenEnabled { false }
+    , m_backend { WindowBackend::Sdl }
+    , m_width { Constants::INITIAL_WINDOW_WIDTH }
+    , m_height { Constants::INITIAL_WINDOW_HEIGHT }
+    , m_title { "editor" }
+    , m_isVSyncEnabled { false }
+    , m_swapCount { 0 }
+    , m_swapCallback {}
 {
 }
 
@@ -75,8 +83,19 @@ engine::Window& engine::Window::GetInstance()
     return instance;
 }
 
-void engine::Window::Initialize()
+void engine::Window::Initialize(engine::WindowBackend backend)
 {
+    m_backend   = backend;
+    m_swapCount = 0;
+
+    if (m_backend == WindowBackend::Headless)
+    {
+        m_window              = nullptr;
+        m_context             = nullptr;
+        m_isFullScreenEnabled = false;
+        return;
+    }
+
     // sdl init
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMEPAD) == false)
     {
@@ -126,8 +145,23 @@ void engine::Window::Initialize()
     gl::glDebugMessageCallback(DebugCallback, 0);
 }
 
+engine::WindowBackend engine::Window::GetBackend() const
+{
+    return m_backend;
+}
+
+bool engine::Window::IsHeadless() const
+{
+    return m_backend == WindowBackend::Headless;
+}
+
 bool engine::Window::IsMinimized()
 {
+    if (m_backend == WindowBackend::Headless)
+    {
+        return false;
+    }
+
     return SDL_GetWindowFlags(static_cast<SDL_Window*>(m_window)) & SDL_WINDOW_MINIMIZED;
 }
 
@@ -148,6 +182,11 @@ void engine::Window::ProcessEvents(void* sdl_event)
 
 void engine::Window::Shutdown()
 {
+    if (m_backend == WindowBackend::Headless)
+    {
+        return;
+    }
+
     SDL_GL_DestroyContext(static_cast<SDL_GLContext>(m_context));
     SDL_DestroyWindow(static_cast<SDL_Window*>(m_window));
     SDL_Quit();
@@ -155,21 +194,52 @@ void engine::Window::Shutdown()
 
 void engine::Window::SwapBuffers()
 {
-    SDL_GL_SwapWindow(static_cast<SDL_Window*>(m_window));
+    if (m_backend == WindowBackend::Sdl)
+    {
+        SDL_GL_SwapWindow(static_cast<SDL_Window*>(m_window));
+    }
+
+    ++m_swapCount;
+
+    if (m_swapCallback)
+    {
+        m_swapCallback();
+    }
+}
+
+void engine::Window::SetSwapCallback(std::function<void()> callback)
+{
+    m_swapCallback = std::move(callback);
+}
+
+uint64_t engine::Window::GetSwapCount() const
+{
+    return m_swapCount;
 }
 
-void engine::Window::SetTitle(const char* title) const
+void engine::Window::SetTitle(const char* title)
 {
     if (title == nullptr)
     {
         throw std::runtime_error("Tried to set a null window title");
     }
 
+    if (m_backend == WindowBackend::Headless)
+    {
+        m_title = title;
+        return;
+    }
+
     SDL_SetWindowTitle(static_cast<SDL_Window*>(m_window), title);
 }
 
 const char* engine::Window::GetTitle() const
 {
+    if (m_backend == WindowBackend::Headless)
+    {
+        return m_title.c_str();
+    }
+
     return SDL_GetWindowTitle(static_cast<SDL_Window*>(m_window));
 }
 
@@ -180,12 +250,24 @@ void engine::Window::SetSize(unsigned x, unsigned y)
         return;
     }
 
+    if (m_backend == WindowBackend::Headless)
+    {
+        m_width  = x;
+        m_height = y;
+        return;
+    }
+
     // note that SDL_SetWindowSize() might not set exactly the requested size
     SDL_SetWindowSize(static_cast<SDL_Window*>(m_window), static_cast<int>(x), static_cast<int>(y));
 }
 
 unsigned engine::Window::GetWidth() const
 {
+    if (m_backend == WindowBackend::Headless)
+    {
+        return m_width;
+    }
+
     int width;
     SDL_GetWindowSize(static_cast<SDL_Window*>(m_window), &width, nullptr);
 
@@ -194,6 +276,11 @@ unsigned engine::Window::GetWidth() const
 
 unsigned engine::Window::GetHeight() const
 {
+    if (m_backend == WindowBackend::Headless)
+    {
+        return m_height;
+    }
+
     int height;
     SDL_GetWindowSize(static_cast<SDL_Window*>(m_window), nullptr, &height);
 
@@ -202,6 +289,11 @@ unsigned engine::Window::GetHeight() const
 
 void engine::Window::SetFullScreenEnabled(bool enabled)
 {
+    if (m_backend == WindowBackend::Headless)
+    {
+        return;
+    }
+
     // note that the effect of SDL_SetWindowFullscreen() might not be immediate
     // m_fullScreenEnabled is set in the ProcessEvents() method when the SDL_EVENT_WINDOW_ENTER_FULLSCREEN or SDL_EVENT_WINDOW_LEAVE_FULLSCREEN event is emitted
     SDL_SetWindowFullscreen(static_cast<SDL_Window*>(m_window), enabled);
@@ -214,12 +306,24 @@ bool engine::Window::IsFullScreenEnabled() const
 
 void engine::Window::SetVSyncEnabled(bool enabled)
 {
+    // only remembered, pacing a headless loop is up to the frame cap of the engine
+    if (m_backend == WindowBackend::Headless)
+    {
+        m_isVSyncEnabled = enabled;
+        return;
+    }
+
     // ignoring adaptive vsync 
     SDL_GL_SetSwapInterval(static_cast<int>(enabled));
 }
 
 bool engine::Window::IsVSyncEnabled() const
 {
+    if (m_backend == WindowBackend::Headless)
+    {
+        return m_isVSyncEnabled;
+    }
+
     int swapInterval;
     SDL_GL_GetSwapInterval(&swapInterval);
 
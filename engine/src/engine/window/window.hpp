@@ -1,8 +1,18 @@
 #ifndef WINDOW_HPP
 #define WINDOW_HPP
 
+#include <cstdint>
+#include <functional>
+#include <string>
+
 namespace engine
 {
+    enum class WindowBackend
+    {
+        Sdl,     // an sdl window with an opengl 4.6 context
+        Headless // no window, no video subsystem and no gpu, for servers and build agents
+    };
+
     class Window
     {
         struct Constants
@@ -16,6 +26,15 @@ namespace engine
 
         bool m_isFullScreenEnabled;
 
+        // headless state, standing in for what sdl would report
+        WindowBackend         m_backend;
+        unsigned              m_width;
+        unsigned              m_height;
+        std::string           m_title;
+        bool                  m_isVSyncEnabled;
+        uint64_t              m_swapCount;
+        std::function<void()> m_swapCallback;
+
         Window();
         ~Window()                        = default;
         Window(const Window&)            = delete;
@@ -24,13 +43,23 @@ namespace engine
       public:
         static Window& GetInstance();
 
-        void Initialize();
+        // the headless backend has fixed dimensions, changed only by SetSize, is never
+        // minimized or full screen, has null handles, and swaps instantly
+        void          Initialize(WindowBackend backend = WindowBackend::Sdl);
+        WindowBackend GetBackend() const;
+        bool          IsHeadless() const;
+
         bool IsMinimized();
         void ProcessEvents(void* sdl_event);
         void Shutdown();
         void SwapBuffers();
 
-        void        SetTitle(const char* title) const;
+        // SwapBuffers marks the end of a frame with either backend. the callback runs after the
+        // swap, on the thread that swapped
+        void     SetSwapCallback(std::function<void()> callback);
+        uint64_t GetSwapCount() const;
+
+        void        SetTitle(const char* title);
         const char* GetTitle() const;
 
         void     SetSize(unsigned x, unsigned y);
@@ -3,6 +3,8 @@
 
 struct ProofGame : public iGameProject
 {
+	double m_simulatedTime = 0.0;
+
 	virtual void RegisterTypes() override
 	{
 		shared::Log("Registering types!");
@@ -17,6 +19,17 @@ struct ProofGame : public iGameProject
 	{
 		shared::Log("Game shutdown!");
 	}
+
+	virtual void FixedUpdate(double timestep) override
+	{
+		m_simulatedTime += timestep;
+	}
+
+	// there is no window to close yet, so the proof runs for a few simulated seconds
+	virtual bool IsQuitRequested() override
+	{
+		return m_simulatedTime >= 5.0;
+	}
 };
 
 #ifdef DLL_BUILD
@@ -31,6 +44,11 @@ int main(void)
     shared::Log("Standalone executable endpoint!");
 	Engine engine;
 	engine.SetGame(new ProofGame());
+
+	Engine::Settings settings = engine.GetSettings();
+	settings.m_targetFrameRate = 144.0;
+	engine.SetSettings(settings);
+
 	engine.Run();
 }
 #endif
\ No newline at end of file